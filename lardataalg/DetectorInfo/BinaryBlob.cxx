@@ -0,0 +1,218 @@
+/**
+ * @file   lardataalg/DetectorInfo/BinaryBlob.cxx
+ * @brief  Compact versioned binary storage for provider state.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/BinaryBlob.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::copy(), std::equal()
+#include <cerrno> // errno, EINTR
+#include <cstdio> // std::rename(), std::remove()
+#include <cstdlib> // mkstemp()
+
+// POSIX
+#include <fcntl.h> // open()
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat(), fchmod()
+#include <unistd.h> // close(), write()
+
+
+//------------------------------------------------------------------------------
+std::uint64_t detinfo::blobChecksum(char const* begin, char const* end) {
+  // 64-bit FNV-1a
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  while (begin != end) {
+    hash ^= static_cast<unsigned char>(*begin++);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+} // detinfo::blobChecksum()
+
+
+//------------------------------------------------------------------------------
+//--- detinfo::BlobWriter
+//------------------------------------------------------------------------------
+void detinfo::BlobWriter::write(std::string const& value) {
+  write(static_cast<std::uint64_t>(value.size()));
+  append(value.data(), value.size());
+} // detinfo::BlobWriter::write(std::string)
+
+
+//------------------------------------------------------------------------------
+void detinfo::BlobWriter::saveTo(std::string const& path,
+                                 std::uint32_t const contentVersion,
+                                 std::string const& tag /* = "" */) const
+{
+  if (tag.size() >= BlobHeader_t::TagSize) {
+    throw cet::exception("BinaryBlob")
+      << "Tag '" << tag << "' too long (" << tag.size() << " characters, maximum "
+      << (BlobHeader_t::TagSize - 1) << ")\n";
+  }
+
+  BlobHeader_t header{};
+  std::copy(std::begin(BlobHeader_t::Magic), std::end(BlobHeader_t::Magic), header.magic);
+  header.byteOrder = BlobHeader_t::ByteOrderMark;
+  header.format = BlobHeader_t::FormatVersion;
+  header.content = contentVersion;
+  header.reserved = 0U;
+  header.payloadSize = fData.size();
+  header.checksum = blobChecksum(fData.data(), fData.data() + fData.size());
+  std::copy(tag.begin(), tag.end(), header.tag);
+
+  // unique temporary file in the same directory, so that the rename is atomic
+  // and concurrent writers of the same path do not share it
+  std::string tempPath = path + ".XXXXXX";
+  int const fd = mkstemp(tempPath.data());
+  if (fd < 0) {
+    throw cet::exception("BinaryBlob")
+      << "Failed to create a temporary file for '" << path << "'\n";
+  }
+
+  // writes all the bytes, resuming after partial writes
+  auto const writeAll = [fd](char const* data, std::size_t size)
+    {
+      while (size > 0U) {
+        ssize_t const written = ::write(fd, data, size);
+        if (written < 0) {
+          if (errno == EINTR) continue;
+          return false;
+        }
+        data += written;
+        size -= written;
+      }
+      return true;
+    };
+
+  bool const written
+    = (fchmod(fd, 0644) == 0)
+    && writeAll(reinterpret_cast<char const*>(&header), sizeof(header))
+    && writeAll(fData.data(), fData.size());
+  if ((close(fd) != 0) || !written) {
+    std::remove(tempPath.c_str());
+    throw cet::exception("BinaryBlob")
+      << "Failed to write " << (sizeof(header) + fData.size())
+      << " bytes into '" << tempPath << "'\n";
+  }
+  if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+    std::remove(tempPath.c_str());
+    throw cet::exception("BinaryBlob")
+      << "Failed to rename '" << tempPath << "' into '" << path << "'\n";
+  }
+} // detinfo::BlobWriter::saveTo()
+
+
+//------------------------------------------------------------------------------
+void detinfo::BlobWriter::append(void const* src, std::size_t size) {
+  auto const* bytes = static_cast<char const*>(src);
+  fData.insert(fData.end(), bytes, bytes + size);
+} // detinfo::BlobWriter::append()
+
+
+//------------------------------------------------------------------------------
+//--- detinfo::BlobReader
+//------------------------------------------------------------------------------
+void detinfo::BlobReader::read(std::string& value) {
+  std::size_t const size = readSize(1U);
+  value.assign(fCurrent, size);
+  fCurrent += size;
+} // detinfo::BlobReader::read(std::string)
+
+
+//------------------------------------------------------------------------------
+void detinfo::BlobReader::extract(void* dest, std::size_t size) {
+  if (static_cast<std::size_t>(fEnd - fCurrent) < size) {
+    throw cet::exception("BinaryBlob")
+      << "Attempt to read " << size << " bytes with only " << (fEnd - fCurrent)
+      << " left in the payload\n";
+  }
+  if (size == 0U) return; // dest may be null (e.g. data of an empty vector)
+  std::memcpy(dest, fCurrent, size);
+  fCurrent += size;
+} // detinfo::BlobReader::extract()
+
+
+//------------------------------------------------------------------------------
+std::size_t detinfo::BlobReader::readSize(std::size_t elementSize) {
+  auto const size = read<std::uint64_t>();
+  if (size > static_cast<std::uint64_t>(fEnd - fCurrent) / elementSize) {
+    throw cet::exception("BinaryBlob")
+      << "Sequence of " << size << " elements does not fit the "
+      << (fEnd - fCurrent) << " bytes left in the payload\n";
+  }
+  return static_cast<std::size_t>(size);
+} // detinfo::BlobReader::readSize()
+
+
+//------------------------------------------------------------------------------
+//--- detinfo::MappedBlob
+//------------------------------------------------------------------------------
+detinfo::MappedBlob::MappedBlob(std::string const& path,
+                                std::uint32_t const contentVersion,
+                                std::string const& tag /* = "" */)
+{
+  int const fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw cet::exception("BinaryBlob") << "Can't open blob file '" << path << "'\n";
+  }
+
+  struct stat info;
+  if ((::fstat(fd, &info) != 0) || (info.st_size < static_cast<off_t>(sizeof(BlobHeader_t)))) {
+    ::close(fd);
+    throw cet::exception("BinaryBlob") << "File '" << path << "' is not a blob file\n";
+  }
+
+  fMapSize = static_cast<std::size_t>(info.st_size);
+  fMap = ::mmap(nullptr, fMapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // the mapping stays valid
+  if (fMap == MAP_FAILED) {
+    fMap = nullptr;
+    throw cet::exception("BinaryBlob") << "Failed to map blob file '" << path << "'\n";
+  }
+
+  char const* const start = static_cast<char const*>(fMap);
+  std::memcpy(&fHeader, start, sizeof(fHeader));
+  fPayload = start + sizeof(fHeader);
+
+  // from here on, errors must release the mapping
+  auto error = [this, &path]() {
+    ::munmap(fMap, fMapSize);
+    fMap = nullptr;
+    return cet::exception("BinaryBlob") << "Blob file '" << path << "': ";
+  };
+
+  if (!std::equal(std::begin(BlobHeader_t::Magic), std::end(BlobHeader_t::Magic), fHeader.magic))
+    throw error() << "not a blob file\n";
+  if (fHeader.byteOrder != BlobHeader_t::ByteOrderMark)
+    throw error() << "written with a different byte order\n";
+  if (fHeader.format != BlobHeader_t::FormatVersion) {
+    throw error() << "container format version " << fHeader.format << ", expected "
+                  << BlobHeader_t::FormatVersion << "\n";
+  }
+  if (fHeader.content != contentVersion) {
+    throw error() << "content version " << fHeader.content << ", expected " << contentVersion
+                  << "\n";
+  }
+  fHeader.tag[BlobHeader_t::TagSize - 1] = '\0';
+  if (!tag.empty() && (tag != fHeader.tag))
+    throw error() << "tag '" << fHeader.tag << "', expected '" << tag << "'\n";
+  if (fHeader.payloadSize != fMapSize - sizeof(fHeader)) {
+    throw error() << "payload is " << (fMapSize - sizeof(fHeader)) << " bytes, expected "
+                  << fHeader.payloadSize << "\n";
+  }
+  if (blobChecksum(fPayload, fPayload + fHeader.payloadSize) != fHeader.checksum)
+    throw error() << "checksum mismatch\n";
+
+} // detinfo::MappedBlob::MappedBlob()
+
+
+//------------------------------------------------------------------------------
+detinfo::MappedBlob::~MappedBlob() {
+  if (fMap) ::munmap(fMap, fMapSize);
+} // detinfo::MappedBlob::~MappedBlob()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,278 @@
+/**
+ * @file   lardataalg/DetectorInfo/BinaryBlob.h
+ * @brief  Compact versioned binary storage for provider state.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/BinaryBlob.cxx
+ *
+ * A blob file is made of a fixed header followed by the payload.
+ * The header contains:
+ * * a magic word identifying the file type (`BlobHeader_t::Magic`);
+ * * the version of the container format (`BlobHeader_t::FormatVersion`);
+ * * the version of the content, chosen by the writer of the payload; the
+ *   reader must request the same version (e.g. `ProviderStateVersion`);
+ * * a free tag (for example, an identifier of the configuration the content
+ *   was created from), which the reader may require to match;
+ * * payload size and checksum.
+ *
+ * The payload is written in the native byte order, which is checked on read.
+ * Files are read via memory mapping, and the whole payload is validated
+ * against the checksum before any value is read.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_BINARYBLOB_H
+#define LARDATAALG_DETECTORINFO_BINARYBLOB_H
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <cstring> // std::memcpy()
+#include <string>
+#include <type_traits> // std::is_arithmetic_v, ...
+#include <vector>
+
+
+namespace detinfo {
+
+  // ---------------------------------------------------------------------------
+  /// Header of a binary blob file.
+  struct BlobHeader_t {
+
+    /// Magic word at the beginning of each blob file.
+    static constexpr char Magic[8] = { 'L', 'A', 'R', 'D', 'B', 'L', 'O', 'B' };
+
+    /// Version of the container format described by this header.
+    static constexpr std::uint32_t FormatVersion = 1U;
+
+    /// Value used to detect the byte order.
+    static constexpr std::uint32_t ByteOrderMark = 0x01020304U;
+
+    /// Maximum length of the tag (including the terminating null character).
+    static constexpr std::size_t TagSize = 48U;
+
+    char magic[sizeof(Magic)]; ///< Magic word.
+    std::uint32_t byteOrder;   ///< Always `ByteOrderMark` in native order.
+    std::uint32_t format;      ///< Version of the container format.
+    std::uint32_t content;     ///< Version of the content.
+    std::uint32_t reserved;    ///< Padding, always `0`.
+    std::uint64_t payloadSize; ///< Size of the payload in bytes.
+    std::uint64_t checksum;    ///< Checksum of the payload.
+    char tag[TagSize];         ///< Free tag, null-terminated.
+
+  }; // BlobHeader_t
+
+
+  /// Returns the checksum (64-bit FNV-1a) of the specified memory range.
+  std::uint64_t blobChecksum(char const* begin, char const* end);
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Collects data into a binary blob.
+   *
+   * Supported types are arithmetic types and enumerations, `std::string`,
+   * and `std::vector` of any supported type.
+   * Vectors and strings are stored as their size followed by their content.
+   *
+   * Example:
+   *
+   *     detinfo::BlobWriter out;
+   *     out.write(temperature);
+   *     out.write(efields); // std::vector<double>
+   *     out.saveTo("state.bin", 1U, "my configuration");
+   *
+   */
+  class BlobWriter {
+      public:
+
+    /// Appends a value to the payload.
+    template <typename T>
+    void write(T const& value);
+
+    /// Appends a string to the payload.
+    void write(std::string const& value);
+
+    /// Appends a vector to the payload.
+    template <typename T>
+    void write(std::vector<T> const& values);
+
+    /// Returns the payload collected so far.
+    std::vector<char> const& data() const { return fData; }
+
+    /**
+     * @brief Writes header and payload into the specified file.
+     * @param path path of the output file
+     * @param contentVersion the version of the content of the payload
+     * @param tag a free tag to be stored in the header
+     * @throw cet::exception (category: `"BinaryBlob"`) on error
+     *
+     * The file is first written under a unique temporary name in the same
+     * directory and then renamed, so that concurrent readers never see a
+     * partially written file and concurrent writers do not interfere; the
+     * temporary file is removed if writing fails.
+     */
+    void saveTo(std::string const& path,
+                std::uint32_t contentVersion,
+                std::string const& tag = "") const;
+
+      private:
+
+    std::vector<char> fData; ///< Payload.
+
+    /// Appends raw bytes to the payload.
+    void append(void const* src, std::size_t size);
+
+  }; // class BlobWriter
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Reads data from a binary blob payload.
+   *
+   * The reader does not own the memory. Data must be read in the same order
+   * and with the same types as it was written with `BlobWriter`.
+   * Reading past the end of the payload throws a `cet::exception` (category:
+   * `"BinaryBlob"`).
+   */
+  class BlobReader {
+      public:
+
+    /// Reads from the specified memory range.
+    BlobReader(char const* begin, char const* end)
+      : fCurrent(begin), fEnd(end) {}
+
+    /// Reads the next value of type `T` into `value`.
+    template <typename T>
+    void read(T& value);
+
+    /// Reads the next string into `value`.
+    void read(std::string& value);
+
+    /// Reads the next vector into `values`.
+    template <typename T>
+    void read(std::vector<T>& values);
+
+    /// Returns the next value, of type `T`.
+    template <typename T>
+    T read() { T value; read(value); return value; }
+
+    /// Returns whether all the payload has been read.
+    bool atEnd() const { return fCurrent == fEnd; }
+
+      private:
+
+    char const* fCurrent; ///< Next byte to be read.
+    char const* fEnd; ///< End of the payload.
+
+    /// Copies the next `size` bytes into `dest`.
+    void extract(void* dest, std::size_t size);
+
+    /// Reads a size value, checking that at least that many elements of
+    /// `elementSize` bytes are left.
+    std::size_t readSize(std::size_t elementSize);
+
+  }; // class BlobReader
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief A binary blob file mapped in memory.
+   *
+   * The file is mapped read-only on construction, and its header and checksum
+   * are validated. On any mismatch (including a content version or tag
+   * different from the requested ones) a `cet::exception` is thrown (category:
+   * `"BinaryBlob"`): the caller may then create the content from scratch.
+   */
+  class MappedBlob {
+      public:
+
+    /**
+     * @brief Maps and validates the specified file.
+     * @param path path of the blob file
+     * @param contentVersion the expected version of the content
+     * @param tag the expected tag (empty to accept any)
+     * @throw cet::exception (category: `"BinaryBlob"`) on error
+     */
+    MappedBlob(std::string const& path,
+               std::uint32_t contentVersion,
+               std::string const& tag = "");
+
+    MappedBlob(MappedBlob const&) = delete;
+    MappedBlob& operator= (MappedBlob const&) = delete;
+
+    ~MappedBlob();
+
+    /// Returns a reader for the payload.
+    BlobReader reader() const
+      { return { fPayload, fPayload + fHeader.payloadSize }; }
+
+    /// Returns the tag stored in the file.
+    std::string tag() const { return fHeader.tag; }
+
+    /// Returns the header of the file.
+    BlobHeader_t const& header() const { return fHeader; }
+
+      private:
+
+    void* fMap = nullptr; ///< Start of the mapped memory.
+    std::size_t fMapSize = 0U; ///< Size of the mapped memory.
+    BlobHeader_t fHeader; ///< Copy of the header.
+    char const* fPayload = nullptr; ///< Start of the payload.
+
+  }; // class MappedBlob
+
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T>
+void detinfo::BlobWriter::write(T const& value) {
+  static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+    "BlobWriter supports only arithmetic types, enumerations, strings and vectors");
+  append(&value, sizeof(value));
+} // detinfo::BlobWriter::write()
+
+
+template <typename T>
+void detinfo::BlobWriter::write(std::vector<T> const& values) {
+  write(static_cast<std::uint64_t>(values.size()));
+  if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+    append(values.data(), values.size() * sizeof(T));
+  }
+  else {
+    for (auto const& value: values) write(value);
+  }
+} // detinfo::BlobWriter::write(std::vector)
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void detinfo::BlobReader::read(T& value) {
+  static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+    "BlobReader supports only arithmetic types, enumerations, strings and vectors");
+  extract(&value, sizeof(value));
+} // detinfo::BlobReader::read()
+
+
+template <typename T>
+void detinfo::BlobReader::read(std::vector<T>& values) {
+  if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+    values.resize(readSize(sizeof(T)));
+    extract(values.data(), values.size() * sizeof(T));
+  }
+  else {
+    // each element takes at least the 8 bytes of its own size
+    values.resize(readSize(sizeof(std::uint64_t)));
+    for (auto& value: values) read(value);
+  }
+} // detinfo::BlobReader::read(std::vector)
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAALG_DETECTORINFO_BINARYBLOB_H
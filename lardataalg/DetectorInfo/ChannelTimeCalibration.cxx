@@ -0,0 +1,234 @@
+/**
+ * @file   lardataalg/DetectorInfo/ChannelTimeCalibration.cxx
+ * @brief  Table of per-channel time offsets, applied to arrays of times.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ChannelTimeCalibration.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/ChannelTimeCalibration.h"
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max_element()
+#include <fstream>
+#include <iomanip> // std::setw(), std::setfill()
+#include <istream>
+#include <iterator> // std::istreambuf_iterator
+#include <sstream> // std::istringstream, std::ostringstream
+#include <stdexcept> // std::domain_error, std::runtime_error
+
+
+namespace {
+
+  /// Returns a tag identifying the content of a text file.
+  std::string contentTag(std::string const& content) {
+    std::ostringstream sstr;
+    sstr << "text:" << std::hex << std::setfill('0') << std::setw(16)
+      << detinfo::blobChecksum(content.data(), content.data() + content.size());
+    return sstr.str();
+  } // contentTag()
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+detinfo::ChannelTimeCalibration::ChannelTimeCalibration
+  (std::vector<offset_t> const& offsets, version_t version /* = 0U */)
+  : fVersion(version)
+{
+  fOffsets.reserve(offsets.size());
+  for (offset_t const offset: offsets) fOffsets.push_back(offset.value());
+} // detinfo::ChannelTimeCalibration::ChannelTimeCalibration()
+
+
+//------------------------------------------------------------------------------
+void detinfo::ChannelTimeCalibration::checkChannels
+  (channel_t const* channels, std::size_t n) const
+{
+  if (n == 0U) return;
+  channel_t const maxChannel = *std::max_element(channels, channels + n);
+  if (maxChannel < nChannels()) return;
+  throw std::out_of_range("ChannelTimeCalibration: channel "
+    + std::to_string(maxChannel) + " not in the table ("
+    + std::to_string(nChannels()) + " channels)");
+} // detinfo::ChannelTimeCalibration::checkChannels()
+
+
+void detinfo::ChannelTimeCalibration::checkSizes
+  (std::size_t nChannels, std::size_t nValues)
+{
+  if (nChannels == nValues) return;
+  throw std::out_of_range("ChannelTimeCalibration: "
+    + std::to_string(nChannels) + " channels for " + std::to_string(nValues)
+    + " values");
+} // detinfo::ChannelTimeCalibration::checkSizes()
+
+
+//------------------------------------------------------------------------------
+detinfo::ChannelTimeCalibration detinfo::ChannelTimeCalibration::Read
+  (std::istream& in, version_t version /* = 0U */, std::size_t nChannels /* = 0U */)
+{
+  // the table is sized by the highest channel: refuse to allocate for
+  // channels which can't exist
+  std::size_t const maxChannels
+    = nChannels? nChannels: ChannelTimeCalibrationMaxChannels;
+
+  // board and channel offsets are collected separately, then summed
+  std::vector<double> boardOffsets, channelOffsets;
+  std::vector<bool> hasChannel;
+  unsigned int iLine = 0;
+  auto const makeRoom = [&](channel_t channel)
+    {
+      if (channel < boardOffsets.size()) return;
+      if (!raw::isValidChannelID(channel)) {
+        throw std::domain_error("ChannelTimeCalibration: invalid channel on line "
+          + std::to_string(iLine));
+      }
+      if (channel >= maxChannels) {
+        throw std::domain_error("ChannelTimeCalibration: channel "
+          + std::to_string(channel) + " on line " + std::to_string(iLine)
+          + " beyond the " + std::to_string(maxChannels) + " channels"
+          + (nChannels? " of the detector": " supported"));
+      }
+      boardOffsets.resize(channel + 1U, 0.0);
+      channelOffsets.resize(channel + 1U, 0.0);
+      hasChannel.resize(channel + 1U, false);
+    };
+
+  std::string line;
+  while (std::getline(in, line)) {
+    ++iLine;
+    if (auto const comment = line.find('#'); comment != std::string::npos)
+      line.erase(comment);
+
+    std::istringstream sline { line };
+    std::string type;
+    if (!(sline >> type)) continue; // empty line
+
+    double offset;
+    if (type == "channel") {
+      channel_t channel;
+      if (!(sline >> channel >> offset)) {
+        throw std::domain_error
+          ("ChannelTimeCalibration: malformed line " + std::to_string(iLine));
+      }
+      makeRoom(channel);
+      if (hasChannel[channel]) {
+        throw std::domain_error("ChannelTimeCalibration: channel "
+          + std::to_string(channel) + " repeated on line " + std::to_string(iLine));
+      }
+      hasChannel[channel] = true;
+      channelOffsets[channel] = offset;
+    }
+    else if (type == "board") {
+      channel_t first, last;
+      if (!(sline >> first >> last >> offset) || (last < first)) {
+        throw std::domain_error
+          ("ChannelTimeCalibration: malformed line " + std::to_string(iLine));
+      }
+      makeRoom(last);
+      for (channel_t channel = first; channel <= last; ++channel)
+        boardOffsets[channel] += offset;
+    }
+    else {
+      throw std::domain_error("ChannelTimeCalibration: unknown entry '" + type
+        + "' on line " + std::to_string(iLine));
+    }
+
+    std::string extra;
+    if (sline >> extra) {
+      throw std::domain_error("ChannelTimeCalibration: unexpected '" + extra
+        + "' on line " + std::to_string(iLine));
+    }
+  } // while
+
+  if (nChannels > 0U) {
+    boardOffsets.resize(nChannels, 0.0);
+    channelOffsets.resize(nChannels, 0.0);
+  }
+
+  ChannelTimeCalibration calib;
+  calib.fVersion = version;
+  calib.fOffsets = std::move(channelOffsets);
+  for (std::size_t channel = 0; channel < calib.fOffsets.size(); ++channel)
+    calib.fOffsets[channel] += boardOffsets[channel];
+  return calib;
+} // detinfo::ChannelTimeCalibration::Read()
+
+
+//------------------------------------------------------------------------------
+detinfo::ChannelTimeCalibration detinfo::ChannelTimeCalibration::FromFile(
+  std::string const& path,
+  std::string const& cachePath /* = "" */,
+  version_t version /* = 0U */,
+  std::size_t nChannels /* = 0U */
+) {
+  std::ifstream in { path };
+  if (!in) {
+    throw std::runtime_error
+      ("ChannelTimeCalibration: can't read file '" + path + "'");
+  }
+  std::string const content
+    { std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+  std::string const tag = contentTag(content);
+
+  if (!cachePath.empty()) {
+    try {
+      ChannelTimeCalibration calib = LoadCache(cachePath, tag);
+      if ((nChannels == 0U) || (calib.nChannels() == nChannels)) {
+        calib.fVersion = version;
+        return calib;
+      }
+    }
+    catch (cet::exception const&) {} // missing or stale cache: parse the text
+  }
+
+  std::istringstream sin { content };
+  ChannelTimeCalibration calib = Read(sin, version, nChannels);
+
+  if (!cachePath.empty()) {
+    try {
+      calib.SaveCache(cachePath, tag);
+    }
+    catch (cet::exception const&) {} // the cache is only an optimization
+  }
+  return calib;
+} // detinfo::ChannelTimeCalibration::FromFile()
+
+
+//------------------------------------------------------------------------------
+void detinfo::ChannelTimeCalibration::SaveCache
+  (std::string const& path, std::string const& tag /* = "" */) const
+{
+  BlobWriter out;
+  out.write(fVersion);
+  out.write(fOffsets);
+  out.saveTo(path, ChannelTimeCalibrationCacheVersion, tag);
+} // detinfo::ChannelTimeCalibration::SaveCache()
+
+
+//------------------------------------------------------------------------------
+detinfo::ChannelTimeCalibration detinfo::ChannelTimeCalibration::LoadCache
+  (std::string const& path, std::string const& tag /* = "" */)
+{
+  MappedBlob const blob { path, ChannelTimeCalibrationCacheVersion, tag };
+  BlobReader in = blob.reader();
+
+  ChannelTimeCalibration calib;
+  in.read(calib.fVersion);
+  in.read(calib.fOffsets);
+  if (!in.atEnd()) {
+    throw cet::exception("BinaryBlob")
+      << "Unexpected data after the time calibration table in '" << path << "'\n";
+  }
+  return calib;
+} // detinfo::ChannelTimeCalibration::LoadCache()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,348 @@
+/**
+ * @file   lardataalg/DetectorInfo/ChannelTimeCalibration.h
+ * @brief  Table of per-channel time offsets, applied to arrays of times.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ChannelTimeCalibration.cxx
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_CHANNELTIMECALIBRATION_H
+#define LARDATAALG_DETECTORINFO_CHANNELTIMECALIBRATION_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h" // detinfo::timescales
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <cmath> // std::round()
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <iosfwd> // std::istream
+#include <memory> // std::shared_ptr, std::atomic_load(), ...
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <type_traits> // std::is_integral_v
+#include <utility> // std::move()
+#include <vector>
+
+
+namespace detinfo {
+
+  /// Version of the content of the binary cache of `ChannelTimeCalibration`.
+  /// It must be increased on every change of the layout of the cache.
+  inline constexpr std::uint32_t ChannelTimeCalibrationCacheVersion = 1U;
+
+  /// Largest number of channels of a table read from text, when the number of
+  /// channels of the detector is not specified.
+  inline constexpr std::size_t ChannelTimeCalibrationMaxChannels = 4'000'000U;
+
+
+  /**
+   * @brief Dense table of the time offset of each readout channel.
+   *
+   * This object complements `detinfo::DetectorClocksData`: once times have
+   * been converted into a time scale, the offset of the channel (the sum of
+   * the offset of its readout board and its own) is added to them.
+   * Offsets are stored contiguously by channel number, so that applying them
+   * to a whole array of times (`apply()`, `applyToTicks()`) is a gather
+   * followed by an addition, which the compiler can vectorize.
+   *
+   * The table is read from a text file (`Read()`, `FromFile()`), one offset
+   * per line:
+   *
+   *     channel <channel ID> <offset [us]>
+   *     board <first channel ID> <last channel ID> <offset [us]>
+   *
+   * where a `board` line applies the offset to all the channels in the range
+   * (both included). Empty lines and text following a `#` are ignored.
+   * Channels not mentioned have no offset. The table covers the number of
+   * channels of the detector, if specified, and channels beyond it are an
+   * error; otherwise it extends up to the highest channel in the file, which
+   * must be below `ChannelTimeCalibrationMaxChannels`. `FromFile()` can keep a binary
+   * cache of the table, in `detinfo::BlobWriter` format, tagged with the
+   * checksum of the text file so that it is rebuilt when the file changes.
+   *
+   * Each table carries a version number (for example, the run it is valid
+   * from), which is not interpreted. Tables are immutable once built, and they
+   * are swapped at run boundaries through `ChannelTimeCalibrationSource`.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * detinfo::ChannelTimeCalibration const calib
+   *   = detinfo::ChannelTimeCalibration::FromFile("offsets.txt", "offsets.bin", run);
+   *
+   * std::vector<electronics_time> times = ...; // from the clock conversions
+   * calib.apply(channels, times); // times[i] += offset of channels[i]
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class ChannelTimeCalibration {
+      public:
+
+    using channel_t = raw::ChannelID_t; ///< Type of channel number.
+    using offset_t = timescales::time_interval; ///< Type of time offset.
+    using version_t = std::uint32_t; ///< Type of the version of the table.
+
+    /// Creates an empty table, with no channel.
+    ChannelTimeCalibration() = default;
+
+    /// Creates a table with the specified offset for each channel.
+    explicit ChannelTimeCalibration
+      (std::vector<offset_t> const& offsets, version_t version = 0U);
+
+
+    /// Returns the version of the table.
+    version_t version() const { return fVersion; }
+
+    /// Returns the number of channels in the table.
+    std::size_t nChannels() const { return fOffsets.size(); }
+
+    /// Returns the offset of `channel` (unchecked).
+    offset_t offset(channel_t channel) const
+      { return offset_t{ fOffsets[channel] }; }
+
+    /// Returns the offsets of all channels [us].
+    std::vector<double> const& offsetValues() const { return fOffsets; }
+
+
+    // --- BEGIN -- Application ------------------------------------------------
+    /// @name Application
+    /// @{
+
+    /**
+     * @brief Adds the offset of `channels[i]` to each `times[i]`.
+     * @tparam TimePoint type of time point (on any time scale)
+     * @param channels the channel of each time
+     * @param times the times to be corrected
+     * @param n number of times
+     * @throw std::out_of_range if any channel is not in the table
+     *
+     * All channels are checked before any time is changed.
+     */
+    template <typename TimePoint>
+    void apply(channel_t const* channels, TimePoint* times, std::size_t n) const;
+
+    /// Adds the offset of `channels[i]` to each `times[i]`.
+    /// @throw std::out_of_range if the sizes don't match
+    template <typename TimePoint>
+    void apply
+      (std::vector<channel_t> const& channels, std::vector<TimePoint>& times) const;
+
+    /**
+     * @brief Adds the offset of `channels[i]` to each tick `ticks[i]`.
+     * @tparam Tick type of tick point (on any time scale)
+     * @param channels the channel of each tick
+     * @param ticks the ticks to be corrected
+     * @param n number of ticks
+     * @param tickPeriod duration of a tick
+     * @throw std::out_of_range if any channel is not in the table
+     *
+     * Offsets are converted into ticks; if `Tick` is integral, they are
+     * rounded to the nearest tick.
+     */
+    template <typename Tick>
+    void applyToTicks(channel_t const* channels, Tick* ticks, std::size_t n,
+                      offset_t tickPeriod) const;
+
+    /// Adds the offset of `channels[i]` to each tick `ticks[i]`.
+    /// @throw std::out_of_range if the sizes don't match
+    template <typename Tick>
+    void applyToTicks(std::vector<channel_t> const& channels,
+                      std::vector<Tick>& ticks, offset_t tickPeriod) const;
+
+    /// @}
+    // --- END -- Application --------------------------------------------------
+
+
+    // --- BEGIN -- Input and output -------------------------------------------
+    /// @name Input and output
+    /// @{
+
+    /**
+     * @brief Reads a table in the text format described above.
+     * @param in the stream to read from
+     * @param version the version assigned to the table
+     * @param nChannels number of channels of the detector (`0` if unknown)
+     * @throw std::domain_error on malformed input, duplicate channels or
+     *        channels beyond the number of channels (see above)
+     *
+     * If `nChannels` is not `0`, the table has exactly `nChannels` channels.
+     */
+    static ChannelTimeCalibration Read
+      (std::istream& in, version_t version = 0U, std::size_t nChannels = 0U);
+
+    /**
+     * @brief Reads a table from a text file, possibly via a binary cache.
+     * @param path path of the text file
+     * @param cachePath path of the binary cache (empty for no cache)
+     * @param version the version assigned to the table
+     * @param nChannels number of channels of the detector (`0` if unknown)
+     * @throw std::runtime_error if the file can't be read
+     * @throw std::domain_error on malformed input
+     * @see `Read()`
+     *
+     * If the cache exists, was created from the same content of the text
+     * file and has `nChannels` channels (if specified), the table is taken
+     * from it. Otherwise the text file is parsed and the cache is
+     * (re)written; failure to write the cache is not an error.
+     */
+    static ChannelTimeCalibration FromFile(std::string const& path,
+                                           std::string const& cachePath = "",
+                                           version_t version = 0U,
+                                           std::size_t nChannels = 0U);
+
+    /// Writes the table into a binary cache at `path`, with the given `tag`.
+    /// @throw cet::exception (category: `"BinaryBlob"`) on error
+    void SaveCache(std::string const& path, std::string const& tag = "") const;
+
+    /// Reads the table from a binary cache at `path` with the given `tag`.
+    /// @throw cet::exception (category: `"BinaryBlob"`) on any mismatch
+    static ChannelTimeCalibration LoadCache
+      (std::string const& path, std::string const& tag = "");
+
+    /// @}
+    // --- END -- Input and output ---------------------------------------------
+
+
+      private:
+
+    std::vector<double> fOffsets; ///< Offset of each channel [us].
+    version_t fVersion = 0U; ///< Version of the table.
+
+    /// Adds to each of the `n` points the offset of its channel times `scale`.
+    template <typename Point>
+    void gatherAdd(channel_t const* channels, Point* points, std::size_t n,
+                   double scale) const;
+
+    /// Throws `std::out_of_range` if any of the `n` channels is not in table.
+    void checkChannels(channel_t const* channels, std::size_t n) const;
+
+    /// Throws `std::out_of_range` unless `nChannels` and `nValues` match.
+    static void checkSizes(std::size_t nChannels, std::size_t nValues);
+
+  }; // class ChannelTimeCalibration
+
+
+  /**
+   * @brief Holder of the current time calibration table, swappable per run.
+   *
+   * Readers take a snapshot with `current()` (for example, once per event)
+   * and use it for as long as they need: the snapshot stays valid and
+   * unchanged even after `update()` installs a new table.
+   *
+   * The pointer is exchanged with `std::atomic_load()` and
+   * `std::atomic_store()`, which are thread safe but not lock-free: the
+   * common standard library implementations protect them with a short lock.
+   * The lock covers only the copy of the pointer, never the table, but
+   * readers should still take one snapshot per event rather than one per
+   * call.
+   */
+  class ChannelTimeCalibrationSource {
+      public:
+
+    using table_ptr = std::shared_ptr<ChannelTimeCalibration const>;
+
+    /// Starts with an empty table.
+    ChannelTimeCalibrationSource()
+      : fCurrent(std::make_shared<ChannelTimeCalibration const>()) {}
+
+    /// Returns the current table.
+    table_ptr current() const { return std::atomic_load(&fCurrent); }
+
+    /// Returns the version of the current table.
+    ChannelTimeCalibration::version_t version() const
+      { return current()->version(); }
+
+    /// Replaces the current table with `table`.
+    void update(ChannelTimeCalibration table)
+      {
+        std::atomic_store(&fCurrent,
+          std::make_shared<ChannelTimeCalibration const>(std::move(table)));
+      }
+
+      private:
+
+    table_ptr fCurrent; ///< Current table (access only atomically).
+
+  }; // class ChannelTimeCalibrationSource
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename TimePoint>
+void detinfo::ChannelTimeCalibration::apply
+  (channel_t const* channels, TimePoint* times, std::size_t n) const
+{
+  checkChannels(channels, n);
+  // the offsets are converted into the unit of `TimePoint` (e.g. nanoseconds)
+  double const unit = (TimePoint{} + offset_t{ 1.0 }).value();
+  gatherAdd(channels, times, n, unit);
+} // detinfo::ChannelTimeCalibration::apply()
+
+
+template <typename TimePoint>
+void detinfo::ChannelTimeCalibration::apply
+  (std::vector<channel_t> const& channels, std::vector<TimePoint>& times) const
+{
+  checkSizes(channels.size(), times.size());
+  apply(channels.data(), times.data(), times.size());
+} // detinfo::ChannelTimeCalibration::apply(vector)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick>
+void detinfo::ChannelTimeCalibration::applyToTicks(
+  channel_t const* channels, Tick* ticks, std::size_t n, offset_t tickPeriod
+) const {
+  checkChannels(channels, n);
+  gatherAdd(channels, ticks, n, 1.0 / tickPeriod.value());
+} // detinfo::ChannelTimeCalibration::applyToTicks()
+
+
+template <typename Tick>
+void detinfo::ChannelTimeCalibration::applyToTicks(
+  std::vector<channel_t> const& channels, std::vector<Tick>& ticks,
+  offset_t tickPeriod
+) const {
+  checkSizes(channels.size(), ticks.size());
+  applyToTicks(channels.data(), ticks.data(), ticks.size(), tickPeriod);
+} // detinfo::ChannelTimeCalibration::applyToTicks(vector)
+
+
+//------------------------------------------------------------------------------
+template <typename Point>
+void detinfo::ChannelTimeCalibration::gatherAdd
+  (channel_t const* channels, Point* points, std::size_t n, double scale) const
+{
+  using value_t = typename Point::value_t;
+
+  // the values of each block are moved into a local buffer, which can't
+  // overlap with the offsets, so that the gather-add loop can be vectorized
+  constexpr std::size_t BlockSize = 256U;
+  double buffer[BlockSize];
+  double const* offsets = fOffsets.data();
+  for (std::size_t first = 0; first < n; first += BlockSize) {
+    std::size_t const size = std::min(BlockSize, n - first);
+    channel_t const* blockChannels = channels + first;
+    Point* blockPoints = points + first;
+
+    for (std::size_t i = 0; i < size; ++i) buffer[i] = blockPoints[i].value();
+    for (std::size_t i = 0; i < size; ++i)
+      buffer[i] += offsets[blockChannels[i]] * scale;
+    for (std::size_t i = 0; i < size; ++i) {
+      if constexpr (std::is_integral_v<value_t>) {
+        blockPoints[i] = Point{ blockPoints[i].value()
+          + static_cast<value_t>(std::round(buffer[i] - blockPoints[i].value())) };
+      }
+      else blockPoints[i] = Point{ static_cast<value_t>(buffer[i]) };
+    } // for
+  } // for blocks
+} // detinfo::ChannelTimeCalibration::gatherAdd()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_DETECTORINFO_CHANNELTIMECALIBRATION_H
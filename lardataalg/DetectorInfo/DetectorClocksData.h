@@ -323,7 +323,7 @@ namespace detinfo {
      *     in the @ref DetectorClocksElectronicsTime "electronics time frame"
      *
      */
-    DetectorClocksData(double const g4_ref_time,
+    constexpr DetectorClocksData(double const g4_ref_time,
                        double const trigger_offset_tpc,
                        double const trig_time,
                        double const beam_time,
@@ -346,7 +346,7 @@ namespace detinfo {
      *
      * This offset is set via configuration parameter `TriggerOffsetTPC`.
      */
-    double
+    constexpr double
     TriggerOffsetTPC() const
     {
       if (fTriggerOffsetTPC < 0)
@@ -358,7 +358,7 @@ namespace detinfo {
 
     /// Returns the @ref DetectorClocksTPCelectronicsStartTime "TPC electronics
     /// start time" in @ref DetectorClocksElectronicsTime "electronics time".
-    double
+    constexpr double
     TPCTime() const
     {
       return doTPCTime();
@@ -366,21 +366,28 @@ namespace detinfo {
 
     /// Given Geant4 time [ns], returns relative time [us] w.r.t. electronics
     /// time T0
-    double
+    constexpr double
     G4ToElecTime(double const g4_time) const
     {
       return g4_time * 1.e-3 - fG4RefTime;
     }
 
+    /// Geant4 time [us] where the electronics clock counting starts
+    constexpr double
+    G4RefTime() const
+    {
+      return fG4RefTime;
+    }
+
     /// Trigger electronics clock time in [us]
-    double
+    constexpr double
     TriggerTime() const
     {
       return fTriggerTime;
     }
 
     /// Beam gate electronics clock time in [us]
-    double
+    constexpr double
     BeamGateTime() const
     {
       return fBeamGateTime;
@@ -390,7 +397,7 @@ namespace detinfo {
     // Getters of TPC ElecClock
     //
     /// Borrow a const TPC clock with time set to Trigger time [us]
-    ElecClock const&
+    constexpr ElecClock const&
     TPCClock() const noexcept
     {
       return fTPCClock;
@@ -400,7 +407,7 @@ namespace detinfo {
     // Getters of Optical ElecClock
     //
     /// Borrow a const Optical clock with time set to Trigger time [us]
-    ElecClock const&
+    constexpr ElecClock const&
     OpticalClock() const noexcept
     {
       return fOpticalClock;
@@ -410,7 +417,7 @@ namespace detinfo {
     // Getters of Trigger ElecClock
     //
     /// Borrow a const Trigger clock with time set to Trigger time [us]
-    ElecClock const&
+    constexpr ElecClock const&
     TriggerClock() const noexcept
     {
       return fTriggerClock;
@@ -420,7 +427,7 @@ namespace detinfo {
     // Getters of External ElecClock
     //
     /// Borrow a const Trigger clock with time set to External Time [us]
-    ElecClock const&
+    constexpr ElecClock const&
     ExternalClock() const noexcept
     {
       return fExternalClock;
@@ -432,35 +439,35 @@ namespace detinfo {
 
     /// Given TPC time-tick (waveform index), returns time [us] w.r.t. trigger
     /// time stamp
-    double
+    constexpr double
     TPCTick2TrigTime(double const tick) const
     {
       return fTPCClock.TickPeriod() * tick + TriggerOffsetTPC();
     }
     /// Given TPC time-tick (waveform index), returns time [us] w.r.t. beam gate
     /// time
-    double
+    constexpr double
     TPCTick2BeamTime(double const tick) const
     {
       return TPCTick2TrigTime(tick) + TriggerTime() - BeamGateTime();
     }
     /// Given Optical time-tick (waveform index), sample and frame number,
     /// returns time [us] w.r.t. trigger time stamp
-    double
+    constexpr double
     OpticalTick2TrigTime(double const tick, size_t const sample, size_t const frame) const
     {
       return fOpticalClock.TickPeriod() * tick + fOpticalClock.Time(sample, frame) - TriggerTime();
     }
     /// Given Optical time-tick (waveform index), sample and frame number,
     /// returns time [us] w.r.t. beam gate time stamp
-    double
+    constexpr double
     OpticalTick2BeamTime(double const tick, size_t const sample, size_t const frame) const
     {
       return fOpticalClock.TickPeriod() * tick + fOpticalClock.Time(sample, frame) - BeamGateTime();
     }
     /// Given External time-tick (waveform index), sample and frame number,
     /// returns time [us] w.r.t. trigger time stamp
-    double
+    constexpr double
     ExternalTick2TrigTime(double const tick, size_t const sample, size_t const frame) const
     {
       return fExternalClock.TickPeriod() * tick + fExternalClock.Time(sample, frame) -
@@ -468,7 +475,7 @@ namespace detinfo {
     }
     /// Given External time-tick (waveform index), sample and frame number,
     /// returns time [us] w.r.t. beam gate time stamp
-    double
+    constexpr double
     ExternalTick2BeamTime(double const tick, size_t const sample, size_t const frame) const
     {
       return fExternalClock.TickPeriod() * tick + fExternalClock.Time(sample, frame) -
@@ -476,7 +483,7 @@ namespace detinfo {
     }
 
     /// Returns the specified electronics time in TDC electronics ticks.
-    double
+    constexpr double
     Time2Tick(double const time) const
     {
       return doTime2Tick(time);
@@ -489,42 +496,42 @@ namespace detinfo {
 
     /// Given TPC time-tick (waveform index), returns electronics clock count
     /// [tdc]
-    double
+    constexpr double
     TPCTick2TDC(double const tick) const
     {
       return (doTPCTime() / fTPCClock.TickPeriod() + tick);
     }
     /// Given G4 time [ns], returns corresponding TPC electronics clock count
     /// [tdc]
-    double
+    constexpr double
     TPCG4Time2TDC(double const g4time) const
     {
       return G4ToElecTime(g4time) / fTPCClock.TickPeriod();
     }
     /// Given Optical time-tick (waveform index), sample and frame number,
     /// returns time electronics clock count [tdc]
-    double
+    constexpr double
     OpticalTick2TDC(double const tick, size_t const sample, size_t const frame) const
     {
       return fOpticalClock.Ticks(sample, frame) + tick;
     }
     /// Given G4 time [ns], returns corresponding Optical electronics clock
     /// count [tdc]
-    double
+    constexpr double
     OpticalG4Time2TDC(double const g4time) const
     {
       return G4ToElecTime(g4time) / fOpticalClock.TickPeriod();
     }
     /// Given External time-tick (waveform index), sample and frame number,
     /// returns time electronics clock count [tdc]
-    double
+    constexpr double
     ExternalTick2TDC(double const tick, size_t const sample, size_t const frame) const
     {
       return fExternalClock.Ticks(sample, frame) + tick;
     }
     /// Given G4 time [ns], returns corresponding External electronics clock
     /// count [tdc]
-    double
+    constexpr double
     ExternalG4Time2TDC(double const g4time) const
     {
       return G4ToElecTime(g4time) / fExternalClock.TickPeriod();
@@ -535,21 +542,21 @@ namespace detinfo {
     // precision)
     //
     /// Given TPC time-tick (waveform index), returns electronics clock [us]
-    double
+    constexpr double
     TPCTick2Time(double const tick) const
     {
       return doTPCTime() + tick * fTPCClock.TickPeriod();
     }
     /// Given Optical time-tick (waveform index), sample and frame number,
     /// returns electronics clock [us]
-    double
+    constexpr double
     OpticalTick2Time(double const tick, size_t const sample, size_t const frame) const
     {
       return fOpticalClock.Time(sample, frame) + tick * fOpticalClock.TickPeriod();
     }
     /// Given External time-tick (waveform index), sample and frame number,
     /// returns electronics clock [us]
-    double
+    constexpr double
     ExternalTick2Time(double const tick, size_t const sample, size_t const frame) const
     {
       return fExternalClock.Time(sample, frame) + tick * fExternalClock.TickPeriod();
@@ -560,13 +567,13 @@ namespace detinfo {
     //
 
     /// Given electronics clock count [tdc] returns TPC time-tick
-    double
+    constexpr double
     TPCTDC2Tick(double const tdc) const
     {
       return (tdc - doTPCTime() / fTPCClock.TickPeriod());
     }
     /// Given G4 time returns electronics clock count [tdc]
-    double
+    constexpr double
     TPCG4Time2Tick(double const g4time) const
     {
       return (G4ToElecTime(g4time) - doTPCTime()) / fTPCClock.TickPeriod();
@@ -613,14 +620,14 @@ namespace detinfo {
     ElecClock fExternalClock;
 
     /// Implementation of `TPCTime()`.
-    double
+    constexpr double
     doTPCTime() const
     {
       return fTriggerTime + fTriggerOffsetTPC;
     }
 
     /// Implementation of `Time2Tick()`.
-    double
+    constexpr double
     doTime2Tick(double const time) const
     {
       return (time - doTPCTime()) / fTPCClock.TickPeriod();
@@ -0,0 +1,259 @@
+/**
+ * @file   lardataalg/DetectorInfo/DetectorClocksPresets.h
+ * @brief  Compile-time timing configurations of the standard detectors.
+ * @date   October 17, 2026
+ *
+ * This library is header-only.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_DETECTORCLOCKSPRESETS_H
+#define LARDATAALG_DETECTORINFO_DETECTORCLOCKSPRESETS_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/ClockConstants.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorClocksException.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief Timing configurations known at compile time.
+ *
+ * When the timing configuration of a job is fixed, its
+ * `detinfo::DetectorClocksData` can be a compile-time constant, and the
+ * conversions between ticks and times become constant expressions that the
+ * compiler folds:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * constexpr detinfo::DetectorClocksData clocks
+ *   = detinfo::presets::StandardClocks.data();
+ * constexpr double readoutStart = clocks.TPCTime(); // [us]
+ * constexpr double tick = clocks.Time2Tick(readoutStart + 1.0); // 5.0505
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The same holds for a `detinfo::DetectorTimings` object built on that data.
+ * The actual configuration comes from the timing service or provider, and
+ * it should be checked once against the preset the code was compiled for,
+ * e.g. at the beginning of the job:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * detinfo::presets::checkClocksPreset
+ *   (clocksProvider.DataForJob(), clocks, "standard");
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The comparison includes the trigger and beam gate times, so that the data
+ * of an event whose trigger time differs from the default one does not match
+ * the preset.
+ */
+namespace detinfo::presets {
+
+  /**
+   * @brief Configuration of `detinfo::DetectorClocksStandard`.
+   *
+   * The members mirror the configuration parameters of the provider, with
+   * the same units.
+   */
+  struct ClocksConfiguration {
+    double G4RefTime; ///< Simulation time where electronics time starts [us].
+    double TriggerOffsetTPC; ///< TPC readout start from the trigger [us].
+    double FramePeriod; ///< Frame period of TPC, optical and trigger clocks [us].
+    double ClockSpeedTPC; ///< TPC clock frequency [MHz].
+    double ClockSpeedOptical; ///< Optical clock frequency [MHz].
+    double ClockSpeedTrigger; ///< Trigger clock frequency [MHz].
+    double DefaultTrigTime; ///< Trigger time [us].
+    double DefaultBeamTime; ///< Beam gate opening time [us].
+
+    /// Returns the timing data `detinfo::DetectorClocksStandard` would provide.
+    constexpr DetectorClocksData data() const
+      {
+        return DetectorClocksData{
+          G4RefTime,
+          TriggerOffsetTPC,
+          DefaultTrigTime,
+          DefaultBeamTime,
+          ElecClock{DefaultTrigTime, FramePeriod, ClockSpeedTPC},
+          ElecClock{DefaultTrigTime, FramePeriod, ClockSpeedOptical},
+          ElecClock{DefaultTrigTime, FramePeriod, ClockSpeedTrigger},
+          ElecClock{0, kDEFAULT_FRAME_PERIOD, kDEFAULT_FREQUENCY_EXTERNAL}};
+      }
+
+  }; // ClocksConfiguration
+
+
+  // --- BEGIN -- Presets ------------------------------------------------------
+  /// @name Presets
+  /// @{
+
+  /// Configuration `standard_detectorclocks` (also `csu40L_detectorclocks`).
+  inline constexpr ClocksConfiguration StandardClocks{
+    0.0,     // G4RefTime
+    0.0,     // TriggerOffsetTPC
+    405.504, // FramePeriod
+    5.0505,  // ClockSpeedTPC
+    64.0,    // ClockSpeedOptical
+    16.0,    // ClockSpeedTrigger
+    0.0,     // DefaultTrigTime
+    0.0      // DefaultBeamTime
+  };
+
+  /// Configuration `bo_detectorclocks`.
+  inline constexpr ClocksConfiguration BoClocks{
+    0.0,      // G4RefTime
+    -40.0,    // TriggerOffsetTPC
+    1619.968, // FramePeriod
+    2.528445, // ClockSpeedTPC
+    64.0,     // ClockSpeedOptical
+    16.0,     // ClockSpeedTrigger
+    40.0,     // DefaultTrigTime
+    40.0      // DefaultBeamTime
+  };
+
+  /// Configuration `lartpcdetector_detectorclocks`.
+  inline constexpr ClocksConfiguration LArTPCdetectorClocks{
+    -3200.0, // G4RefTime
+    -1600.0, // TriggerOffsetTPC
+    1600.0,  // FramePeriod
+    2.0,     // ClockSpeedTPC
+    64.0,    // ClockSpeedOptical
+    16.0,    // ClockSpeedTrigger
+    3200.0,  // DefaultTrigTime
+    3200.0   // DefaultBeamTime
+  };
+
+  /// @}
+  // --- END -- Presets --------------------------------------------------------
+
+
+  /**
+   * @brief Returns a description of each difference between two timings.
+   * @param actual the timing data in use
+   * @param preset the expected timing data
+   * @param tolerance largest difference of times [us] and frequencies [MHz]
+   * @return one line per parameter which differs, empty if none does
+   */
+  inline std::vector<std::string> clocksMismatches(
+    DetectorClocksData const& actual, DetectorClocksData const& preset,
+    double tolerance = 1e-6
+    );
+
+  /// Returns whether two timings are the same within `tolerance`.
+  constexpr bool sameClocks(
+    DetectorClocksData const& actual, DetectorClocksData const& preset,
+    double tolerance = 1e-6
+    );
+
+  /**
+   * @brief Checks that the timing in use matches a preset.
+   * @param actual the timing data in use
+   * @param preset the timing data the code relies on
+   * @param presetName name of the preset, for the error message
+   * @param tolerance largest difference of times [us] and frequencies [MHz]
+   * @throw detinfo::DetectorClocksException listing all the differences
+   */
+  inline void checkClocksPreset(
+    DetectorClocksData const& actual, DetectorClocksData const& preset,
+    std::string const& presetName, double tolerance = 1e-6
+    );
+
+} // namespace detinfo::presets
+
+
+//------------------------------------------------------------------------------
+//--- implementation
+//------------------------------------------------------------------------------
+namespace detinfo::presets::details {
+
+  constexpr bool closeEnough(double a, double b, double tolerance)
+    { return ((a > b)? a - b: b - a) <= tolerance; }
+
+  constexpr bool sameClock
+    (ElecClock const& a, ElecClock const& b, double tolerance)
+  {
+    return closeEnough(a.Time(), b.Time(), tolerance)
+      && closeEnough(a.FramePeriod(), b.FramePeriod(), tolerance)
+      && closeEnough(a.Frequency(), b.Frequency(), tolerance);
+  } // sameClock()
+
+} // namespace detinfo::presets::details
+
+
+//------------------------------------------------------------------------------
+std::vector<std::string> detinfo::presets::clocksMismatches(
+  DetectorClocksData const& actual, DetectorClocksData const& preset,
+  double tolerance /* = 1e-6 */
+) {
+  std::vector<std::string> mismatches;
+  auto const compare = [&mismatches, tolerance]
+    (char const* name, double actualValue, double presetValue)
+    {
+      if (details::closeEnough(actualValue, presetValue, tolerance)) return;
+      std::ostringstream sstr;
+      sstr << name << ": " << actualValue << " (expected " << presetValue << ")";
+      mismatches.push_back(sstr.str());
+    };
+  auto const compareClock = [&compare]
+    (char const* name, ElecClock const& actualClock, ElecClock const& presetClock)
+    {
+      compare((name + std::string{" clock time"}).c_str(),
+        actualClock.Time(), presetClock.Time());
+      compare((name + std::string{" clock frame period"}).c_str(),
+        actualClock.FramePeriod(), presetClock.FramePeriod());
+      compare((name + std::string{" clock frequency"}).c_str(),
+        actualClock.Frequency(), presetClock.Frequency());
+    };
+
+  compare("G4 reference time", actual.G4RefTime(), preset.G4RefTime());
+  compare("TPC trigger offset",
+    actual.TriggerOffsetTPC(), preset.TriggerOffsetTPC());
+  compare("trigger time", actual.TriggerTime(), preset.TriggerTime());
+  compare("beam gate time", actual.BeamGateTime(), preset.BeamGateTime());
+  compareClock("TPC", actual.TPCClock(), preset.TPCClock());
+  compareClock("optical", actual.OpticalClock(), preset.OpticalClock());
+  compareClock("trigger", actual.TriggerClock(), preset.TriggerClock());
+  compareClock("external", actual.ExternalClock(), preset.ExternalClock());
+
+  return mismatches;
+} // detinfo::presets::clocksMismatches()
+
+
+//------------------------------------------------------------------------------
+constexpr bool detinfo::presets::sameClocks(
+  DetectorClocksData const& actual, DetectorClocksData const& preset,
+  double tolerance /* = 1e-6 */
+) {
+  return details::closeEnough(actual.G4RefTime(), preset.G4RefTime(), tolerance)
+    && details::closeEnough
+      (actual.TriggerOffsetTPC(), preset.TriggerOffsetTPC(), tolerance)
+    && details::closeEnough(actual.TriggerTime(), preset.TriggerTime(), tolerance)
+    && details::closeEnough
+      (actual.BeamGateTime(), preset.BeamGateTime(), tolerance)
+    && details::sameClock(actual.TPCClock(), preset.TPCClock(), tolerance)
+    && details::sameClock(actual.OpticalClock(), preset.OpticalClock(), tolerance)
+    && details::sameClock(actual.TriggerClock(), preset.TriggerClock(), tolerance)
+    && details::sameClock
+      (actual.ExternalClock(), preset.ExternalClock(), tolerance)
+    ;
+} // detinfo::presets::sameClocks()
+
+
+//------------------------------------------------------------------------------
+void detinfo::presets::checkClocksPreset(
+  DetectorClocksData const& actual, DetectorClocksData const& preset,
+  std::string const& presetName, double tolerance /* = 1e-6 */
+) {
+  std::vector<std::string> const mismatches
+    = clocksMismatches(actual, preset, tolerance);
+  if (mismatches.empty()) return;
+
+  std::string msg = "Detector timing does not match the preset '" + presetName
+    + "' (" + std::to_string(mismatches.size()) + " differences):";
+  for (std::string const& mismatch: mismatches) msg += "\n  " + mismatch;
+  throw DetectorClocksException(msg);
+} // detinfo::presets::checkClocksPreset()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_DETECTORINFO_DETECTORCLOCKSPRESETS_H
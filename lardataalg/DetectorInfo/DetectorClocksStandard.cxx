@@ -1,10 +1,28 @@
 #include "lardataalg/DetectorInfo/DetectorClocksStandard.h"
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
 #include "fhiclcpp/ParameterSet.h"
 
 #include "larcorealg/CoreUtils/zip.h"
 
 #include <iostream>
 
+namespace {
+
+  std::vector<double>
+  readConfigValues(detinfo::BlobReader& in, std::size_t const nValues)
+  {
+    auto values = in.read<std::vector<double>>();
+    if (values.size() != nValues) {
+      throw cet::exception("BinaryBlob")
+        << "DetectorClocksStandard: saved state has " << values.size()
+        << " configuration values, " << nValues << " expected\n";
+    }
+    return values;
+  }
+
+} // local namespace
+
 //-------------------------------------------------------------------------
 detinfo::DetectorClocksStandard::DetectorClocksStandard(fhicl::ParameterSet const& pset)
   : fConfigName{"G4RefTime",
@@ -36,6 +54,36 @@ detinfo::DetectorClocksStandard::DetectorClocksStandard(fhicl::ParameterSet cons
   SetTriggerTime(fConfigValue[detinfo::kDefaultTrigTime], fConfigValue[detinfo::kDefaultBeamTime]);
 }
 
+detinfo::DetectorClocksStandard::DetectorClocksStandard(BlobReader& in)
+  : fConfigName{"G4RefTime",
+                "TriggerOffsetTPC",
+                "FramePeriod",
+                "ClockSpeedTPC",
+                "ClockSpeedOptical",
+                "ClockSpeedTrigger",
+                "ClockSpeedExternal",
+                "DefaultTrigTime",
+                "DefaultBeamTime"}
+  , fConfigValue{readConfigValues(in, fConfigName.size())}
+  , fTrigModuleName{in.read<std::string>()}
+  , fG4RefCorrTrigModuleName{in.read<std::string>()}
+  , fTriggerOffsetTPC{fConfigValue[kTriggerOffsetTPC]}
+  , fTriggerTime{fConfigValue[detinfo::kDefaultTrigTime]}
+  , fBeamGateTime{fConfigValue[detinfo::kDefaultBeamTime]}
+  , fFramePeriod{fConfigValue[kFramePeriod]}
+  , fTPCClock{fTriggerTime, fFramePeriod, fConfigValue[kClockSpeedTPC]}
+{
+  SetTriggerTime(fConfigValue[detinfo::kDefaultTrigTime], fConfigValue[detinfo::kDefaultBeamTime]);
+}
+
+void
+detinfo::DetectorClocksStandard::SaveState(BlobWriter& out) const
+{
+  out.write(fConfigValue);
+  out.write(fTrigModuleName);
+  out.write(fG4RefCorrTrigModuleName);
+}
+
 void
 detinfo::DetectorClocksStandard::ApplyParams()
 {
@@ -64,6 +112,9 @@ detinfo::DetectorClocksStandard::debugReport() const
   std::cout << std::endl;
 
   DataForJob().debugReport(std::cout);
+
+  std::cout << "\nDetectorClocksStandard instrumentation:\n";
+  detinfo::instrumentation::report(std::cout, "DetectorClocks", "  ");
   std::cout.flush();
 
 } // detinfo::DetectorClocksStandard::debugReport()
@@ -21,9 +21,13 @@
 #include "lardataalg/DetectorInfo/DetectorClocks.h"
 #include "lardataalg/DetectorInfo/DetectorClocksStandardTriggerLoader.h"
 #include "lardataalg/DetectorInfo/ElecClock.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
 
 namespace detinfo {
 
+  class BlobWriter;
+  class BlobReader;
+
   /**
    * @brief Implementation of `detinfo::DetectorClocks` interface with fixed
    *        settings from configuration.
@@ -124,6 +128,20 @@ namespace detinfo {
     DetectorClocksStandard(fhicl::ParameterSet const& pset);
     DetectorClocksStandard(DetectorClocksStandard const&) = delete;
 
+    /**
+     * @brief Constructor: restores the state written by `SaveState()`.
+     * @param in reader positioned at the beginning of the saved state
+     * @throw cet::exception (category: `"BinaryBlob"`) on missing data
+     *
+     * The provider is set up as the one which saved its state, including the
+     * configuration values possibly changed via `SetConfigValue()` and
+     * applied by `ApplyParams()`.
+     */
+    explicit DetectorClocksStandard(BlobReader& in);
+
+    /// Appends the configured state of the provider to `out`.
+    void SaveState(BlobWriter& out) const;
+
     void
     SetConfigValue(size_t i, double val)
     {
@@ -170,6 +188,7 @@ namespace detinfo {
     DetectorClocksData
     DataForJob() const override
     {
+      LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorClocksStandard::DataForJob");
       return DetectorClocksData{
         fConfigValue[kG4RefTime], // FIXME: Should be run-dependent?
         fTriggerOffsetTPC,
@@ -186,6 +205,7 @@ namespace detinfo {
             double const trigger_time,
             double const beam_time) const override
     {
+      LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorClocksStandard::DataFor");
       return DetectorClocksData{
         g4_ref_time,
         fTriggerOffsetTPC,
@@ -204,7 +224,8 @@ namespace detinfo {
     /// data file
     bool IsRightConfig(const fhicl::ParameterSet& ps) const;
 
-    /// Dumps the current configuration to screen.
+    /// Dumps the current configuration to screen, and the call statistics of
+    /// the instrumented functions (see `ProviderInstrumentation.h`).
     void debugReport() const;
 
   private:
@@ -45,6 +45,18 @@ namespace detinfo {
      */
     virtual double Efield(unsigned int planegap = 0) const = 0;
 
+    /**
+     * @brief Returns the number of plane gaps with a defined electric field.
+     *
+     * `Efield()` is valid for `planegap` from `0` to this number excluded.
+     * The default implementation reports only the main drift volume.
+     */
+    virtual unsigned int
+    NPlaneGaps() const
+    {
+      return 1U;
+    }
+
     virtual double DriftVelocity(double efield = 0., double temperature = 0.) const = 0;
 
     /// dQ/dX in electrons/cm, returns dE/dX in MeV/cm.
@@ -13,6 +13,20 @@ detinfo::DetectorPropertiesData::DetectorPropertiesData(
   , fDriftDirection{move(drift_direction)}
 {}
 
+detinfo::DetectorPropertiesData::DetectorPropertiesData(
+  DetectorProperties const& properties,
+  double const x_ticks_coefficient,
+  std::vector<std::vector<std::vector<double>>>&& x_ticks_offsets,
+  std::vector<std::vector<double>>&& drift_direction,
+  DriftParameterTable_t&& drift_parameters)
+
+  : fProperties{properties}
+  , fXTicksCoefficient{x_ticks_coefficient}
+  , fXTicksOffsets{move(x_ticks_offsets)}
+  , fDriftDirection{move(drift_direction)}
+  , fDriftParameters{move(drift_parameters)}
+{}
+
 double
 detinfo::DetectorPropertiesData::Efield(unsigned int const planegap) const
 {
@@ -173,3 +187,27 @@ detinfo::DetectorPropertiesData::SimpleBoundary() const
 {
   return fProperties.SimpleBoundary();
 }
+
+bool
+detinfo::DetectorPropertiesData::HasDriftParameters() const
+{
+  return !fDriftParameters.empty();
+}
+
+detinfo::TPCDriftParameters_t const&
+detinfo::DetectorPropertiesData::DriftParameters(int const t, int const c) const
+{
+  return fDriftParameters.at(c).at(t);
+}
+
+detinfo::TPCDriftParameters_t const&
+detinfo::DetectorPropertiesData::DriftParameters(geo::TPCID const& tpcid) const
+{
+  return DriftParameters(tpcid.TPC, tpcid.Cryostat);
+}
+
+detinfo::DriftParameterTable_t const&
+detinfo::DetectorPropertiesData::DriftParameterTable() const
+{
+  return fDriftParameters;
+}
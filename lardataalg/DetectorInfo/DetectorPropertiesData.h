@@ -8,6 +8,28 @@
 namespace detinfo {
   class DetectorProperties;
 
+  /**
+   * @brief Drift parameters of a single TPC.
+   *
+   * Plane gaps are numbered as in `DetectorProperties::Efield()`: gap `0` is
+   * the main drift volume, gap `1` is between the first and the second plane,
+   * and so on.
+   */
+  struct TPCDriftParameters_t {
+    double driftDirection = 0.;    ///< Sign of x in tick conversions (+1 or -1).
+    double firstPlaneX = 0.;       ///< x coordinate of the first plane [cm]
+    double xTicksCoefficient = 0.; ///< Drift distance per tick in the main volume [cm]
+    std::vector<double> gapDriftVelocities;    ///< Drift velocity in each plane gap [cm/us]
+    std::vector<double> gapXTicksCoefficients; ///< Drift distance per tick in each gap [cm]
+    std::vector<double> planePitches; ///< Distance of each plane from the next one [cm]
+
+    /// Number of wire planes in the TPC.
+    unsigned int NPlanes() const { return planePitches.size() + 1U; }
+  };
+
+  /// Drift parameters of all TPCs, by cryostat and TPC number.
+  using DriftParameterTable_t = std::vector<std::vector<TPCDriftParameters_t>>;
+
   class DetectorPropertiesData {
   public:
     explicit DetectorPropertiesData(DetectorProperties const& properties,
@@ -15,6 +37,13 @@ namespace detinfo {
                                     std::vector<std::vector<std::vector<double>>>&& x_ticks_offsets,
                                     std::vector<std::vector<double>>&& drift_direction);
 
+    /// Constructor: also stores the per-TPC drift parameters.
+    explicit DetectorPropertiesData(DetectorProperties const& properties,
+                                    double x_ticks_coefficient,
+                                    std::vector<std::vector<std::vector<double>>>&& x_ticks_offsets,
+                                    std::vector<std::vector<double>>&& drift_direction,
+                                    DriftParameterTable_t&& drift_parameters);
+
     double Efield(unsigned int planegap = 0) const; ///< kV/cm
 
     double DriftVelocity(double efield = 0.,
@@ -92,11 +121,23 @@ namespace detinfo {
 
     bool SimpleBoundary() const;
 
+    /// Returns whether per-TPC drift parameters are available.
+    bool HasDriftParameters() const;
+
+    /// Returns the drift parameters of the specified TPC.
+    /// @throw std::out_of_range if the TPC is not in the table
+    TPCDriftParameters_t const& DriftParameters(int t, int c) const;
+    TPCDriftParameters_t const& DriftParameters(geo::TPCID const& tpcid) const;
+
+    /// Returns the drift parameters of all TPCs.
+    DriftParameterTable_t const& DriftParameterTable() const;
+
   private:
     detinfo::DetectorProperties const& fProperties;
     double const fXTicksCoefficient;
     std::vector<std::vector<std::vector<double>>> const fXTicksOffsets;
     std::vector<std::vector<double>> const fDriftDirection;
+    DriftParameterTable_t const fDriftParameters;
   }; // class DetectorPropertiesStandard
 } // namespace detinfo
 
@@ -0,0 +1,77 @@
+/**
+ * @file   lardataalg/DetectorInfo/DetectorPropertiesSnapshot.cxx
+ * @brief  Copy of the scalar detector and argon properties, without virtual
+ *         calls.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/DetectorPropertiesSnapshot.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/DetectorPropertiesSnapshot.h"
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/LArProperties.h"
+
+
+//------------------------------------------------------------------------------
+detinfo::DetectorPropertiesSnapshot::DetectorPropertiesSnapshot
+  (DetectorProperties const& detProp, LArProperties const& larProp)
+  : fRecomb(detProp.Density(), detProp.Efield())
+  , fDriftVelocity(detProp.DriftVelocity(detProp.Efield(), detProp.Temperature()))
+  , fInvLifetime(1.0 / detProp.ElectronLifetime())
+  , fElectronsToADC(detProp.ElectronsToADC())
+  , fTemperature(detProp.Temperature())
+  , fTimeOffsetU(detProp.TimeOffsetU())
+  , fTimeOffsetV(detProp.TimeOffsetV())
+  , fTimeOffsetZ(detProp.TimeOffsetZ())
+  , fRadiationLength(larProp.RadiationLength())
+  , fAtomicNumber(larProp.AtomicNumber())
+  , fAtomicMass(larProp.AtomicMass())
+  , fExcitationEnergy(larProp.ExcitationEnergy())
+  , fArgon39DecayRate(larProp.Argon39DecayRate())
+  , fScintResolutionScale(larProp.ScintResolutionScale())
+  , fScintFastTimeConst(larProp.ScintFastTimeConst())
+  , fScintSlowTimeConst(larProp.ScintSlowTimeConst())
+  , fScintBirksConstant(larProp.ScintBirksConstant())
+  , fScintPreScale{ larProp.ScintPreScale(false), larProp.ScintPreScale(true) }
+  , fScintYield{ { larProp.ScintYield(false), larProp.ScintYield(true) },
+      larProp.ScintYieldRatio() }
+  , fProtonScintYield
+    { { larProp.ProtonScintYield(false), larProp.ProtonScintYield(true) },
+      larProp.ProtonScintYieldRatio() }
+  , fMuonScintYield
+    { { larProp.MuonScintYield(false), larProp.MuonScintYield(true) },
+      larProp.MuonScintYieldRatio() }
+  , fKaonScintYield
+    { { larProp.KaonScintYield(false), larProp.KaonScintYield(true) },
+      larProp.KaonScintYieldRatio() }
+  , fPionScintYield
+    { { larProp.PionScintYield(false), larProp.PionScintYield(true) },
+      larProp.PionScintYieldRatio() }
+  , fElectronScintYield
+    { { larProp.ElectronScintYield(false), larProp.ElectronScintYield(true) },
+      larProp.ElectronScintYieldRatio() }
+  , fAlphaScintYield
+    { { larProp.AlphaScintYield(false), larProp.AlphaScintYield(true) },
+      larProp.AlphaScintYieldRatio() }
+  , fTpbTimeConstant(larProp.TpbTimeConstant())
+  , fNumberTimeSamples(detProp.NumberTimeSamples())
+  , fReadOutWindowSize(detProp.ReadOutWindowSize())
+  , fSimpleBoundary(detProp.SimpleBoundary())
+  , fScintByParticleType(larProp.ScintByParticleType())
+  , fCerenkovLightEnabled(larProp.CerenkovLightEnabled())
+  , fExtraMatProperties(larProp.ExtraMatProperties())
+{
+  unsigned int const nGaps = detProp.NPlaneGaps();
+  fEfield.reserve(nGaps);
+  fDriftVelocityGap.reserve(nGaps);
+  for (unsigned int gap = 0; gap < nGaps; ++gap) {
+    fEfield.push_back(detProp.Efield(gap));
+    fDriftVelocityGap.push_back(detProp.DriftVelocity(fEfield.back(), fTemperature));
+  } // for gaps
+
+} // detinfo::DetectorPropertiesSnapshot::DetectorPropertiesSnapshot()
+
+
+//------------------------------------------------------------------------------
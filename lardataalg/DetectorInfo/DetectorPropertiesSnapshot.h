@@ -0,0 +1,290 @@
+/**
+ * @file   lardataalg/DetectorInfo/DetectorPropertiesSnapshot.h
+ * @brief  Copy of the scalar detector and argon properties, without virtual
+ *         calls.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/DetectorPropertiesSnapshot.cxx
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_DETECTORPROPERTIESSNAPSHOT_H
+#define LARDATAALG_DETECTORINFO_DETECTORPROPERTIESSNAPSHOT_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/RecombinationCorrection.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cmath> // std::exp()
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <vector>
+
+
+namespace detinfo {
+
+  class DetectorProperties;
+  class LArProperties;
+
+  /**
+   * @brief Value copy of the scalar properties of detector and liquid argon.
+   *
+   * The interfaces `detinfo::DetectorProperties` and `detinfo::LArProperties`
+   * are made of virtual functions, which prevent the compiler from inlining
+   * and vectorizing the physics code using them.
+   * This object copies all their scalar values and some derived quantities
+   * at construction, and exposes them via non-virtual inline functions.
+   * It can be built from any implementation of those interfaces.
+   *
+   * The accessors of the two interfaces returning a single number or flag
+   * are reproduced with the same names and arguments, except for the drift
+   * velocity, which is provided per plane gap by `GapDriftVelocity()`.
+   * The tabulated optical properties of
+   * `LArProperties` (the scintillation, refractive index, absorption,
+   * Rayleigh and TPB spectra and the surface reflectances) are not copied:
+   * they are not used in per-hit loops, and they are still available from the
+   * provider.
+   *
+   * The quantities most used in per-hit loops (density, nominal field and drift
+   * velocity, recombination and lifetime constants, ADC conversion) are packed
+   * at the beginning of the object, which is aligned to a cache line, so that
+   * they share the same cache line.
+   *
+   * Unlike the original interfaces, functions of temperature or arbitrary
+   * electric field are not available: the values are those at the configured
+   * temperature and for the configured field of each plane gap (as many as
+   * `DetectorProperties::NPlaneGaps()` reports). For this reason there is no
+   * `DriftVelocity()`: a call copied from code using the provider, like
+   * `DriftVelocity(efield, temperature)`, does not compile instead of silently
+   * ignoring its arguments.
+   * The snapshot does not follow changes in the providers it was created from.
+   */
+  class alignas(64) DetectorPropertiesSnapshot final {
+      public:
+
+    /**
+     * @brief Copies the current values from the specified providers.
+     * @param detProp detector properties provider
+     * @param larProp liquid argon properties provider
+     */
+    DetectorPropertiesSnapshot
+      (DetectorProperties const& detProp, LArProperties const& larProp);
+
+
+    // --- BEGIN -- Drift and readout ------------------------------------------
+    /// @name Drift and readout
+    /// @{
+
+    /**
+     * @brief Returns the electric field in the specified plane gap [kV/cm].
+     * @throw std::out_of_range if `planegap` is not less than `NPlaneGaps()`
+     * @see `DetectorProperties::Efield()`
+     */
+    double Efield(unsigned int planegap = 0) const
+      { return fEfield[checkedGap(planegap)]; }
+
+    /// Returns the number of plane gaps with a known electric field.
+    unsigned int NPlaneGaps() const { return fEfield.size(); }
+
+    /**
+     * @brief Returns drift velocity in the field of the plane gap [cm/&micro;s].
+     * @throw std::out_of_range if `planegap` is not less than `NPlaneGaps()`
+     *
+     * This is `DetectorProperties::DriftVelocity()` evaluated with the field
+     * `Efield(planegap)` and the temperature `Temperature()`.
+     */
+    double GapDriftVelocity(unsigned int planegap = 0) const
+      {
+        return (planegap == 0)
+          ? fDriftVelocity: fDriftVelocityGap[checkedGap(planegap)];
+      }
+
+    /// Electron lifetime [&micro;s].
+    double ElectronLifetime() const { return 1.0 / fInvLifetime; }
+
+    /// Returns the charge fraction surviving a drift of `driftTime` [&micro;s].
+    double Attenuation(double driftTime) const
+      { return std::exp(-driftTime * fInvLifetime); }
+
+    /// Returns the conversion factor from ionization electrons to ADC counts.
+    double ElectronsToADC() const { return fElectronsToADC; }
+
+    /// Returns the number of ADC counts from `electrons` ionization electrons.
+    double ADC(double electrons) const { return electrons * fElectronsToADC; }
+
+    /// Number of clock ticks per event.
+    unsigned int NumberTimeSamples() const { return fNumberTimeSamples; }
+
+    /// Number of clock ticks per readout window.
+    unsigned int ReadOutWindowSize() const { return fReadOutWindowSize; }
+
+    double TimeOffsetU() const { return fTimeOffsetU; }
+    double TimeOffsetV() const { return fTimeOffsetV; }
+    double TimeOffsetZ() const { return fTimeOffsetZ; }
+
+    /// Optical boundary simulation model flag.
+    bool SimpleBoundary() const { return fSimpleBoundary; }
+
+    /// @}
+    // --- END -- Drift and readout --------------------------------------------
+
+
+    // --- BEGIN -- Liquid argon -----------------------------------------------
+    /// @name Liquid argon
+    /// @{
+
+    /// Argon temperature [K].
+    double Temperature() const { return fTemperature; }
+
+    /// Argon density at `Temperature()` [g/cm^3].
+    double Density() const { return fRecomb.Density(); }
+
+    /// Radiation length [g/cm^2].
+    double RadiationLength() const { return fRadiationLength; }
+
+    /// Atomic number of the liquid.
+    double AtomicNumber() const { return fAtomicNumber; }
+
+    /// Atomic mass of the liquid [g/mol].
+    double AtomicMass() const { return fAtomicMass; }
+
+    /// Mean excitation energy of the liquid [eV].
+    double ExcitationEnergy() const { return fExcitationEnergy; }
+
+    /// Argon 39 decay rate [decays/(cm^3 s)].
+    double Argon39DecayRate() const { return fArgon39DecayRate; }
+
+    /// @}
+    // --- END -- Liquid argon -------------------------------------------------
+
+
+    // --- BEGIN -- Scintillation ----------------------------------------------
+    /// @name Scintillation
+    /// @{
+
+    double ScintResolutionScale() const { return fScintResolutionScale; }
+    double ScintFastTimeConst() const { return fScintFastTimeConst; } ///< [ns]
+    double ScintSlowTimeConst() const { return fScintSlowTimeConst; } ///< [ns]
+    double ScintBirksConstant() const { return fScintBirksConstant; } ///< [cm/MeV]
+    bool ScintByParticleType() const { return fScintByParticleType; }
+
+    /// Scintillation yield [photons/MeV], with the prescale if `prescale`.
+    double ScintYield(bool prescale = false) const
+      { return fScintYield.yield[prescale]; }
+    /// Scintillation prescale factor (`1` if not `prescale`).
+    double ScintPreScale(bool prescale = true) const
+      { return fScintPreScale[prescale]; }
+    double ScintYieldRatio() const { return fScintYield.ratio; }
+
+    double ProtonScintYield(bool prescale = false) const
+      { return fProtonScintYield.yield[prescale]; }
+    double ProtonScintYieldRatio() const { return fProtonScintYield.ratio; }
+    double MuonScintYield(bool prescale = false) const
+      { return fMuonScintYield.yield[prescale]; }
+    double MuonScintYieldRatio() const { return fMuonScintYield.ratio; }
+    double KaonScintYield(bool prescale = false) const
+      { return fKaonScintYield.yield[prescale]; }
+    double KaonScintYieldRatio() const { return fKaonScintYield.ratio; }
+    double PionScintYield(bool prescale = false) const
+      { return fPionScintYield.yield[prescale]; }
+    double PionScintYieldRatio() const { return fPionScintYield.ratio; }
+    double ElectronScintYield(bool prescale = false) const
+      { return fElectronScintYield.yield[prescale]; }
+    double ElectronScintYieldRatio() const { return fElectronScintYield.ratio; }
+    double AlphaScintYield(bool prescale = false) const
+      { return fAlphaScintYield.yield[prescale]; }
+    double AlphaScintYieldRatio() const { return fAlphaScintYield.ratio; }
+
+    bool CerenkovLightEnabled() const { return fCerenkovLightEnabled; }
+
+    /// Whether TPB properties are simulated.
+    bool ExtraMatProperties() const { return fExtraMatProperties; }
+    double TpbTimeConstant() const { return fTpbTimeConstant; } ///< [ns]
+
+    /// @}
+    // --- END -- Scintillation ------------------------------------------------
+
+
+    // --- BEGIN -- Calorimetry ------------------------------------------------
+    /// @name Calorimetry
+    /// @{
+
+    /// dQ/dX in electrons/cm, returns dE/dX in MeV/cm.
+    double BirksCorrection(double dQdX) const { return fRecomb.Birks(dQdX); }
+    double BirksCorrection(double dQdX, double EField) const
+      { return fRecomb.Birks(dQdX, EField); }
+    double ModBoxCorrection(double dQdX) const { return fRecomb.ModBox(dQdX); }
+    double ModBoxCorrection(double dQdX, double EField) const
+      { return fRecomb.ModBox(dQdX, EField); }
+
+    /// Returns the recombination correction object for batch processing.
+    RecombinationCorrection const& Recombination() const { return fRecomb; }
+
+    /// @}
+    // --- END -- Calorimetry --------------------------------------------------
+
+
+      private:
+
+    /// Scintillation yield without and with prescale, and fast/slow ratio.
+    struct ScintYield_t {
+      std::array<double, 2U> yield; ///< Indexed by whether prescaled.
+      double ratio;
+    }; // ScintYield_t
+
+    // --- BEGIN -- first cache line: per-hit quantities -----------------------
+    RecombinationCorrection fRecomb; ///< Density, nominal field and constants.
+    double fDriftVelocity; ///< Drift velocity in the nominal field [cm/us].
+    double fInvLifetime; ///< Inverse of the electron lifetime [1/us].
+    double fElectronsToADC; ///< Conversion factor from electrons to ADC.
+    // --- END -- first cache line ---------------------------------------------
+
+    std::vector<double> fEfield; ///< Field per gap [kV/cm].
+    std::vector<double> fDriftVelocityGap; ///< Drift velocity per gap [cm/us].
+    double fTemperature; ///< Argon temperature [K].
+    double fTimeOffsetU; ///< Time offset for view U [ticks].
+    double fTimeOffsetV; ///< Time offset for view V [ticks].
+    double fTimeOffsetZ; ///< Time offset for view Z [ticks].
+    double fRadiationLength; ///< Radiation length [g/cm^2].
+    double fAtomicNumber; ///< Atomic number.
+    double fAtomicMass; ///< Atomic mass [g/mol].
+    double fExcitationEnergy; ///< Mean excitation energy [eV].
+    double fArgon39DecayRate; ///< Argon 39 decay rate [decays/(cm^3 s)].
+    double fScintResolutionScale; ///< Scintillation resolution scale.
+    double fScintFastTimeConst; ///< Fast scintillation time constant [ns].
+    double fScintSlowTimeConst; ///< Slow scintillation time constant [ns].
+    double fScintBirksConstant; ///< Scintillation Birks constant [cm/MeV].
+    std::array<double, 2U> fScintPreScale; ///< Indexed by `prescale`.
+    ScintYield_t fScintYield; ///< Scintillation yield [photons/MeV].
+    ScintYield_t fProtonScintYield; ///< Yield for protons [photons/MeV].
+    ScintYield_t fMuonScintYield; ///< Yield for muons [photons/MeV].
+    ScintYield_t fKaonScintYield; ///< Yield for kaons [photons/MeV].
+    ScintYield_t fPionScintYield; ///< Yield for pions [photons/MeV].
+    ScintYield_t fElectronScintYield; ///< Yield for electrons [photons/MeV].
+    ScintYield_t fAlphaScintYield; ///< Yield for alphas [photons/MeV].
+    double fTpbTimeConstant; ///< TPB emission time constant [ns].
+    unsigned int fNumberTimeSamples; ///< Clock ticks per event.
+    unsigned int fReadOutWindowSize; ///< Clock ticks per readout window.
+    bool fSimpleBoundary; ///< Optical boundary simulation model flag.
+    bool fScintByParticleType; ///< Whether yields depend on the particle.
+    bool fCerenkovLightEnabled; ///< Whether Cerenkov light is simulated.
+    bool fExtraMatProperties; ///< Whether TPB properties are simulated.
+
+    /// Returns `planegap` if there is such a gap.
+    /// @throw std::out_of_range if there is not
+    unsigned int checkedGap(unsigned int planegap) const
+      {
+        if (planegap < fEfield.size()) return planegap;
+        throw std::out_of_range("DetectorPropertiesSnapshot: plane gap "
+          + std::to_string(planegap) + " not defined ("
+          + std::to_string(fEfield.size()) + " gaps)");
+      }
+
+  }; // class DetectorPropertiesSnapshot
+
+  static_assert(sizeof(RecombinationCorrection) + 3 * sizeof(double) <= 64U,
+    "Per-hit quantities of DetectorPropertiesSnapshot exceed a cache line");
+
+} // namespace detinfo
+
+
+#endif // LARDATAALG_DETECTORINFO_DETECTORPROPERTIESSNAPSHOT_H
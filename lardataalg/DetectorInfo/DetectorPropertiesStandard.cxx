@@ -8,21 +8,70 @@
 
 // LArSoft includes
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
 #include "larcorealg/CoreUtils/ProviderUtil.h" // lar::IgnorableProviderConfigKeys()
-#include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/GeometryCore.h"
-#include "larcorealg/Geometry/PlaneGeo.h"
-#include "larcorealg/Geometry/TPCGeo.h"
-#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+#include "lardataalg/DetectorInfo/RecombinationCorrection.h"
 
-#include "cetlib/pow.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
 // Art includes
 #include "fhiclcpp/types/Table.h"
 
 // C/C++ libraries
+#include <cstdint> // std::uint64_t
+#include <iostream> // std::cout
+#include <optional>
 #include <sstream> // std::ostringstream
+#include <utility> // std::move()
+
+namespace {
+
+  /// Appends the drift parameters of all TPCs to `out`.
+  void writeDriftParameters(detinfo::BlobWriter& out,
+                            detinfo::DriftParameterTable_t const& table)
+  {
+    out.write(static_cast<std::uint64_t>(table.size()));
+    for (auto const& cryostat : table) {
+      out.write(static_cast<std::uint64_t>(cryostat.size()));
+      for (detinfo::TPCDriftParameters_t const& params : cryostat) {
+        out.write(params.driftDirection);
+        out.write(params.firstPlaneX);
+        out.write(params.xTicksCoefficient);
+        out.write(params.gapDriftVelocities);
+        out.write(params.gapXTicksCoefficients);
+        out.write(params.planePitches);
+      }
+    }
+  }
+
+  /// Reads the drift parameters of all TPCs written by `writeDriftParameters()`.
+  detinfo::DriftParameterTable_t readDriftParameters(detinfo::BlobReader& in)
+  {
+    detinfo::DriftParameterTable_t table(in.read<std::uint64_t>());
+    for (auto& cryostat : table) {
+      cryostat.resize(in.read<std::uint64_t>());
+      for (detinfo::TPCDriftParameters_t& params : cryostat) {
+        in.read(params.driftDirection);
+        in.read(params.firstPlaneX);
+        in.read(params.xTicksCoefficient);
+        in.read(params.gapDriftVelocities);
+        in.read(params.gapXTicksCoefficients);
+        in.read(params.planePitches);
+      }
+    }
+    return table;
+  }
+
+  /// Returns the plane layout of the geometry `geo`, if any.
+  std::optional<detinfo::PlaneLayout> layoutFromGeometry(geo::GeometryCore const* geo)
+  {
+    if (!geo) return std::nullopt;
+    return detinfo::PlaneLayout::FromGeometry(*geo);
+  }
+
+} // local namespace
 
 namespace detinfo {
 
@@ -32,11 +81,119 @@ namespace detinfo {
     const geo::GeometryCore* geo,
     const detinfo::LArProperties* lp,
     std::set<std::string> const& ignore_params)
-    : fLP(lp), fGeo(geo)
+    : DetectorPropertiesStandard(pset, geo, layoutFromGeometry(geo), lp, ignore_params)
+  {}
+
+  //--------------------------------------------------------------------
+  DetectorPropertiesStandard::DetectorPropertiesStandard(
+    fhicl::ParameterSet const& pset,
+    PlaneLayout layout,
+    const detinfo::LArProperties* lp,
+    std::set<std::string> const& ignore_params)
+    : DetectorPropertiesStandard(pset, nullptr, std::move(layout), lp, ignore_params)
+  {}
+
+  //--------------------------------------------------------------------
+  DetectorPropertiesStandard::DetectorPropertiesStandard(
+    fhicl::ParameterSet const& pset,
+    const geo::GeometryCore* geo,
+    std::optional<PlaneLayout> layout,
+    const detinfo::LArProperties* lp,
+    std::set<std::string> const& ignore_params)
+    : fLP(lp), fGeo(geo), fPlaneLayout(std::move(layout))
   {
     ValidateAndConfigure(pset, ignore_params);
   }
 
+  //--------------------------------------------------------------------
+  DetectorPropertiesStandard::DetectorPropertiesStandard(BlobReader& in,
+                                                         const geo::GeometryCore* geo,
+                                                         const detinfo::LArProperties* lp)
+    : DetectorPropertiesStandard(in, geo, layoutFromGeometry(geo), lp)
+  {}
+
+  //--------------------------------------------------------------------
+  DetectorPropertiesStandard::DetectorPropertiesStandard(BlobReader& in,
+                                                         PlaneLayout layout,
+                                                         const detinfo::LArProperties* lp)
+    : DetectorPropertiesStandard(in, nullptr, std::move(layout), lp)
+  {}
+
+  //--------------------------------------------------------------------
+  DetectorPropertiesStandard::DetectorPropertiesStandard(BlobReader& in,
+                                                         const geo::GeometryCore* geo,
+                                                         std::optional<PlaneLayout> layout,
+                                                         const detinfo::LArProperties* lp)
+    : fLP(lp), fGeo(geo), fPlaneLayout(std::move(layout))
+  {
+    // the order must match the one in SaveState()
+    in.read(fEfield);
+    in.read(fElectronlifetime);
+    in.read(fTemperature);
+    in.read(fElectronsToADC);
+    in.read(fNumberTimeSamples);
+    in.read(fReadOutWindowSize);
+    in.read(fTimeOffsetU);
+    in.read(fTimeOffsetV);
+    in.read(fTimeOffsetZ);
+    in.read(fTimeOffsetY);
+    in.read(fTimeOffsetX);
+    in.read(fDriftVelFudgeFactor);
+    in.read(fSternheimerParameters.a);
+    in.read(fSternheimerParameters.k);
+    in.read(fSternheimerParameters.x0);
+    in.read(fSternheimerParameters.x1);
+    in.read(fSternheimerParameters.cbar);
+    in.read(fSimpleBoundary);
+
+    if (in.read<bool>()) {
+      XTicksTable_t table;
+      in.read(table.samplingRate);
+      in.read(table.triggerOffset);
+      in.read(table.coefficient);
+      in.read(table.offsets);
+      in.read(table.directions);
+      table.driftParameters = readDriftParameters(in);
+      fSavedXTicksTable = std::move(table);
+    }
+  }
+
+  //--------------------------------------------------------------------
+  void
+  DetectorPropertiesStandard::SaveState(BlobWriter& out,
+                                        detinfo::DetectorClocksData const* clock_data) const
+  {
+    out.write(fEfield);
+    out.write(fElectronlifetime);
+    out.write(fTemperature);
+    out.write(fElectronsToADC);
+    out.write(fNumberTimeSamples);
+    out.write(fReadOutWindowSize);
+    out.write(fTimeOffsetU);
+    out.write(fTimeOffsetV);
+    out.write(fTimeOffsetZ);
+    out.write(fTimeOffsetY);
+    out.write(fTimeOffsetX);
+    out.write(fDriftVelFudgeFactor);
+    out.write(fSternheimerParameters.a);
+    out.write(fSternheimerParameters.k);
+    out.write(fSternheimerParameters.x0);
+    out.write(fSternheimerParameters.x1);
+    out.write(fSternheimerParameters.cbar);
+    out.write(fSimpleBoundary);
+
+    out.write(clock_data != nullptr);
+    if (clock_data) {
+      XTicksTable_t const table = ComputeXTicksTable(*clock_data);
+      out.write(table.samplingRate);
+      out.write(table.triggerOffset);
+      out.write(table.coefficient);
+      out.write(table.offsets);
+      out.write(table.directions);
+      writeDriftParameters(out, table.driftParameters);
+    }
+  }
+
   //--------------------------------------------------------------------
   void
   DetectorPropertiesStandard::ValidateAndConfigure(fhicl::ParameterSet const& p,
@@ -107,6 +264,7 @@ namespace detinfo {
   double
   DetectorPropertiesStandard::Density(double temperature) const
   {
+    LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorPropertiesStandard::Density");
     // Default temperature use internal value.
     if (temperature == 0.) temperature = Temperature();
 
@@ -116,80 +274,40 @@ namespace detinfo {
   //----------------------------------------------------------------------------------
   // Restricted mean energy loss (dE/dx) in units of MeV/cm.
   //
-  // For unrestricted mean energy loss, set tcut = 0, or tcut large.
-  //
-  // Arguments:
-  //
-  // mom  - Momentum of incident particle in GeV/c.
-  // mass - Mass of incident particle in GeV/c^2.
-  // tcut - Maximum kinetic energy of delta rays (MeV).
-  //
-  // Returned value is positive.
-  //
-  // Based on Bethe-Bloch formula as contained in particle data book.
-  // Material parameters (stored in larproperties.fcl) are taken from
-  // pdg web site http://pdg.lbl.gov/AtomicNuclearProperties/
+  // Based on Bethe-Bloch formula as contained in particle data book;
+  // see detinfo::RestrictedEloss() for the implementation.
   //
   double
-  DetectorPropertiesStandard::Eloss(double mom, double mass, double tcut) const
+  DetectorPropertiesStandard::Eloss(double const mom, double const mass, double const tcut) const
   {
-    // Some constants.
-    constexpr double K = 0.307075;     // 4 pi N_A r_e^2 m_e c^2 (MeV cm^2/mol).
-    constexpr double me = 0.510998918; // Electron mass (MeV/c^2).
-
-    // Calculate kinematic quantities.
-    double const bg = mom / mass;            // beta*gamma.
-    double const gamma = sqrt(1. + bg * bg); // gamma.
-    double const beta = bg / gamma;          // beta (velocity).
-    double const mer = 0.001 * me / mass;    // electron mass / mass of incident particle.
-    double const tmax =
-      2. * me * bg * bg / (1. + 2. * gamma * mer + mer * mer); // Maximum delta ray energy (MeV).
-
-    // Make sure tcut does not exceed tmax.
-    if (tcut == 0. || tcut > tmax) tcut = tmax;
-
-    // Calculate density effect correction (delta).
-    double const x = std::log10(bg);
-    double delta = 0.;
-    if (x >= fSternheimerParameters.x0) {
-      delta = 2. * std::log(10.) * x - fSternheimerParameters.cbar;
-      if (x < fSternheimerParameters.x1)
-        delta += fSternheimerParameters.a *
-                 std::pow(fSternheimerParameters.x1 - x, fSternheimerParameters.k);
-    }
-
-    // Calculate stopping number.
-    double B =
-      0.5 * std::log(2. * me * bg * bg * tcut / (1.e-12 * cet::square(fLP->ExcitationEnergy()))) -
-      0.5 * beta * beta * (1. + tcut / tmax) - 0.5 * delta;
-
-    // Don't let the stopping number become negative.
-    if (B < 1.) B = 1.;
-
-    // Calculate dE/dx.
-    return Density() * K * fLP->AtomicNumber() * B / (fLP->AtomicMass() * beta * beta);
+    LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorPropertiesStandard::Eloss");
+    return RestrictedEloss(ElossMaterialParameters(), mom, mass, tcut);
   }
 
   //----------------------------------------------------------------------------------
   double
   DetectorPropertiesStandard::ElossVar(double const mom, double const mass) const
   {
-    // Some constants.
-    constexpr double K = 0.307075;     // 4 pi N_A r_e^2 m_e c^2 (MeV cm^2/mol).
-    constexpr double me = 0.510998918; // Electron mass (MeV/c^2).
-
-    // Calculate kinematic quantities.
-    double const bg = mom / mass;          // beta*gamma.
-    double const gamma2 = 1. + bg * bg;    // gamma^2.
-    double const beta2 = bg * bg / gamma2; // beta^2.
-    return gamma2 * (1. - 0.5 * beta2) * me * (fLP->AtomicNumber() / fLP->AtomicMass()) * K *
-           Density();
+    LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorPropertiesStandard::ElossVar");
+    return ElossVariance(ElossMaterialParameters(), mom, mass);
+  }
+
+  //----------------------------------------------------------------------------------
+  ElossMaterialParameters_t
+  DetectorPropertiesStandard::ElossMaterialParameters() const
+  {
+    return {Density(),
+            fLP->AtomicNumber(),
+            fLP->AtomicMass(),
+            fLP->ExcitationEnergy(),
+            fSternheimerParameters};
   }
 
   //------------------------------------------------------------------------------------//
   double
   DetectorPropertiesStandard::DriftVelocity(double efield, double temperature) const
   {
+    LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorPropertiesStandard::DriftVelocity");
     // Drift Velocity as a function of Electric Field and LAr Temperature
     // from : W. Walkowiak, NIM A 449 (2000) 288-294
     //
@@ -199,7 +317,7 @@ namespace detinfo {
     // Default Efield, use internal value.
     if (efield == 0.) efield = Efield();
 
-    if (efield > 4.0)
+    if (efield > MaxDriftVelocityEfield)
       mf::LogWarning("DetectorPropertiesStandard")
         << "DriftVelocity Warning! : E-field value of " << efield
         << " kV/cm is outside of range covered by drift"
@@ -209,66 +327,173 @@ namespace detinfo {
     // Default temperature use internal value.
     if (temperature == 0.) temperature = Temperature();
 
-    if (temperature < 87.0 || temperature > 94.0)
+    if (temperature < MinDriftVelocityTemperature || temperature > MaxDriftVelocityTemperature)
       mf::LogWarning("DetectorPropertiesStandard")
         << "DriftVelocity Warning! : Temperature value of " << temperature
         << " K is outside of range covered by drift velocity"
         << " parameterization. Returned value may not be"
         << " correct";
 
+    double vd = DriftVelocityAtTemperature{temperature}(efield);
+
+    vd *= fDriftVelFudgeFactor / 10.;
+
+    return vd; // in cm/us
+  }
+
+  //------------------------------------------------------------------------------------//
+  DetectorPropertiesStandard::DriftVelocityAtTemperature::DriftVelocityAtTemperature(
+    double const temperature)
+  {
     double const tshift = -87.203 + temperature;
-    double const xFit = 0.0938163 - 0.0052563 * tshift - 0.0001470 * tshift * tshift;
-    double const uFit =
+    xFit = 0.0938163 - 0.0052563 * tshift - 0.0001470 * tshift * tshift;
+    uFit =
       5.18406 + 0.01448 * tshift - 0.003497 * tshift * tshift - 0.000516 * tshift * tshift * tshift;
 
-    // Icarus Parameter Set, use as default
-    constexpr double P1 = -0.04640; // K^-1
-    constexpr double P2 = 0.01712;  // K^-1
-    constexpr double P3 = 1.88125;  // (kV/cm)^-1
-    constexpr double P4 = 0.99408;  // kV/cm
-    constexpr double P5 = 0.01172;  // (kV/cm)^-P6
-    constexpr double P6 = 4.20214;
-    constexpr double T0 = 105.749; // K
-
-    // Walkowiak Parameter Set
-    constexpr double P1W = -0.01481; // K^-1
-    constexpr double P2W = -0.0075;  // K^-1
-    constexpr double P3W = 0.141;    // (kV/cm)^-1
-    constexpr double P4W = 12.4;     // kV/cm
-    constexpr double P5W = 1.627;    // (kV/cm)^-P6
-    constexpr double P6W = 0.317;
-    constexpr double T0W = 90.371; // K
+    icarusScale = P1 * (temperature - T0) + 1;
+    icarusShift = P2 * (temperature - T0);
+    walkowiakScale = P1W * (temperature - T0W) + 1;
+    walkowiakShift = P2W * (temperature - T0W);
+  }
 
+  //------------------------------------------------------------------------------------//
+  double
+  DetectorPropertiesStandard::DriftVelocityAtTemperature::operator()(double const efield) const
+  {
     // From Craig Thorne . . . currently not documented
     // smooth transition from linear at small fields to
     //     icarus fit at most fields to Walkowiak at very high fields
-    double vd;
-    if (efield < xFit)
-      vd = efield * uFit;
-    else if (efield < 0.619) {
-      vd = ((P1 * (temperature - T0) + 1) *
-              (P3 * efield * std::log(1 + P4 / efield) + P5 * std::pow(efield, P6)) +
-            P2 * (temperature - T0));
+    if (efield < xFit) return efield * uFit;
+
+    auto const icarus = [this, efield]() {
+      return icarusScale * (P3 * efield * std::log(1 + P4 / efield) + P5 * std::pow(efield, P6)) +
+             icarusShift;
+    };
+    auto const walkowiak = [this, efield]() {
+      return walkowiakScale *
+               (P3W * efield * std::log(1 + P4W / efield) + P5W * std::pow(efield, P6W)) +
+             walkowiakShift;
+    };
+
+    if (efield < 0.619) return icarus();
+    if (efield < 0.699)
+      return 12.5 * (efield - 0.619) * walkowiak() + 12.5 * (0.699 - efield) * icarus();
+    return walkowiak();
+  }
+
+  //------------------------------------------------------------------------------------//
+  DetectorPropertiesStandard::RangeReport_t
+  DetectorPropertiesStandard::DriftVelocities(std::vector<double> const& efields,
+                                              std::vector<double> const& temperatures,
+                                              std::vector<double>& velocities) const
+  {
+    if (efields.size() != temperatures.size()) {
+      throw cet::exception("DetectorPropertiesStandard")
+        << "DriftVelocities(): " << efields.size() << " electric field values but "
+        << temperatures.size() << " temperatures\n";
     }
-    else if (efield < 0.699) {
-      vd = 12.5 * (efield - 0.619) *
-             ((P1W * (temperature - T0W) + 1) *
-                (P3W * efield * std::log(1 + P4W / efield) + P5W * std::pow(efield, P6W)) +
-              P2W * (temperature - T0W)) +
-           12.5 * (0.699 - efield) *
-             ((P1 * (temperature - T0) + 1) *
-                (P3 * efield * std::log(1 + P4 / efield) + P5 * std::pow(efield, P6)) +
-              P2 * (temperature - T0));
+
+    RangeReport_t report;
+    report.nPoints = efields.size();
+    velocities.resize(efields.size());
+
+    double const defaultEfield = Efield();
+    double const defaultTemperature = Temperature();
+    double const scale = fDriftVelFudgeFactor / 10.;
+
+    // consecutive points often share the same temperature
+    double lastTemperature = defaultTemperature;
+    DriftVelocityAtTemperature driftVelocity{lastTemperature};
+    for (std::size_t i = 0; i < efields.size(); ++i) {
+      double const efield = (efields[i] == 0.) ? defaultEfield : efields[i];
+      double const temperature = (temperatures[i] == 0.) ? defaultTemperature : temperatures[i];
+      if (efield > MaxDriftVelocityEfield) ++report.nHighEfield;
+      if (temperature < MinDriftVelocityTemperature || temperature > MaxDriftVelocityTemperature)
+        ++report.nBadTemperature;
+      if (temperature != lastTemperature) {
+        lastTemperature = temperature;
+        driftVelocity = DriftVelocityAtTemperature{temperature};
+      }
+      velocities[i] = driftVelocity(efield) * scale;
+    }
+
+    ReportDriftVelocityRange(report);
+    return report;
+  }
+
+  //------------------------------------------------------------------------------------//
+  DetectorPropertiesStandard::RangeReport_t
+  DetectorPropertiesStandard::DriftVelocities(std::vector<double> const& efields,
+                                              double temperature,
+                                              std::vector<double>& velocities) const
+  {
+    if (temperature == 0.) temperature = Temperature();
+
+    RangeReport_t report;
+    report.nPoints = efields.size();
+    if (temperature < MinDriftVelocityTemperature || temperature > MaxDriftVelocityTemperature)
+      report.nBadTemperature = efields.size();
+    velocities.resize(efields.size());
+
+    double const defaultEfield = Efield();
+    double const scale = fDriftVelFudgeFactor / 10.;
+    DriftVelocityAtTemperature const driftVelocity{temperature};
+    for (std::size_t i = 0; i < efields.size(); ++i) {
+      double const efield = (efields[i] == 0.) ? defaultEfield : efields[i];
+      if (efield > MaxDriftVelocityEfield) ++report.nHighEfield;
+      velocities[i] = driftVelocity(efield) * scale;
     }
-    else {
-      vd = ((P1W * (temperature - T0W) + 1) *
-              (P3W * efield * std::log(1 + P4W / efield) + P5W * std::pow(efield, P6W)) +
-            P2W * (temperature - T0W));
+
+    ReportDriftVelocityRange(report);
+    return report;
+  }
+
+  //------------------------------------------------------------------------------------//
+  DetectorPropertiesStandard::RangeReport_t
+  DetectorPropertiesStandard::Densities(std::vector<double> const& temperatures,
+                                        std::vector<double>& densities) const
+  {
+    RangeReport_t report;
+    report.nPoints = temperatures.size();
+    densities.resize(temperatures.size());
+
+    // branch-free loop, left to the compiler to vectorize
+    double const defaultTemperature = Temperature();
+    for (std::size_t i = 0; i < temperatures.size(); ++i) {
+      double const temperature = (temperatures[i] == 0.) ? defaultTemperature : temperatures[i];
+      report.nBadTemperature += (temperature < MinDriftVelocityTemperature) |
+                                (temperature > MaxDriftVelocityTemperature);
+      densities[i] = -0.00615 * temperature + 1.928;
     }
+    return report;
+  }
 
-    vd *= fDriftVelFudgeFactor / 10.;
+  //------------------------------------------------------------------------------------//
+  void
+  DetectorPropertiesStandard::ReportDriftVelocityRange(RangeReport_t const& report)
+  {
+    if (report.nHighEfield == 0 && report.nBadTemperature == 0) return;
+    mf::LogWarning("DetectorPropertiesStandard")
+      << "DriftVelocities Warning! : out of " << report.nPoints << " points, "
+      << report.nHighEfield << " have E-field above " << MaxDriftVelocityEfield << " kV/cm and "
+      << report.nBadTemperature << " have temperature outside " << MinDriftVelocityTemperature
+      << "-" << MaxDriftVelocityTemperature << " K, the range covered by the drift velocity"
+      << " parameterization. Returned values may not be correct";
+  }
 
-    return vd; // in cm/us
+  //----------------------------------------------------------------------------------
+  void
+  DetectorPropertiesStandard::SetEfieldMap(EfieldMap map)
+  {
+    std::vector<double> velocities;
+    DriftVelocities(map.Efields(), Temperature(), velocities);
+    auto iVelocity = velocities.cbegin();
+    map.BuildDriftVelocities([&iVelocity](double const efield) {
+      // DriftVelocities() replaces a null field with the default one
+      double const velocity = *iVelocity++;
+      return (efield > 0.) ? velocity : 0.;
+    });
+    fEfieldMap = std::move(map);
   }
 
   //----------------------------------------------------------------------------------
@@ -290,15 +515,8 @@ namespace detinfo {
   {
     // Correction for charge quenching using parameterization from
     // S.Amoruso et al., NIM A 523 (2004) 275
-
-    constexpr double A3t = util::kRecombA;
-    double K3t = util::kRecombk;                           // in KV/cm*(g/cm^2)/MeV
-    double const rho = Density();                          // LAr density in g/cm^3
-    constexpr double Wion = 1000. / util::kGeVToElectrons; // 23.6 eV = 1e, Wion in MeV/e
-    K3t /= rho;                      // KV/MeV
-    double const dEdx = dQdx / (A3t / Wion - K3t / E_field * dQdx); // MeV/cm
-
-    return dEdx;
+    // (see detinfo::RecombinationCorrection::Birks())
+    return RecombinationCorrection{Density(), E_field}.Birks(dQdx);
   }
 
   //----------------------------------------------------------------------------------
@@ -313,13 +531,8 @@ namespace detinfo {
   {
     // Modified Box model correction has better behavior than the Birks
     // correction at high values of dQ/dx.
-    double const rho = Density();                          // LAr density in g/cm^3
-    constexpr double Wion = 1000. / util::kGeVToElectrons; // 23.6 eV = 1e, Wion in MeV/e
-    double const Beta = util::kModBoxB / (rho * E_field);
-    constexpr double Alpha = util::kModBoxA;
-    double const dEdx = (exp(Beta * Wion * dQdx) - Alpha) / Beta;
-
-    return dEdx;
+    // (see detinfo::RecombinationCorrection::ModBox())
+    return RecombinationCorrection{Density(), E_field}.ModBox(dQdx);
   }
 
   //--------------------------------------------------------------------
@@ -336,6 +549,38 @@ namespace detinfo {
   DetectorPropertiesStandard::DataFor(
     detinfo::DetectorClocksData const& clock_data) const
   {
+    LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorPropertiesStandard::DataFor");
+    if (fSavedXTicksTable && (fSavedXTicksTable->samplingRate == sampling_rate(clock_data)) &&
+        (fSavedXTicksTable->triggerOffset == trigger_offset(clock_data))) {
+      XTicksTable_t table = *fSavedXTicksTable;
+      return DetectorPropertiesData{*this,
+                                    table.coefficient,
+                                    move(table.offsets),
+                                    move(table.directions),
+                                    move(table.driftParameters)};
+    }
+
+    XTicksTable_t table = ComputeXTicksTable(clock_data);
+    return DetectorPropertiesData{*this,
+                                  table.coefficient,
+                                  move(table.offsets),
+                                  move(table.directions),
+                                  move(table.driftParameters)};
+  }
+
+  //--------------------------------------------------------------------
+  DetectorPropertiesStandard::XTicksTable_t
+  DetectorPropertiesStandard::ComputeXTicksTable(
+    detinfo::DetectorClocksData const& clock_data) const
+  {
+    LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorPropertiesStandard::ComputeXTicksTable");
+    if (!fPlaneLayout) {
+      throw cet::exception("DetectorPropertiesStandard")
+        << "Geometry or plane layout is required to compute the drift parameters"
+           " for this timing configuration.\n";
+    }
+    PlaneLayout const& layout = *fPlaneLayout;
+
     double const samplingRate = sampling_rate(clock_data);
     double const efield = Efield();
     double const temperature = Temperature();
@@ -344,101 +589,141 @@ namespace detinfo {
 
     double const triggerOffset = trigger_offset(clock_data);
 
-    std::vector<std::vector<std::vector<double>>> x_ticks_offsets(fGeo->Ncryostats());
-    std::vector<std::vector<double>> drift_direction(fGeo->Ncryostats());
-
-    for (size_t cstat = 0; cstat < fGeo->Ncryostats(); ++cstat) {
-      x_ticks_offsets[cstat].resize(fGeo->Cryostat(cstat).NTPC());
-      drift_direction[cstat].resize(fGeo->Cryostat(cstat).NTPC());
-
-      for (size_t tpc = 0; tpc < fGeo->Cryostat(cstat).NTPC(); ++tpc) {
-        const geo::TPCGeo& tpcgeom = fGeo->Cryostat(cstat).TPC(tpc);
+    // drift in the gaps between planes is the same in all TPCs
+    std::vector<double> gapDriftVelocities;
+    std::vector<double> gapXTicksCoefficients;
+    for (double const efieldgap : fEfield) {
+      double const driftVelocitygap = DriftVelocity(efieldgap, temperature);
+      gapDriftVelocities.push_back(driftVelocitygap);
+      gapXTicksCoefficients.push_back(0.001 * driftVelocitygap * samplingRate);
+    }
 
-        const double dir((tpcgeom.DriftDirection() == geo::kNegX) ? +1.0 : -1.0);
-        drift_direction[cstat][tpc] = dir;
+    unsigned int const ncstat = layout.NCryostats();
+    std::vector<std::vector<std::vector<double>>> x_ticks_offsets(ncstat);
+    std::vector<std::vector<double>> drift_direction(ncstat);
+    DriftParameterTable_t drift_parameters(ncstat);
+
+    for (unsigned int cstat = 0; cstat < ncstat; ++cstat) {
+      unsigned int const ntpc = layout.NTPCs(cstat);
+      x_ticks_offsets[cstat].resize(ntpc);
+      drift_direction[cstat].resize(ntpc);
+      drift_parameters[cstat].resize(ntpc);
+
+      for (unsigned int tpc = 0; tpc < ntpc; ++tpc) {
+        PlaneLayout::TPC_t const& tpcLayout = layout.TPC(cstat, tpc);
+        PlaneLayout::Plane_t const* planes = layout.Planes(tpcLayout);
+        unsigned int const nplane = tpcLayout.nPlanes;
+
+        drift_direction[cstat][tpc] = tpcLayout.driftDirection;
+
+        TPCDriftParameters_t& params = drift_parameters[cstat][tpc];
+        params.driftDirection = tpcLayout.driftDirection;
+        params.firstPlaneX = tpcLayout.firstPlaneX;
+        params.xTicksCoefficient = x_ticks_coefficient;
+        params.gapDriftVelocities = gapDriftVelocities;
+        params.gapXTicksCoefficients = gapXTicksCoefficients;
+        params.planePitches.resize(nplane - 1U);
+        for (unsigned int ip = 0; ip + 1 < nplane; ++ip)
+          params.planePitches[ip] = planes[ip].pitch;
 
-        int nplane = tpcgeom.Nplanes();
         x_ticks_offsets[cstat][tpc].resize(nplane, 0.);
-        for (int plane = 0; plane < nplane; ++plane) {
-          const geo::PlaneGeo& pgeom = tpcgeom.Plane(plane);
-
-          // Get field in gap between planes
-          double efieldgap[3];
-          double driftVelocitygap[3];
-          double x_ticks_coefficient_gap[3];
-          for (int igap = 0; igap < 3; ++igap) {
-            efieldgap[igap] = Efield(igap);
-            driftVelocitygap[igap] = DriftVelocity(efieldgap[igap], temperature);
-            x_ticks_coefficient_gap[igap] = 0.001 * driftVelocitygap[igap] * samplingRate;
-          }
-
-          // Calculate geometric time offset.
-          // only works if xyz[0]<=0
-          const double* xyz = tpcgeom.PlaneLocation(0);
-
-          x_ticks_offsets[cstat][tpc][plane] =
-            -xyz[0] / (dir * x_ticks_coefficient) + triggerOffset;
-
-          if (nplane == 3) {
-            /*
-         |    ---------- plane = 2 (collection)
-         |                      Coeff[2]
-         |    ---------- plane = 1 (2nd induction)
-         |                      Coeff[1]
-         |    ---------- plane = 0 (1st induction) x = xyz[0]
-         |                      Coeff[0]
-         |    ---------- x = 0
-         V     For plane = 0, t offset is -xyz[0]/Coeff[0]
-         x   */
-            for (int ip = 0; ip < plane; ++ip) {
-              x_ticks_offsets[cstat][tpc][plane] +=
-                tpcgeom.PlanePitch(ip, ip + 1) / x_ticks_coefficient_gap[ip + 1];
-            }
-          }
-          else if (nplane == 2) { ///< special case for ArgoNeuT
-            /*
-         |    ---------- plane = 1 (collection)
-         |                      Coeff[2]
-         |    ---------- plane = 0 (2nd induction) x = xyz[0]
-         |    ---------- x = 0, Coeff[1]
-         V    ---------- first induction plane
-         x                      Coeff[0]
-               For plane = 0, t offset is pitch/Coeff[1] -
-         (pitch+xyz[0])/Coeff[0] = -xyz[0]/Coeff[0] -
-         pitch*(1/Coeff[0]-1/Coeff[1])
-            */
-            for (int ip = 0; ip < plane; ++ip) {
-              x_ticks_offsets[cstat][tpc][plane] +=
-                tpcgeom.PlanePitch(ip, ip + 1) / x_ticks_coefficient_gap[ip + 2];
-            }
-            x_ticks_offsets[cstat][tpc][plane] -=
-              tpcgeom.PlanePitch() * (1 / x_ticks_coefficient - 1 / x_ticks_coefficient_gap[1]);
-          }
+        for (unsigned int plane = 0; plane < nplane; ++plane) {
+          double& offset = x_ticks_offsets[cstat][tpc][plane];
+          offset = PlaneXTicksOffset(params, plane, triggerOffset);
 
           // Add view dependent offset
           // FIXME the offset should be plane-dependent
-          geo::View_t view = pgeom.View();
+          geo::View_t const view = planes[plane].view;
           switch (view) {
-          case geo::kU: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetU; break;
-          case geo::kV: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetV; break;
-          case geo::kZ: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetZ; break;
-          case geo::kY: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetY; break;
-          case geo::kX: x_ticks_offsets[cstat][tpc][plane] += fTimeOffsetX; break;
+          case geo::kU: offset += fTimeOffsetU; break;
+          case geo::kV: offset += fTimeOffsetV; break;
+          case geo::kZ: offset += fTimeOffsetZ; break;
+          case geo::kY: offset += fTimeOffsetY; break;
+          case geo::kX: offset += fTimeOffsetX; break;
           default: throw cet::exception(__FUNCTION__) << "Bad view = " << view << "\n";
           } // switch
         }
       }
     }
 
-    return DetectorPropertiesData{
-      *this, x_ticks_coefficient, move(x_ticks_offsets), move(drift_direction)};
+    return {samplingRate,
+            triggerOffset,
+            x_ticks_coefficient,
+            move(x_ticks_offsets),
+            move(drift_direction),
+            move(drift_parameters)};
+  }
+
+  //--------------------------------------------------------------------
+  double
+  DetectorPropertiesStandard::PlaneXTicksOffset(TPCDriftParameters_t const& params,
+                                                unsigned int const plane,
+                                                double const triggerOffset)
+  {
+    auto const gapCoefficient = [&params](unsigned int const igap) {
+      if (igap >= params.gapXTicksCoefficients.size())
+        throw cet::exception("DetectorPropertiesStandard")
+          << "requesting Electric field in a plane gap that is not defined\n";
+      return params.gapXTicksCoefficients[igap];
+    };
+
+    // Calculate geometric time offset.
+    double offset =
+      -params.firstPlaneX / (params.driftDirection * params.xTicksCoefficient) + triggerOffset;
+
+    unsigned int const nplane = params.NPlanes();
+    if (nplane == 3) {
+      /*
+   |    ---------- plane = 2 (collection)
+   |                      Coeff[2]
+   |    ---------- plane = 1 (2nd induction)
+   |                      Coeff[1]
+   |    ---------- plane = 0 (1st induction) x = xyz[0]
+   |                      Coeff[0]
+   |    ---------- x = 0
+   V     For plane = 0, t offset is -xyz[0]/Coeff[0]
+   x   */
+      for (unsigned int ip = 0; ip < plane; ++ip) {
+        offset += params.planePitches[ip] / gapCoefficient(ip + 1);
+      }
+    }
+    else if (nplane == 2) { ///< special case for ArgoNeuT
+      /*
+   |    ---------- plane = 1 (collection)
+   |                      Coeff[2]
+   |    ---------- plane = 0 (2nd induction) x = xyz[0]
+   |    ---------- x = 0, Coeff[1]
+   V    ---------- first induction plane
+   x                      Coeff[0]
+         For plane = 0, t offset is pitch/Coeff[1] -
+   (pitch+xyz[0])/Coeff[0] = -xyz[0]/Coeff[0] -
+   pitch*(1/Coeff[0]-1/Coeff[1])
+      */
+      for (unsigned int ip = 0; ip < plane; ++ip) {
+        offset += params.planePitches[ip] / gapCoefficient(ip + 2);
+      }
+      offset -= params.planePitches[0] * (1 / params.xTicksCoefficient - 1 / gapCoefficient(1));
+    }
+    return offset;
   }
 
+  //--------------------------------------------------------------------
+  void
+  DetectorPropertiesStandard::debugReport() const
+  {
+    std::cout << "DetectorPropertiesStandard instrumentation:\n";
+    detinfo::instrumentation::report(std::cout, "DetectorPropertiesStandard::", "  ");
+    std::cout.flush();
+  }
 
+  //--------------------------------------------------------------------
   std::string
   DetectorPropertiesStandard::CheckTimeOffsets(std::set<geo::View_t> const& requested_views) const
   {
-    auto const& present_views = fGeo->Views();
+    // without a plane layout there is nothing to check against
+    if (!fPlaneLayout) return {};
+
+    auto const present_views = fPlaneLayout->Views();
 
     auto view_diff = [&present_views, &requested_views](geo::View_t const view) {
                        return static_cast<int>(present_views.count(view)) -
@@ -17,7 +17,10 @@
 #include "lardataalg/DetectorInfo/DetectorClocks.h"
 #include "lardataalg/DetectorInfo/DetectorProperties.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/EfieldMap.h"
+#include "lardataalg/DetectorInfo/ElossTable.h"
 #include "lardataalg/DetectorInfo/LArProperties.h"
+#include "lardataalg/DetectorInfo/PlaneLayout.h"
 
 // framework libraries
 #include "fhiclcpp/ParameterSet.h"
@@ -27,11 +30,17 @@
 #include "fhiclcpp/types/Sequence.h"
 
 // C/C++ standard libraries
+#include <optional>
 #include <set>
+#include <utility> // std::move()
+#include <vector>
 
 /// General LArSoft Utilities
 namespace detinfo {
 
+  class BlobWriter;
+  class BlobReader;
+
   class DetectorPropertiesStandard final : public DetectorProperties {
   public:
     /// List of service providers we depend on
@@ -112,14 +121,91 @@ namespace detinfo {
 
     }; // Configuration_t
 
+    /**
+     * @brief Constructor: configures the provider.
+     * @param pset the configuration of the provider
+     * @param geo geometry provider (may be `nullptr`)
+     * @param lp liquid argon properties provider
+     * @param ignore_params configuration keys not to be validated
+     * @throw cet::exception (category: `"DetectorPropertiesStandard"`) if a
+     *        view present in the detector has no time offset configured
+     *
+     * The plane layout is extracted from the geometry, if any. Without
+     * geometry, the time offsets are not checked and the layout must be set
+     * with `SetPlaneLayout()` before calling `DataFor()`.
+     */
     DetectorPropertiesStandard(fhicl::ParameterSet const& pset,
                                const geo::GeometryCore* geo,
                                const detinfo::LArProperties* lp,
                                std::set<std::string> const& ignore_params = {});
 
+    /**
+     * @brief Constructor: configures the provider with no geometry.
+     * @param pset the configuration of the provider
+     * @param layout description of the planes of all TPCs
+     * @param lp liquid argon properties provider
+     * @param ignore_params configuration keys not to be validated
+     * @throw cet::exception (category: `"DetectorPropertiesStandard"`) if a
+     *        view present in `layout` has no time offset configured
+     *
+     * The provider is fully functional without access to the geometry: the
+     * time offsets are checked against the views in `layout`, and `DataFor()`
+     * computes the drift parameters from it.
+     */
+    DetectorPropertiesStandard(fhicl::ParameterSet const& pset,
+                               PlaneLayout layout,
+                               const detinfo::LArProperties* lp,
+                               std::set<std::string> const& ignore_params = {});
+
+    /**
+     * @brief Constructor: restores the state written by `SaveState()`.
+     * @param in reader positioned at the beginning of the saved state
+     * @param geo geometry provider (may be `nullptr`, see below)
+     * @param lp liquid argon properties provider
+     * @throw cet::exception (category: `"BinaryBlob"`) on missing data
+     *
+     * The configuration is not validated again, and the time offsets are not
+     * checked against the geometry, since the state was saved by a provider
+     * which had already done that.
+     *
+     * If the saved state includes the per-plane drift table (see
+     * `SaveState()`), `DataFor()` reuses it for timing configurations with the
+     * same sampling rate and trigger offset; in all other cases, it computes
+     * the table from the plane layout, which must then be extracted from the
+     * geometry or set with `SetPlaneLayout()`.
+     */
+    DetectorPropertiesStandard(BlobReader& in,
+                               const geo::GeometryCore* geo,
+                               const detinfo::LArProperties* lp);
+
+    /**
+     * @brief Constructor: restores the state written by `SaveState()`.
+     * @param in reader positioned at the beginning of the saved state
+     * @param layout description of the planes of all TPCs
+     * @param lp liquid argon properties provider
+     * @throw cet::exception (category: `"BinaryBlob"`) on missing data
+     * @see `DetectorPropertiesStandard(BlobReader&, geo::GeometryCore const*, detinfo::LArProperties const*)`
+     *
+     * The drift tables are computed from `layout` rather than from the
+     * geometry.
+     */
+    DetectorPropertiesStandard(BlobReader& in,
+                               PlaneLayout layout,
+                               const detinfo::LArProperties* lp);
+
     DetectorPropertiesStandard(DetectorPropertiesStandard const&) = delete;
     virtual ~DetectorPropertiesStandard() = default;
 
+    /**
+     * @brief Appends the configured state of the provider to `out`.
+     * @param out the blob writer
+     * @param clock_data if not `nullptr`, the per-plane drift table for this
+     *                   timing is also saved
+     * @see `DetectorPropertiesStandard(BlobReader&, geo::GeometryCore const*, detinfo::LArProperties const*)`
+     */
+    void SaveState(BlobWriter& out,
+                   detinfo::DetectorClocksData const* clock_data = nullptr) const;
+
     void
     SetNumberTimeSamples(unsigned int nsamp)
     {
@@ -129,10 +215,151 @@ namespace detinfo {
     // Accessors.
 
     double Efield(unsigned int planegap = 0) const override; ///< kV/cm
+    unsigned int
+    NPlaneGaps() const override
+    {
+      return fEfield.size();
+    }
 
     double DriftVelocity(double efield = 0.,
                          double temperature = 0.) const override; ///< cm/us
 
+    // --- BEGIN -- Bulk evaluation --------------------------------------------
+    /**
+     * @name Bulk evaluation
+     *
+     * These methods evaluate the same parameterizations as `DriftVelocity()`
+     * and `Density()` on many points at once. Instead of a warning for each
+     * point outside the range covered by the parameterization, they return
+     * the number of such points, and the drift velocity methods emit a single
+     * summary warning if there is any.
+     * As in the single point methods, a null value stands for the configured
+     * one. The output vector is resized to match the input.
+     */
+    /// @{
+
+    /// Counts of points outside the range covered by a parameterization.
+    struct RangeReport_t {
+      std::size_t nPoints = 0;         ///< Number of evaluated points.
+      std::size_t nHighEfield = 0;     ///< Points with field above the range.
+      std::size_t nBadTemperature = 0; ///< Points with temperature out of range.
+    };
+
+    /// Drift velocity [cm/us] at pairs of field [kV/cm] and temperature [K].
+    /// @throw cet::exception if the two input vectors differ in size
+    RangeReport_t DriftVelocities(std::vector<double> const& efields,
+                                  std::vector<double> const& temperatures,
+                                  std::vector<double>& velocities) const;
+
+    /// Drift velocity [cm/us] at fields [kV/cm] and a single temperature [K].
+    RangeReport_t DriftVelocities(std::vector<double> const& efields,
+                                  double temperature,
+                                  std::vector<double>& velocities) const;
+
+    /// Argon density [g/cm^3] at temperatures [K].
+    RangeReport_t Densities(std::vector<double> const& temperatures,
+                            std::vector<double>& densities) const;
+
+    /// @}
+    // --- END -- Bulk evaluation ----------------------------------------------
+
+    // --- BEGIN -- Electric field map -----------------------------------------
+    /**
+     * @name Electric field map
+     *
+     * Optionally, the magnitude of the electric field in the drift volume can
+     * be described by a map (`detinfo::EfieldMap`), for example to account for
+     * space charge distortions. The map also caches the drift velocity at each
+     * of its points, computed with `DriftVelocity()` at the configured
+     * temperature.
+     * When no map is set, the position-dependent queries return the values of
+     * the main drift volume (`Efield()` and `DriftVelocity()`).
+     */
+    /// @{
+
+    /**
+     * @brief Sets the map of the electric field in the drift volume.
+     * @param map the new field map
+     *
+     * The drift velocity is computed at each point of the map, replacing any
+     * value already present there. A null field results in a null velocity.
+     */
+    void SetEfieldMap(EfieldMap map);
+
+    /// Removes the electric field map, if any.
+    void ClearEfieldMap() { fEfieldMap.reset(); }
+
+    /// Returns whether an electric field map is set.
+    bool HasEfieldMap() const { return fEfieldMap.has_value(); }
+
+    /// Returns the electric field map, `nullptr` if not set.
+    EfieldMap const* GetEfieldMap() const { return fEfieldMap ? &*fEfieldMap : nullptr; }
+
+    /// Returns the electric field magnitude at a position [kV/cm].
+    double EfieldAt(double x, double y, double z) const
+    {
+      return fEfieldMap ? fEfieldMap->Efield(x, y, z) : Efield();
+    }
+
+    /// Returns the drift velocity at a position [cm/us].
+    double DriftVelocityAt(double x, double y, double z) const
+    {
+      return fEfieldMap ? fEfieldMap->DriftVelocity(x, y, z) : DriftVelocity();
+    }
+
+    /**
+     * @brief Computes the electric field magnitude for a sequence of points.
+     * @param begin iterator to the first point (with `X()`, `Y()` and `Z()`)
+     * @param end iterator past the last point
+     * @param efields iterator to the first output element [kV/cm]
+     * @return the output iterator past the last written element
+     */
+    template <typename BIter, typename EIter, typename OIter>
+    OIter EfieldsAt(BIter begin, EIter end, OIter efields) const
+    {
+      if (fEfieldMap) return fEfieldMap->Efields(begin, end, efields);
+      double const efield = Efield();
+      while (begin != end) { ++begin; *efields++ = efield; }
+      return efields;
+    }
+
+    /// Computes the drift velocity for a sequence of points [cm/us].
+    /// @see `EfieldsAt()`
+    template <typename BIter, typename EIter, typename OIter>
+    OIter DriftVelocitiesAt(BIter begin, EIter end, OIter velocities) const
+    {
+      if (fEfieldMap) return fEfieldMap->DriftVelocities(begin, end, velocities);
+      double const driftVelocity = DriftVelocity();
+      while (begin != end) { ++begin; *velocities++ = driftVelocity; }
+      return velocities;
+    }
+
+    /// @}
+    // --- END -- Electric field map -------------------------------------------
+
+    // --- BEGIN -- Plane layout -----------------------------------------------
+    /**
+     * @name Plane layout
+     *
+     * `DataFor()` computes the drift parameters of each plane from a compact
+     * description of the planes of all TPCs (`detinfo::PlaneLayout`), without
+     * accessing the geometry. The layout is passed to the constructor, or
+     * extracted from the geometry on construction if a geometry is provided
+     * instead. It can be replaced at any time,
+     * for example with one read from a file when the geometry service is not
+     * available.
+     */
+    /// @{
+
+    /// Sets the description of the planes used by `DataFor()`.
+    void SetPlaneLayout(PlaneLayout layout) { fPlaneLayout = std::move(layout); }
+
+    /// Returns the description of the planes, `nullptr` if not set.
+    PlaneLayout const* GetPlaneLayout() const { return fPlaneLayout ? &*fPlaneLayout : nullptr; }
+
+    /// @}
+    // --- END -- Plane layout -------------------------------------------------
+
     /// dQ/dX in electrons/cm, returns dE/dX in MeV/cm.
     double BirksCorrection(double dQdX) const override;
     double BirksCorrection(double dQdX, double EField) const override;
@@ -190,6 +417,17 @@ namespace detinfo {
      */
     double ElossVar(double mom, double mass) const override;
 
+    /**
+     * @brief Returns the current material parameters for energy loss formulae
+     * @see `Eloss()`, `ElossVar()`, `detinfo::ElossTable`
+     *
+     * The returned parameters are a snapshot of the current configuration of
+     * this provider and of the LAr properties, and can be used to build a
+     * `detinfo::ElossTable` for fast evaluation of the energy loss of a
+     * specific particle.
+     */
+    ElossMaterialParameters_t ElossMaterialParameters() const;
+
     double
     ElectronsToADC() const override
     {
@@ -234,6 +472,10 @@ namespace detinfo {
 
     DetectorPropertiesData DataFor(detinfo::DetectorClocksData const& clock_data) const override;
 
+    /// Prints the call statistics of the instrumented functions to screen
+    /// (see `lardataalg/DetectorInfo/ProviderInstrumentation.h`).
+    void debugReport() const;
+
   private:
     /**
      * @brief Configures the provider, first validating the configuration
@@ -247,17 +489,86 @@ namespace detinfo {
     void ValidateAndConfigure(fhicl::ParameterSet const& p,
                               std::set<std::string> const& ignore_params);
 
+    /// Constructor: configures the provider with the specified layout.
+    DetectorPropertiesStandard(fhicl::ParameterSet const& pset,
+                               const geo::GeometryCore* geo,
+                               std::optional<PlaneLayout> layout,
+                               const detinfo::LArProperties* lp,
+                               std::set<std::string> const& ignore_params);
+
+    /// Constructor: restores the saved state, with the specified layout.
+    DetectorPropertiesStandard(BlobReader& in,
+                               const geo::GeometryCore* geo,
+                               std::optional<PlaneLayout> layout,
+                               const detinfo::LArProperties* lp);
+
+    /// Returns the missing time offsets of views in the plane layout, if any.
     std::string CheckTimeOffsets(std::set<geo::View_t> const& requested_views) const;
 
-    /// Parameters for Sternheimer density effect corrections
-    struct SternheimerParameters_t {
-      double a;    ///< parameter a
-      double k;    ///< parameter k
-      double x0;   ///< parameter x0
-      double x1;   ///< parameter x1
-      double cbar; ///< parameter Cbar
+    /// Range of validity of the drift velocity parameterization.
+    static constexpr double MaxDriftVelocityEfield = 4.0;       ///< kV/cm
+    static constexpr double MinDriftVelocityTemperature = 87.0; ///< K
+    static constexpr double MaxDriftVelocityTemperature = 94.0; ///< K
+
+    /**
+     * @brief Drift velocity parameterization at a fixed temperature.
+     *
+     * The temperature dependent terms are computed once on construction.
+     * The returned velocity does not include the fudge factor nor the
+     * conversion to cm/us (division by 10).
+     */
+    struct DriftVelocityAtTemperature {
+      // Icarus Parameter Set, use as default
+      static constexpr double P1 = -0.04640; // K^-1
+      static constexpr double P2 = 0.01712;  // K^-1
+      static constexpr double P3 = 1.88125;  // (kV/cm)^-1
+      static constexpr double P4 = 0.99408;  // kV/cm
+      static constexpr double P5 = 0.01172;  // (kV/cm)^-P6
+      static constexpr double P6 = 4.20214;
+      static constexpr double T0 = 105.749; // K
+
+      // Walkowiak Parameter Set
+      static constexpr double P1W = -0.01481; // K^-1
+      static constexpr double P2W = -0.0075;  // K^-1
+      static constexpr double P3W = 0.141;    // (kV/cm)^-1
+      static constexpr double P4W = 12.4;     // kV/cm
+      static constexpr double P5W = 1.627;    // (kV/cm)^-P6
+      static constexpr double P6W = 0.317;
+      static constexpr double T0W = 90.371; // K
+
+      double xFit, uFit;                    ///< Linear regime at small fields.
+      double icarusScale, icarusShift;      ///< Temperature terms, Icarus fit.
+      double walkowiakScale, walkowiakShift; ///< Temperature terms, Walkowiak fit.
+
+      explicit DriftVelocityAtTemperature(double temperature);
+
+      double operator()(double efield) const;
+    };
+
+    /// Emits a single warning if `report` has points out of range.
+    static void ReportDriftVelocityRange(RangeReport_t const& report);
+
+    /// Conversion parameters between drift coordinate and TPC ticks.
+    struct XTicksTable_t {
+      double samplingRate = 0.0;  ///< Sampling rate the table is valid for [ns].
+      double triggerOffset = 0.0; ///< Trigger offset the table is valid for [ticks].
+      double coefficient = 0.0;   ///< Drift distance per tick [cm].
+      std::vector<std::vector<std::vector<double>>> offsets; ///< [c][t][p] (ticks)
+      std::vector<std::vector<double>> directions;           ///< [c][t]
+      DriftParameterTable_t driftParameters;                 ///< [c][t]
     };
 
+    /// Computes the conversion table from the plane layout for the specified timing.
+    XTicksTable_t ComputeXTicksTable(detinfo::DetectorClocksData const& clock_data) const;
+
+    /// Returns the tick offset of `plane` due to drift only (no view offset).
+    static double PlaneXTicksOffset(TPCDriftParameters_t const& params,
+                                    unsigned int plane,
+                                    double triggerOffset);
+
+    /// Parameters for Sternheimer density effect corrections
+    using SternheimerParameters_t = detinfo::SternheimerParameters_t;
+
     // service providers we depend on;
     // in principle could be replaced by a single providerpack_type.
     const detinfo::LArProperties* fLP;
@@ -289,6 +600,15 @@ namespace detinfo {
 
     bool fSimpleBoundary;
 
+    /// Conversion table restored from a saved state, if any.
+    std::optional<XTicksTable_t> fSavedXTicksTable;
+
+    /// Map of the electric field in the drift volume, if any.
+    std::optional<EfieldMap> fEfieldMap;
+
+    /// Description of the planes of all TPCs, if any.
+    std::optional<PlaneLayout> fPlaneLayout;
+
   }; // class DetectorPropertiesStandard
 } // namespace detinfo
 
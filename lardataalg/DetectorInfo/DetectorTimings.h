@@ -56,37 +56,37 @@ namespace detinfo {
 
     // @{
     /// Constructor: uses `detClocks` for internal conversions.
-    explicit DetectorClocksWithUnits(detinfo::DetectorClocksData const* detClocks)
+    constexpr explicit DetectorClocksWithUnits(detinfo::DetectorClocksData const* detClocks)
       : DetectorClocksWithUnits(*detClocks)
     {}
-    explicit DetectorClocksWithUnits(detinfo::DetectorClocksData const& detClocks)
+    constexpr explicit DetectorClocksWithUnits(detinfo::DetectorClocksData const& detClocks)
       : fClockData(detClocks)
     {}
     // @}
 
     /// Returns the detector clocks data object
-    detinfo::DetectorClocksData const&
+    constexpr detinfo::DetectorClocksData const&
     clockData() const
     {
       return fClockData;
     }
 
     /// Equivalent to `detinfo::DetectorClocksData::TriggerTime()`.
-    microsecond
+    constexpr microsecond
     TriggerTime() const
     {
       return microsecond{clockData().TriggerTime()};
     }
 
     /// Equivalent to `detinfo::DetectorClocksData::BeamGateTime()`.
-    microsecond
+    constexpr microsecond
     BeamGateTime() const
     {
       return microsecond{clockData().BeamGateTime()};
     }
 
     /// Equivalent to `detinfo::DetectorClocksData::TPCTime()`.
-    microsecond
+    constexpr microsecond
     TPCTime() const
     {
       return microsecond{clockData().TPCTime()};
@@ -94,12 +94,12 @@ namespace detinfo {
 
     // @{
     /// Equivalent to `detinfo::DetectorClocksData::G4ToElecTime()`.
-    microsecond
+    constexpr microsecond
     G4ToElecTime(nanosecond simTime) const
     {
       return microsecond{clockData().G4ToElecTime(simTime.value())};
     }
-    microsecond
+    constexpr microsecond
     G4ToElecTime(double simTime) const
     {
       return G4ToElecTime(nanosecond{simTime});
@@ -108,12 +108,12 @@ namespace detinfo {
 
     // @{
     /// Equivalent to `detinfo::DetectorClocksData::G4ToElecTime()`.
-    ticks_d
+    constexpr ticks_d
     TPCTick2TDC(ticks_d tpcticks) const
     {
       return ticks_d{clockData().TPCTick2TDC(tpcticks.value())};
     }
-    ticks_d
+    constexpr ticks_d
     TPCTick2TDC(double tpcticks) const
     {
       return TPCTick2TDC(ticks_d{tpcticks});
@@ -122,7 +122,7 @@ namespace detinfo {
 
     /// Equivalent to
     /// `detinfo::DetectorClocksData::OpticalClock().TickPeriod()`.
-    microsecond
+    constexpr microsecond
     OpticalClockPeriod() const
     {
       return microsecond{clockData().OpticalClock().TickPeriod()};
@@ -130,7 +130,7 @@ namespace detinfo {
 
     /// Equivalent to
     /// `detinfo::DetectorClocksData::OpticalClock().TickPeriod()`.
-    megahertz
+    constexpr megahertz
     OpticalClockFrequency() const
     {
       return megahertz{clockData().OpticalClock().Frequency()};
@@ -140,7 +140,7 @@ namespace detinfo {
 
   /// Transforms a `detinfo::DetectorClocksData` into a
   /// `detinfo::DetectorClocksWithUnits`.
-  inline detinfo::DetectorClocksWithUnits
+  constexpr detinfo::DetectorClocksWithUnits
   makeDetectorClocksWithUnits(detinfo::DetectorClocksData const& clockData)
   {
     return detinfo::DetectorClocksWithUnits{clockData};
@@ -245,6 +245,16 @@ namespace detinfo {
    * attempt to convert a time into simulation time ticks will result in a
    * compilation failure.
    *
+   * All the conversions are `constexpr`: when the `detinfo::DetectorClocksData`
+   * object is itself a constant expression (for example the data of one of the
+   * `detinfo::presets`), the timings can be evaluated at compile time:
+   * @code{.cpp}
+   * constexpr detinfo::DetectorClocksData clockData
+   *   = detinfo::presets::StandardClocks.data();
+   * constexpr detinfo::DetectorTimings timings{ clockData };
+   * static_assert(timings.TriggerTime() == timings.BeamGateTime());
+   * @endcode
+   *
    */
   class DetectorTimings : private detinfo::DetectorClocksWithUnits {
 
@@ -294,10 +304,10 @@ namespace detinfo {
     // note that `makeDetectorTimings()` provides an additional construction way
     // @{
     /// Constructor: wraps around a specified `detinfo::DetectorClocksData` object.
-    explicit DetectorTimings(detinfo::DetectorClocksData const& clockData)
+    constexpr explicit DetectorTimings(detinfo::DetectorClocksData const& clockData)
       : detinfo::DetectorClocksWithUnits(clockData)
     {}
-    explicit DetectorTimings(detinfo::DetectorClocksData const* clockData)
+    constexpr explicit DetectorTimings(detinfo::DetectorClocksData const* clockData)
       : detinfo::DetectorClocksWithUnits(clockData)
     {}
     // @}
@@ -307,14 +317,14 @@ namespace detinfo {
     /// @{
 
     /// Returns a DetectorClocksWithUnits object.
-    detinfo::DetectorClocksWithUnits const&
+    constexpr detinfo::DetectorClocksWithUnits const&
     detClocksUnits() const
     {
       return static_cast<detinfo::DetectorClocksWithUnits const&>(*this);
     }
 
     /// Returns the detector clocks data.
-    detinfo::DetectorClocksData const&
+    constexpr detinfo::DetectorClocksData const&
     clockData() const
     {
       return detClocksUnits().clockData();
@@ -327,7 +337,7 @@ namespace detinfo {
 
     /// Returns the trigger time as a point in electronics time.
     /// @see `detinfo::DetectorClocksData::TriggerTime()`
-    electronics_time
+    constexpr electronics_time
     TriggerTime() const
     {
       return electronics_time{detClocksUnits().TriggerTime()};
@@ -335,7 +345,7 @@ namespace detinfo {
 
     /// Returns the beam gate time as a point in electronics time.
     /// @see `detinfo::DetectorClocksData::BeamGateTime()`
-    electronics_time
+    constexpr electronics_time
     BeamGateTime() const
     {
       return electronics_time{detClocksUnits().TriggerTime()};
@@ -363,7 +373,7 @@ namespace detinfo {
      * is equivalent to use `detinfo::DetectorClocksData::G4ToElecTime(47.5)`.
      */
     template <typename TargetTime, typename FromTime>
-    TargetTime toTimeScale(FromTime time) const;
+    constexpr TargetTime toTimeScale(FromTime time) const;
 
     /**
      * @brief Returns a `time` point as a tick on a different time scale.
@@ -380,7 +390,7 @@ namespace detinfo {
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
      */
     template <typename TargetTick, typename FromTime>
-    TargetTick toTick(FromTime time) const;
+    constexpr TargetTick toTick(FromTime time) const;
 
     /**
      * @brief Returns the number of ticks corresponding to a `time` interval.
@@ -393,7 +403,7 @@ namespace detinfo {
      * usually truncated.
      */
     template <typename Ticks>
-    Ticks
+    constexpr Ticks
     toTicks(time_interval time) const
     {
       return Ticks::castFrom(time / ClockPeriodFor<Ticks>());
@@ -413,7 +423,7 @@ namespace detinfo {
      * is equivalent to use `detinfo::DetectorClocksData::G4ToElecTime(47.5)`.
      */
     template <typename FromTime>
-    electronics_time
+    constexpr electronics_time
     toElectronicsTime(FromTime time) const
     {
       return toTimeScale<electronics_time>(time);
@@ -433,7 +443,7 @@ namespace detinfo {
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
      */
     template <typename FromTime>
-    electronics_tick_d
+    constexpr electronics_tick_d
     toElectronicsTickD(FromTime time) const
     {
       return toTick<electronics_tick_d>(time);
@@ -453,7 +463,7 @@ namespace detinfo {
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
      */
     template <typename FromTime>
-    electronics_tick
+    constexpr electronics_tick
     toElectronicsTick(FromTime time) const
     {
       return toTick<electronics_tick>(time);
@@ -472,7 +482,7 @@ namespace detinfo {
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
      */
     template <typename FromTime>
-    trigger_time
+    constexpr trigger_time
     toTriggerTime(FromTime time) const
     {
       return toTimeScale<trigger_time>(time);
@@ -491,7 +501,7 @@ namespace detinfo {
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
      */
     template <typename FromTime>
-    simulation_time
+    constexpr simulation_time
     toSimulationTime(FromTime time) const
     {
       return toTimeScale<simulation_time>(time);
@@ -506,11 +516,11 @@ namespace detinfo {
 
     /// Returns the electronics clock for the specified time scale.
     template <typename TimeScale>
-    detinfo::ElecClock const& ClockFor() const;
+    constexpr detinfo::ElecClock const& ClockFor() const;
 
     /// Returns the period of the clock for the specified time scale.
     template <typename TimeScale>
-    time_interval_for<TimeScale>
+    constexpr time_interval_for<TimeScale>
     ClockPeriodFor() const
     {
       return time_interval_for<TimeScale>{microsecond{ClockFor<TimeScale>().TickPeriod()}};
@@ -518,7 +528,7 @@ namespace detinfo {
 
     /// Returns the frequency of the clock for the specified time scale.
     template <typename TimeScale>
-    frequency_for<TimeScale>
+    constexpr frequency_for<TimeScale>
     ClockFrequencyFor() const
     {
       return frequency_for<TimeScale>{megahertz{ClockFor<TimeScale>().Frequency()}};
@@ -529,14 +539,14 @@ namespace detinfo {
     // --- BEGIN -- Optical clock ----------------------------------------------
 
     /// Returns the duration of the optical clock period and tick.
-    auto
+    constexpr auto
     OpticalClockPeriod() const
     {
       return ClockPeriodFor<optical_time>();
     }
 
     /// Returns the frequency of the optical clock tick.
-    megahertz
+    constexpr megahertz
     OpticalClockFrequency() const
     {
       return ClockFrequencyFor<optical_time>();
@@ -553,7 +563,7 @@ namespace detinfo {
      * the resulting number of ticks is usually truncated.
      */
     template <typename Ticks = optical_time_ticks>
-    Ticks
+    constexpr Ticks
     toOpticalTicks(time_interval time) const
     {
       static_assert(traits_of<Ticks>::template same_category_as<optical_tick>,
@@ -574,7 +584,7 @@ namespace detinfo {
      * The number of ticks is *truncated*.
      */
     template <typename TimePoint>
-    optical_tick
+    constexpr optical_tick
     toOpticalTick(TimePoint time) const
     {
       return toTick<optical_tick>(time);
@@ -593,7 +603,7 @@ namespace detinfo {
      * The number of ticks may be fractional.
      */
     template <typename TimePoint>
-    optical_tick_d
+    constexpr optical_tick_d
     toOpticalTickD(TimePoint time) const
     {
       return toTick<optical_tick_d>(time);
@@ -614,7 +624,7 @@ namespace detinfo {
      * duration is the same as the value of the `time` point (i.e. the start
      * time is 0).
      */
-    time_interval fromStart(electronics_time time) const;
+    constexpr time_interval fromStart(electronics_time time) const;
 
     /**
      * @brief Returns the start time of the specified time scale.
@@ -687,14 +697,14 @@ namespace detinfo {
     // --- END -- Reference times ----------------------------------------------
 
   private:
-    friend detinfo::DetectorTimings makeDetectorTimings
+    friend constexpr detinfo::DetectorTimings makeDetectorTimings
       (detinfo::DetectorClocksWithUnits const&);
 
   }; // class DetectorTimings
 
   /// Returns `DetectorTimings` object from specified
   /// `detinfo::DetectorClocksData`.
-  inline detinfo::DetectorTimings
+  constexpr detinfo::DetectorTimings
   makeDetectorTimings(detinfo::DetectorClocksData const& detClocks)
   {
     return detinfo::DetectorTimings{detClocks};
@@ -702,7 +712,7 @@ namespace detinfo {
 
   /// Returns `DetectorTimings` object from specified
   /// `detinfo::DetectorClocksData`.
-  inline detinfo::DetectorTimings
+  constexpr detinfo::DetectorTimings
   makeDetectorTimings(detinfo::DetectorClocksData const* detClocks)
   {
     return makeDetectorTimings(*detClocks);
@@ -710,7 +720,7 @@ namespace detinfo {
 
   /// Returns `DetectorTimings` object from specified
   /// `detinfo::DetectorClocksWithUnits`.
-  inline detinfo::DetectorTimings
+  constexpr detinfo::DetectorTimings
   makeDetectorTimings(detinfo::DetectorClocksWithUnits const& detClocksWU)
   {
     return static_cast<detinfo::DetectorTimings const&>(detClocksWU);
@@ -765,7 +775,7 @@ namespace detinfo {
     struct StartTimeImpl<detinfo::timescales::TPCelectronics_time, // source
                          detinfo::timescales::electronics_time     // destination
                          > {
-      static detinfo::timescales::electronics_time
+      static constexpr detinfo::timescales::electronics_time
       startTime(DetectorTimings const* detTiming)
       {
         return detinfo::timescales::electronics_time(detTiming->detClocksUnits().TPCTime());
@@ -791,7 +801,7 @@ namespace detinfo {
     struct StartTimeImpl<detinfo::timescales::simulation_time, // source
                          detinfo::timescales::electronics_time // destination
                          > {
-      static detinfo::timescales::electronics_time
+      static constexpr detinfo::timescales::electronics_time
       startTime(DetectorTimings const* detTiming)
       {
         return detinfo::timescales::electronics_time{
@@ -805,7 +815,7 @@ namespace detinfo {
     struct StartTimeImpl<detinfo::timescales::trigger_time,    // scale to convert the start of
                          detinfo::timescales::electronics_time // destination scale
                          > {
-      static detinfo::timescales::electronics_time
+      static constexpr detinfo::timescales::electronics_time
       startTime(DetectorTimings const* detTiming)
       {
         return detTiming->TriggerTime();
@@ -821,7 +831,7 @@ namespace detinfo {
       detinfo::timescales::electronics_time, // source
       TimeScale,                             // destination
       std::enable_if_t<!std::is_same_v<TimeScale, detinfo::timescales::electronics_time>>> {
-      static TimeScale
+      static constexpr TimeScale
       startTime(DetectorTimings const* detTiming)
       {
         return TimeScale{
@@ -849,7 +859,7 @@ namespace detinfo {
       std::enable_if_t<!std::is_same_v<TimePoint, detinfo::timescales::electronics_time> &&
                        !std::is_same_v<TimeScale, detinfo::timescales::electronics_time> &&
                        !std::is_same_v<TimeScale, TimePoint>>> {
-      static TimeScale
+      static constexpr TimeScale
       startTime(DetectorTimings const* detTiming)
       {
         return detTiming->toTimeScale<TimeScale>(detTiming->startTime<TimePoint>());
@@ -879,7 +889,7 @@ namespace detinfo {
     struct StartTickImpl<detinfo::timescales::TPCelectronics_tick_d, // source
                          detinfo::timescales::electronics_tick_d     // destination
                          > {
-      static detinfo::timescales::electronics_tick_d
+      static constexpr detinfo::timescales::electronics_tick_d
       startTick(DetectorTimings const* detTiming)
       {
         return detinfo::timescales::electronics_tick_d(
@@ -907,7 +917,7 @@ namespace detinfo {
     template <typename FromTime, typename TargetTime, typename = void>
     struct TimeScaleConverter {
 
-      static TargetTime
+      static constexpr TargetTime
       convert(FromTime time, DetectorTimings const* timings)
       {
         return timings->startTime<FromTime, TargetTime>() + time.quantity();
@@ -918,7 +928,7 @@ namespace detinfo {
     template <typename TargetTime>
     struct TimeScaleConverter<TargetTime, TargetTime> {
 
-      static TargetTime
+      static constexpr TargetTime
       convert(TargetTime time, DetectorTimings const*)
       {
         return time;
@@ -932,7 +942,7 @@ namespace detinfo {
                               TargetTime,
                               std::enable_if_t<detinfo::timescales::is_tick_v<FromTick>>> {
 
-      static TargetTime
+      static constexpr TargetTime
       convert(FromTick tick, DetectorTimings const* timings)
       {
         using FromTime = typename detinfo::timescales::timescale_traits<
@@ -949,7 +959,7 @@ namespace detinfo {
     struct TickConverter {
 
 
-      static TargetTick convert
+      static constexpr TargetTick convert
       (FromTime time, DetectorTimings const* timings)
       {
         // dispatcher
@@ -960,7 +970,7 @@ namespace detinfo {
       } // convert()
 
 
-      static TargetTick
+      static constexpr TargetTick
       convertTime(FromTime time, DetectorTimings const* timings)
       {
         static_assert(!detinfo::timescales::is_tick_v<FromTime>);
@@ -971,7 +981,7 @@ namespace detinfo {
         return TargetTick::castFrom(timeFromStart / clockPeriod);
       } // convertTime()
 
-      static TargetTick
+      static constexpr TargetTick
       convertTick(FromTime tick, DetectorTimings const* timings)
       {
         static_assert(detinfo::timescales::is_tick_v<FromTime>);
@@ -1006,7 +1016,7 @@ namespace detinfo {
 
     template <>
     struct ClockForImpl<detinfo::timescales::TPCelectronicsTimeCategory> {
-      static detinfo::ElecClock const&
+      static constexpr detinfo::ElecClock const&
       get(DetectorTimings const* timings)
       {
         return timings->clockData().TPCClock();
@@ -1015,7 +1025,7 @@ namespace detinfo {
 
     template <>
     struct ClockForImpl<detinfo::timescales::OpticalTimeCategory> {
-      static detinfo::ElecClock const&
+      static constexpr detinfo::ElecClock const&
       get(DetectorTimings const* timings)
       {
         return timings->clockData().OpticalClock();
@@ -1024,7 +1034,7 @@ namespace detinfo {
 
     template <>
     struct ClockForImpl<detinfo::timescales::TriggerTimeCategory> {
-      static detinfo::ElecClock const&
+      static constexpr detinfo::ElecClock const&
       get(DetectorTimings const* timings)
       {
         return timings->clockData().TriggerClock();
@@ -1057,7 +1067,7 @@ namespace detinfo {
 
   // ---------------------------------------------------------------------------
   template <typename TargetTime, typename FromTime>
-  TargetTime
+  constexpr TargetTime
   DetectorTimings::toTimeScale(FromTime time) const
   {
     return details::TimeScaleConverter<FromTime, TargetTime>::convert(time, this);
@@ -1065,7 +1075,7 @@ namespace detinfo {
 
   // ---------------------------------------------------------------------------
   template <typename TargetTick, typename FromTime>
-  TargetTick
+  constexpr TargetTick
   DetectorTimings::toTick(FromTime time) const
   {
     return details::TickConverter<FromTime, TargetTick>::convert(time, this);
@@ -1073,14 +1083,14 @@ namespace detinfo {
 
   // ---------------------------------------------------------------------------
   template <typename TimeScale>
-  detinfo::ElecClock const&
+  constexpr detinfo::ElecClock const&
   DetectorTimings::ClockFor() const
   {
     return details::ClockForImpl<TimeScale>::get(this);
   }
 
   // ---------------------------------------------------------------------------
-  inline auto
+  constexpr auto
   DetectorTimings::fromStart(electronics_time time) const -> time_interval
   {
     return time - startTime<electronics_time, electronics_time>();
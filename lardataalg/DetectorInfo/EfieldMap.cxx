@@ -0,0 +1,107 @@
+/**
+ * @file   lardataalg/DetectorInfo/EfieldMap.cxx
+ * @brief  Electric field magnitude sampled on a regular 3D grid.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/EfieldMap.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/EfieldMap.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <cmath> // std::floor()
+#include <stdexcept> // std::domain_error
+#include <string> // std::to_string()
+
+
+namespace {
+
+  /// Position of `coord` along one axis: lower point index and fraction.
+  struct AxisPosition_t {
+    std::size_t index; ///< Index of the lower point.
+    std::size_t next; ///< Index of the upper point (same as `index` if none).
+    double fraction; ///< Relative distance from the lower point.
+  }; // AxisPosition_t
+
+  AxisPosition_t locate
+    (double coord, double origin, double invStep, std::size_t nPoints)
+  {
+    if (nPoints < 2U) return { 0U, 0U, 0.0 };
+    double const pos = (coord - origin) * invStep;
+    if (!(pos > 0.0)) return { 0U, 0U, 0.0 }; // also catches NaN
+    double const last = static_cast<double>(nPoints - 1U);
+    if (pos >= last) return { nPoints - 1U, nPoints - 1U, 0.0 };
+    // protect against rounding at the upper edge of the grid
+    auto const i = std::min(static_cast<std::size_t>(pos), nPoints - 2U);
+    return { i, i + 1U, pos - static_cast<double>(i) };
+  } // locate()
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+detinfo::EfieldMap::EfieldMap(Grid_t const& grid, std::vector<double> efields)
+  : fGrid(grid), fEfields(std::move(efields))
+{
+  for (std::size_t axis = 0; axis < 3U; ++axis) {
+    if (fGrid.nPoints[axis] == 0U) {
+      throw std::domain_error
+        ("EfieldMap: no grid points on axis " + std::to_string(axis));
+    }
+    if (!(fGrid.step[axis] > 0.0)) {
+      throw std::domain_error("EfieldMap: invalid grid step "
+        + std::to_string(fGrid.step[axis]) + " on axis " + std::to_string(axis));
+    }
+    fInvStep[axis] = 1.0 / fGrid.step[axis];
+  } // for
+
+  if (fEfields.size() != fGrid.size()) {
+    throw std::domain_error("EfieldMap: " + std::to_string(fEfields.size())
+      + " field values for " + std::to_string(fGrid.size()) + " grid points");
+  }
+} // detinfo::EfieldMap::EfieldMap()
+
+
+//------------------------------------------------------------------------------
+std::vector<double> const& detinfo::EfieldMap::driftVelocities() const {
+  if (!HasDriftVelocities()) {
+    throw std::logic_error
+      ("EfieldMap: drift velocities requested before being computed");
+  }
+  return fDriftVelocities;
+} // detinfo::EfieldMap::driftVelocities()
+
+
+//------------------------------------------------------------------------------
+double detinfo::EfieldMap::interpolate
+  (std::vector<double> const& values, double x, double y, double z) const
+{
+  AxisPosition_t const px
+    = locate(x, fGrid.origin[0], fInvStep[0], fGrid.nPoints[0]);
+  AxisPosition_t const py
+    = locate(y, fGrid.origin[1], fInvStep[1], fGrid.nPoints[1]);
+  AxisPosition_t const pz
+    = locate(z, fGrid.origin[2], fInvStep[2], fGrid.nPoints[2]);
+
+  // interpolate along z on the four edges, then along y and x
+  auto alongZ = [&values, &pz, this](std::size_t ix, std::size_t iy)
+    {
+      double const low = values[fGrid.index(ix, iy, pz.index)];
+      double const high = values[fGrid.index(ix, iy, pz.next)];
+      return low + pz.fraction * (high - low);
+    };
+  auto alongYZ = [&alongZ, &py](std::size_t ix)
+    {
+      double const low = alongZ(ix, py.index);
+      double const high = alongZ(ix, py.next);
+      return low + py.fraction * (high - low);
+    };
+  double const low = alongYZ(px.index);
+  double const high = alongYZ(px.next);
+  return low + px.fraction * (high - low);
+
+} // detinfo::EfieldMap::interpolate()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,198 @@
+/**
+ * @file   lardataalg/DetectorInfo/EfieldMap.h
+ * @brief  Electric field magnitude sampled on a regular 3D grid.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/EfieldMap.cxx
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_EFIELDMAP_H
+#define LARDATAALG_DETECTORINFO_EFIELDMAP_H
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <stdexcept> // std::logic_error
+#include <utility> // std::move()
+#include <vector>
+
+
+namespace detinfo {
+
+  /**
+   * @brief Magnitude of the electric field on a regular grid of voxels.
+   *
+   * The field magnitude [kV/cm] is sampled at the points of a regular grid in
+   * detector coordinates, and it is trilinearly interpolated between them.
+   * Positions outside the grid are assigned the value at the closest point of
+   * the grid boundary.
+   *
+   * The map can also hold the drift velocity at the same grid points: it is
+   * computed once by `BuildDriftVelocities()` from the field values, and
+   * interpolated in the same way as the field. This spares the evaluation of
+   * the drift velocity parameterization at each query.
+   *
+   * Example of usage with a `DetectorPropertiesStandard` provider `detProp`:
+   *
+   *     detinfo::EfieldMap map{ grid, std::move(efields) };
+   *     detProp.SetEfieldMap(std::move(map)); // builds the drift velocities
+   *
+   *     double const vd = detProp.GetEfieldMap()->DriftVelocity(x, y, z);
+   *
+   */
+  class EfieldMap {
+      public:
+
+    /// Definition of the sampling grid.
+    struct Grid_t {
+      std::array<double, 3U> origin; ///< Position of the first point [cm].
+      std::array<double, 3U> step; ///< Distance between points [cm].
+      std::array<std::size_t, 3U> nPoints; ///< Number of points on each axis.
+
+      /// Returns the total number of points in the grid.
+      std::size_t size() const { return nPoints[0] * nPoints[1] * nPoints[2]; }
+
+      /// Returns the index of the value at the specified grid point.
+      std::size_t index(std::size_t ix, std::size_t iy, std::size_t iz) const
+        { return (ix * nPoints[1] + iy) * nPoints[2] + iz; }
+
+    }; // Grid_t
+
+    /**
+     * @brief Constructor: uses the specified field values.
+     * @param grid the sampling grid
+     * @param efields the magnitude of the field at each grid point [kV/cm]
+     * @throw std::domain_error if the grid is not valid
+     *
+     * Values are sorted with the _z_ coordinate running fastest
+     * (see `Grid_t::index()`). The grid needs at least one point per axis and
+     * positive steps, and `efields` must have one value per point.
+     */
+    EfieldMap(Grid_t const& grid, std::vector<double> efields);
+
+    /// Returns the definition of the sampling grid.
+    Grid_t const& Grid() const { return fGrid; }
+
+    /// Returns the field magnitude at the grid points [kV/cm].
+    std::vector<double> const& Efields() const { return fEfields; }
+
+    /// Returns the interpolated field magnitude at a position [kV/cm].
+    double Efield(double x, double y, double z) const
+      { return interpolate(fEfields, x, y, z); }
+
+    /// Returns the interpolated field magnitude at point `pos` [kV/cm].
+    /// @tparam Point a type with `X()`, `Y()` and `Z()` (e.g. `geo::Point_t`)
+    template <typename Point>
+    double Efield(Point const& pos) const
+      { return Efield(pos.X(), pos.Y(), pos.Z()); }
+
+    /**
+     * @brief Computes the field magnitude for a sequence of points.
+     * @tparam BIter type of iterator to the input points
+     * @tparam EIter type of end iterator to the input points
+     * @tparam OIter type of output iterator
+     * @param begin iterator to the first point
+     * @param end iterator past the last point
+     * @param efields iterator to the first output element [kV/cm]
+     * @return the output iterator past the last written element
+     */
+    template <typename BIter, typename EIter, typename OIter>
+    OIter Efields(BIter begin, EIter end, OIter efields) const;
+
+
+    // --- BEGIN -- Drift velocity ---------------------------------------------
+    /// @name Drift velocity
+    /// @{
+
+    /**
+     * @brief Computes the drift velocity at all the grid points.
+     * @tparam DriftVelocityFunc type of the drift velocity parameterization
+     * @param driftVelocity called with a field magnitude [kV/cm] to return the
+     *                      drift velocity [cm/us]
+     *
+     * Any previously computed drift velocity is replaced.
+     */
+    template <typename DriftVelocityFunc>
+    void BuildDriftVelocities(DriftVelocityFunc&& driftVelocity);
+
+    /// Returns whether the drift velocities have been computed.
+    bool HasDriftVelocities() const { return !fDriftVelocities.empty(); }
+
+    /// Returns the drift velocity at the grid points [cm/us].
+    std::vector<double> const& DriftVelocities() const { return fDriftVelocities; }
+
+    /// Returns the interpolated drift velocity at a position [cm/us].
+    /// @throw std::logic_error if `BuildDriftVelocities()` was not called
+    double DriftVelocity(double x, double y, double z) const
+      { return interpolate(driftVelocities(), x, y, z); }
+
+    /// Returns the interpolated drift velocity at point `pos` [cm/us].
+    template <typename Point>
+    double DriftVelocity(Point const& pos) const
+      { return DriftVelocity(pos.X(), pos.Y(), pos.Z()); }
+
+    /// Computes the drift velocity for a sequence of points [cm/us].
+    /// @see `Efields(BIter, EIter, OIter)`
+    template <typename BIter, typename EIter, typename OIter>
+    OIter DriftVelocities(BIter begin, EIter end, OIter velocities) const;
+
+    /// @}
+    // --- END -- Drift velocity -----------------------------------------------
+
+
+      private:
+
+    Grid_t fGrid; ///< Sampling grid.
+    std::array<double, 3U> fInvStep; ///< Inverse of the grid steps.
+    std::vector<double> fEfields; ///< Field magnitude at the grid points.
+    std::vector<double> fDriftVelocities; ///< Drift velocity at the grid points.
+
+    /// Returns the drift velocities, throwing if not available.
+    std::vector<double> const& driftVelocities() const;
+
+    /// Trilinear interpolation of `values` (one per grid point) at a position.
+    double interpolate
+      (std::vector<double> const& values, double x, double y, double z) const;
+
+  }; // class EfieldMap
+
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename BIter, typename EIter, typename OIter>
+OIter detinfo::EfieldMap::Efields(BIter begin, EIter end, OIter efields) const {
+  while (begin != end) *efields++ = Efield(*begin++);
+  return efields;
+} // detinfo::EfieldMap::Efields()
+
+
+//------------------------------------------------------------------------------
+template <typename DriftVelocityFunc>
+void detinfo::EfieldMap::BuildDriftVelocities(DriftVelocityFunc&& driftVelocity) {
+  std::vector<double> velocities;
+  velocities.reserve(fEfields.size());
+  for (double const efield: fEfields) velocities.push_back(driftVelocity(efield));
+  fDriftVelocities = std::move(velocities);
+} // detinfo::EfieldMap::BuildDriftVelocities()
+
+
+//------------------------------------------------------------------------------
+template <typename BIter, typename EIter, typename OIter>
+OIter detinfo::EfieldMap::DriftVelocities
+  (BIter begin, EIter end, OIter velocities) const
+{
+  std::vector<double> const& values = driftVelocities();
+  while (begin != end) {
+    auto const& pos = *begin++;
+    *velocities++ = interpolate(values, pos.X(), pos.Y(), pos.Z());
+  }
+  return velocities;
+} // detinfo::EfieldMap::DriftVelocities()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAALG_DETECTORINFO_EFIELDMAP_H
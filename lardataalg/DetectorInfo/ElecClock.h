@@ -95,9 +95,12 @@ namespace detinfo {
      * @param time starting time of the clock [&micro;s]
      * @param frame_period period of the clock [&micro;s]
      * @param frequency clock frequency [MHz]
+     * @throw detinfo::DetectorClocksException if `frequency` is not positive
      *
+     * In a constant expression, a frequency which is not positive is a
+     * compilation error.
      */
-    ElecClock(double const time, double const frame_period, double const frequency)
+    constexpr ElecClock(double const time, double const frame_period, double const frequency)
       : ElecClock{time, frame_period, frequency, std::nothrow}
     {
       if (fFrequency <= 0)
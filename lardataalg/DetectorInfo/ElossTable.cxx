@@ -0,0 +1,234 @@
+/**
+ * @file   lardataalg/DetectorInfo/ElossTable.cxx
+ * @brief  Tabulated Bethe-Bloch restricted energy loss for a fixed particle.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ElossTable.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/ElossTable.h"
+
+// framework libraries
+#include "cetlib/pow.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <cmath> // std::sqrt(), std::log(), std::log10(), std::pow(), ...
+#include <stdexcept> // std::domain_error, std::runtime_error
+#include <string> // std::to_string()
+
+
+namespace {
+
+  // Some constants.
+  constexpr double K = 0.307075;     // 4 pi N_A r_e^2 m_e c^2 (MeV cm^2/mol).
+  constexpr double me = 0.510998918; // Electron mass (MeV/c^2).
+
+  /// Largest number of points a table is allowed to grow to.
+  constexpr std::size_t MaxTablePoints = 1U << 20;
+
+  /// Interpolation is checked at `CheckSamplesPerBin - 1` points in each bin.
+  constexpr unsigned int CheckSamplesPerBin = 16U;
+
+} // local namespace
+
+
+//----------------------------------------------------------------------------------
+// Restricted mean energy loss (dE/dx) in units of MeV/cm.
+//
+// Based on Bethe-Bloch formula as contained in particle data book.
+// Material parameters (stored in larproperties.fcl) are taken from
+// pdg web site http://pdg.lbl.gov/AtomicNuclearProperties/
+//
+double
+detinfo::RestrictedEloss(ElossMaterialParameters_t const& material,
+                         double const mom,
+                         double const mass,
+                         double tcut)
+{
+  // Calculate kinematic quantities.
+  double const bg = mom / mass;            // beta*gamma.
+  double const gamma = sqrt(1. + bg * bg); // gamma.
+  double const beta = bg / gamma;          // beta (velocity).
+  double const mer = 0.001 * me / mass;    // electron mass / mass of incident particle.
+  double const tmax =
+    2. * me * bg * bg / (1. + 2. * gamma * mer + mer * mer); // Maximum delta ray energy (MeV).
+
+  // Make sure tcut does not exceed tmax.
+  if (tcut == 0. || tcut > tmax) tcut = tmax;
+
+  // Calculate density effect correction (delta).
+  SternheimerParameters_t const& sternheimer = material.sternheimer;
+  double const x = std::log10(bg);
+  double delta = 0.;
+  if (x >= sternheimer.x0) {
+    delta = 2. * std::log(10.) * x - sternheimer.cbar;
+    if (x < sternheimer.x1) delta += sternheimer.a * std::pow(sternheimer.x1 - x, sternheimer.k);
+  }
+
+  // Calculate stopping number.
+  double B =
+    0.5 * std::log(2. * me * bg * bg * tcut / (1.e-12 * cet::square(material.excitationEnergy))) -
+    0.5 * beta * beta * (1. + tcut / tmax) - 0.5 * delta;
+
+  // Don't let the stopping number become negative.
+  if (B < 1.) B = 1.;
+
+  // Calculate dE/dx.
+  return material.density * K * material.atomicNumber * B /
+         (material.atomicMass * beta * beta);
+} // detinfo::RestrictedEloss()
+
+
+//----------------------------------------------------------------------------------
+double
+detinfo::ElossVariance(ElossMaterialParameters_t const& material,
+                       double const mom,
+                       double const mass)
+{
+  // Calculate kinematic quantities.
+  double const bg = mom / mass;          // beta*gamma.
+  double const gamma2 = 1. + bg * bg;    // gamma^2.
+  double const beta2 = bg * bg / gamma2; // beta^2.
+  return gamma2 * (1. - 0.5 * beta2) * me * (material.atomicNumber / material.atomicMass) * K *
+         material.density;
+} // detinfo::ElossVariance()
+
+
+//----------------------------------------------------------------------------------
+//---  detinfo::ElossTable
+//----------------------------------------------------------------------------------
+detinfo::ElossTable::ElossTable(ElossMaterialParameters_t const& material,
+                                double const mass,
+                                double const tcut,
+                                double const tolerance,
+                                double const minBetaGamma,
+                                double const maxBetaGamma)
+  : fMaterial(material)
+  , fMass(mass)
+  , fInvMass(1.0 / mass)
+  , fTcut(tcut)
+  , fMinBetaGamma(minBetaGamma)
+  , fMaxBetaGamma(maxBetaGamma)
+  , fLogMinBetaGamma(std::log(minBetaGamma))
+  , fInvStep(0.0)
+  // ElossVariance() is (1 + bg^2/2) times its value at rest:
+  , fVarScale(ElossVariance(material, 0.0, 1.0))
+{
+  if (!(mass > 0.0)) {
+    throw std::domain_error(
+      "detinfo::ElossTable: invalid particle mass " + std::to_string(mass) + " GeV/c^2");
+  }
+  if (!(minBetaGamma > 0.0) || !(maxBetaGamma > minBetaGamma)) {
+    throw std::domain_error("detinfo::ElossTable: invalid beta gamma range [ " +
+                            std::to_string(minBetaGamma) + " ; " +
+                            std::to_string(maxBetaGamma) + " ]");
+  }
+  if (!(tolerance > 0.0)) {
+    throw std::domain_error(
+      "detinfo::ElossTable: invalid tolerance " + std::to_string(tolerance));
+  }
+
+  // start with about 16 points per e-fold, then keep doubling the density
+  double const logRange = std::log(maxBetaGamma) - fLogMinBetaGamma;
+  std::size_t nPoints = static_cast<std::size_t>(std::ceil(logRange * 16.0)) + 1;
+  while (true) {
+    fill(nPoints);
+    fMaxRelError = checkInterpolation();
+    if (fMaxRelError <= tolerance) break;
+    if (nPoints >= MaxTablePoints) {
+      throw std::runtime_error(
+        "detinfo::ElossTable: relative tolerance " + std::to_string(tolerance) +
+        " not achieved with " + std::to_string(nPoints) + " points (error: " +
+        std::to_string(fMaxRelError) + ")");
+    }
+    nPoints = 2 * nPoints - 1; // the old points are kept
+  } // while
+
+} // detinfo::ElossTable::ElossTable()
+
+
+//----------------------------------------------------------------------------------
+void
+detinfo::ElossTable::fill(std::size_t const nPoints)
+{
+  double const step = (std::log(fMaxBetaGamma) - fLogMinBetaGamma) / (nPoints - 1);
+  fInvStep = 1.0 / step;
+
+  fValues.resize(nPoints);
+  for (std::size_t i = 0; i < nPoints; ++i)
+    fValues[i] = exactEloss(std::exp(fLogMinBetaGamma + i * step));
+
+} // detinfo::ElossTable::fill()
+
+
+//----------------------------------------------------------------------------------
+double
+detinfo::ElossTable::checkInterpolation() const
+{
+  double const step = 1.0 / fInvStep;
+  auto const relError = [this, step](double const pos) {
+    double const exact = exactEloss(std::exp(fLogMinBetaGamma + pos * step));
+    return std::abs(interpolate(pos) - exact) / exact;
+  };
+
+  double maxError = 0.0;
+  for (std::size_t i = 0; i + 1 < fValues.size(); ++i) {
+    for (unsigned int k = 1; k < CheckSamplesPerBin; ++k) {
+      double const pos = static_cast<double>(i) + static_cast<double>(k) / CheckSamplesPerBin;
+      maxError = std::max(maxError, relError(pos));
+    } // for test points
+  }   // for bins
+
+  // the formula is not smooth at these points, where interpolation is worst
+  for (double const pos : kinkPositions())
+    maxError = std::max(maxError, relError(pos));
+
+  return maxError;
+} // detinfo::ElossTable::checkInterpolation()
+
+
+//----------------------------------------------------------------------------------
+std::vector<double>
+detinfo::ElossTable::kinkPositions() const
+{
+  std::vector<double> logBetaGammas;
+
+  // Sternheimer density correction switches on at x0 and changes form at x1
+  // (x = log10(beta gamma))
+  SternheimerParameters_t const& sternheimer = fMaterial.sternheimer;
+  logBetaGammas.push_back(sternheimer.x0 * std::log(10.));
+  logBetaGammas.push_back(sternheimer.x1 * std::log(10.));
+
+  // the delta ray cut becomes effective where the maximum delta ray energy
+  // reaches it; the maximum energy grows with beta gamma, so bisect
+  if (fTcut > 0.0) {
+    double const mer = 0.001 * me / fMass;
+    auto const tmax = [mer](double const bg) {
+      double const gamma = std::sqrt(1. + bg * bg);
+      return 2. * me * bg * bg / (1. + 2. * gamma * mer + mer * mer);
+    };
+    double low = fLogMinBetaGamma;
+    double high = std::log(fMaxBetaGamma);
+    if ((tmax(std::exp(low)) < fTcut) && (tmax(std::exp(high)) > fTcut)) {
+      for (unsigned int iter = 0; iter < 64; ++iter) {
+        double const middle = 0.5 * (low + high);
+        (tmax(std::exp(middle)) < fTcut ? low : high) = middle;
+      }
+      logBetaGammas.push_back(low);
+      logBetaGammas.push_back(high);
+    }
+  }
+
+  // convert into table positions, keeping only the ones in the table
+  double const maxPos = static_cast<double>(fValues.size() - 1);
+  std::vector<double> positions;
+  for (double const logBG : logBetaGammas) {
+    double const pos = (logBG - fLogMinBetaGamma) * fInvStep;
+    if ((pos >= 0.0) && (pos <= maxPos)) positions.push_back(pos);
+  }
+  return positions;
+} // detinfo::ElossTable::kinkPositions()
+
+
+//----------------------------------------------------------------------------------
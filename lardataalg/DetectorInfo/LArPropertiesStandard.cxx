@@ -6,6 +6,8 @@
 
 // LArSoft includes
 #include "lardataalg/DetectorInfo/LArPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
 #include "larcorealg/CoreUtils/ProviderUtil.h" // lar::IgnorableProviderConfigKeys()
 
 // ROOT includes
@@ -17,6 +19,10 @@
 #include "fhiclcpp/ParameterSet.h"
 #include "fhiclcpp/types/Table.h"
 
+// C/C++ standard libraries
+#include <iostream> // std::cout
+#include <type_traits> // std::is_base_of_v
+
 //-----------------------------------------------
 detinfo::LArPropertiesStandard::LArPropertiesStandard()
   : fIsConfigured(false)
@@ -93,20 +99,16 @@ bool detinfo::LArPropertiesStandard::Configure(fhicl::ParameterSet const& pset)
 #endif // 0
 
 //------------------------------------------------
-bool detinfo::LArPropertiesStandard::Configure(
+template <typename Config>
+void detinfo::LArPropertiesStandard::ConfigureWith(
   fhicl::ParameterSet const& pset,
-  std::set<std::string> ignore_params /* = {} */
+  std::set<std::string> const& ignore_keys,
+  bool const bScintByParticleType
 ) {
-  // we need to know whether we require the additional ScintByParticleType parameters:
-  const bool bScintByParticleType = pset.get<bool>("ScintByParticleType", false);
-
-  std::set<std::string> ignorable_keys = lar::IgnorableProviderConfigKeys();
-  ignorable_keys.insert(ignore_params.begin(), ignore_params.end());
-
 #if DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM
   // validation happens here:
-  fhicl::Table<Configuration_t> config_table { pset, lar::IgnorableProviderConfigKeys() };
-  Configuration_t const& config = config_table();
+  fhicl::Table<Config> config_table { pset, ignore_keys };
+  Config const& config = config_table();
 
   if(bScintByParticleType) {
     double value;
@@ -146,8 +148,9 @@ bool detinfo::LArPropertiesStandard::Configure(
   // read parameters
 #else // !DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM
 
+  std::set<std::string> ignorable_keys = ignore_keys;
   if (!bScintByParticleType) { // ignore the following keys
-    ConfigWithScintByType_t config; // to get the keys
+    Config config; // to get the keys
     ignorable_keys.insert(config.ProtonScintYield       .key());
     ignorable_keys.insert(config.ProtonScintYieldRatio  .key());
     ignorable_keys.insert(config.MuonScintYield         .key());
@@ -163,10 +166,10 @@ bool detinfo::LArPropertiesStandard::Configure(
   } // if !bScintByParticleType
 
   // validation happens here:
-  fhicl::Table<ConfigWithScintByType_t> config_table { pset, ignorable_keys };
+  fhicl::Table<Config> config_table { pset, ignorable_keys };
 
   // read parameters
-  ConfigWithScintByType_t const& config = config_table();
+  Config const& config = config_table();
   if (bScintByParticleType) {
     SetProtonScintYield       (config.ProtonScintYield       ());
     SetProtonScintYieldRatio  (config.ProtonScintYieldRatio  ());
@@ -191,17 +194,6 @@ bool detinfo::LArPropertiesStandard::Configure(
 
   SetArgon39DecayRate     (config.Argon39DecayRate());
 
-  SetFastScintEnergies(config.FastScintEnergies());
-  SetFastScintSpectrum(config.FastScintSpectrum());
-  SetSlowScintEnergies(config.SlowScintEnergies());
-  SetSlowScintSpectrum(config.SlowScintSpectrum());
-  SetAbsLengthEnergies(config.AbsLengthEnergies());
-  SetAbsLengthSpectrum(config.AbsLengthSpectrum());
-  SetRIndexEnergies   (config.RIndexEnergies   ());
-  SetRIndexSpectrum   (config.RIndexSpectrum   ());
-  SetRayleighEnergies (config.RayleighEnergies ());
-  SetRayleighSpectrum (config.RayleighSpectrum ());
-
   SetScintResolutionScale(config.ScintResolutionScale());
   SetScintFastTimeConst  (config.ScintFastTimeConst  ());
   SetScintSlowTimeConst  (config.ScintSlowTimeConst  ());
@@ -213,25 +205,139 @@ bool detinfo::LArPropertiesStandard::Configure(
 
   SetEnableCerenkovLight(config.EnableCerenkovLight());
 
-  SetReflectiveSurfaceNames           (config.ReflectiveSurfaceNames());
-  SetReflectiveSurfaceEnergies        (config.ReflectiveSurfaceEnergies());
-  SetReflectiveSurfaceReflectances    (config.ReflectiveSurfaceReflectances());
-  SetReflectiveSurfaceDiffuseFractions(config.ReflectiveSurfaceDiffuseFractions());
-
-  SetTpbEmmisionEnergies(config.TpbEmmisionEnergies());
-  SetTpbEmmisionSpectrum(config.TpbEmmisionSpectrum());
-  SetTpbAbsorptionEnergies(config.TpbAbsorptionEnergies());
-  SetTpbAbsorptionSpectrum(config.TpbAbsorptionSpectrum());
-
   SetExtraMatProperties (config.ExtraMatProperties ());
   SetTpbTimeConstant (config.TpbTimeConstant ());
 
+  if constexpr (std::is_base_of_v<OpticalConfiguration_t, Config>) {
+    fOpticalTables = ReadOpticalTables(config);
+  }
+
+} // detinfo::LArPropertiesStandard::ConfigureWith()
+
+
+//------------------------------------------------
+bool detinfo::LArPropertiesStandard::Configure(
+  fhicl::ParameterSet const& pset,
+  std::set<std::string> ignore_params /* = {} */
+) {
+  // we need to know whether we require the additional ScintByParticleType parameters:
+  const bool bScintByParticleType = pset.get<bool>("ScintByParticleType", false);
+
+  // and whether optical tables are going to be read now or on demand
+  const bool bLazyOpticalTables = pset.get<bool>("LazyOpticalTables", false);
+
+  std::set<std::string> ignorable_keys = lar::IgnorableProviderConfigKeys();
+  ignorable_keys.insert(ignore_params.begin(), ignore_params.end());
+
+  // no reader may be around during configuration
+  fOpticalTablesPending = false;
+  fOpticalConfig.reset();
+
+  if (bLazyOpticalTables) {
+    std::set<std::string> const opticalKeys = OpticalTableKeys();
+    ignorable_keys.insert(opticalKeys.begin(), opticalKeys.end());
+#if DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM
+    ConfigureWith<CoreConfiguration_t>(pset, ignorable_keys, bScintByParticleType);
+#else // !DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM?
+    ConfigureWith<CoreConfigWithScintByType_t>(pset, ignorable_keys, bScintByParticleType);
+#endif // DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM??
+
+    fOpticalTables = {};
+    fOpticalConfig = std::make_shared<fhicl::ParameterSet const>(pset);
+    fOpticalTablesPending = true;
+  }
+  else {
+#if DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM
+    ConfigureWith<Configuration_t>(pset, ignorable_keys, bScintByParticleType);
+#else // !DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM?
+    ConfigureWith<ConfigWithScintByType_t>(pset, ignorable_keys, bScintByParticleType);
+#endif // DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM??
+  }
 
   fIsConfigured = true;
 
   return true;
 }
 
+//------------------------------------------------
+auto detinfo::LArPropertiesStandard::OpticalTables() const -> OpticalTables_t const&
+{
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::OpticalTables");
+  if (fOpticalTablesPending.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> const lock { fOpticalTablesMutex };
+    if (fOpticalTablesPending.load(std::memory_order_relaxed)) {
+      // validate only the optical tables, tolerating all the other keys
+      std::set<std::string> const opticalKeys = OpticalTableKeys();
+      std::set<std::string> ignorable_keys;
+      for (std::string const& key: fOpticalConfig->get_names())
+        if (opticalKeys.count(key) == 0) ignorable_keys.insert(key);
+
+      fhicl::Table<OpticalConfiguration_t> const config_table
+        { *fOpticalConfig, ignorable_keys };
+      fOpticalTables = ReadOpticalTables(config_table());
+      fOpticalConfig.reset();
+      fOpticalTablesPending.store(false, std::memory_order_release);
+    }
+  }
+  return fOpticalTables;
+}
+
+//------------------------------------------------
+auto detinfo::LArPropertiesStandard::ReadOpticalTables
+  (OpticalConfiguration_t const& config) -> OpticalTables_t
+{
+  OpticalTables_t tables;
+
+  tables.fastScintEnergies = config.FastScintEnergies();
+  tables.fastScintSpectrum = config.FastScintSpectrum();
+  tables.slowScintEnergies = config.SlowScintEnergies();
+  tables.slowScintSpectrum = config.SlowScintSpectrum();
+  tables.absLengthEnergies = config.AbsLengthEnergies();
+  tables.absLengthSpectrum = config.AbsLengthSpectrum();
+  tables.rIndexEnergies    = config.RIndexEnergies   ();
+  tables.rIndexSpectrum    = config.RIndexSpectrum   ();
+  tables.rayleighEnergies  = config.RayleighEnergies ();
+  tables.rayleighSpectrum  = config.RayleighSpectrum ();
+
+  tables.reflectiveSurfaceNames            = config.ReflectiveSurfaceNames();
+  tables.reflectiveSurfaceEnergies         = config.ReflectiveSurfaceEnergies();
+  tables.reflectiveSurfaceReflectances     = config.ReflectiveSurfaceReflectances();
+  tables.reflectiveSurfaceDiffuseFractions = config.ReflectiveSurfaceDiffuseFractions();
+
+  tables.tpbEmmisionEnergies   = config.TpbEmmisionEnergies();
+  tables.tpbEmmisionSpectrum   = config.TpbEmmisionSpectrum();
+  tables.tpbAbsorptionEnergies = config.TpbAbsorptionEnergies();
+  tables.tpbAbsorptionSpectrum = config.TpbAbsorptionSpectrum();
+
+  return tables;
+}
+
+//------------------------------------------------
+std::set<std::string> detinfo::LArPropertiesStandard::OpticalTableKeys()
+{
+  OpticalConfiguration_t const config; // to get the keys
+  return {
+    config.FastScintEnergies.key(),
+    config.FastScintSpectrum.key(),
+    config.SlowScintEnergies.key(),
+    config.SlowScintSpectrum.key(),
+    config.AbsLengthEnergies.key(),
+    config.AbsLengthSpectrum.key(),
+    config.RIndexEnergies   .key(),
+    config.RIndexSpectrum   .key(),
+    config.RayleighEnergies .key(),
+    config.RayleighSpectrum .key(),
+    config.ReflectiveSurfaceNames           .key(),
+    config.ReflectiveSurfaceEnergies        .key(),
+    config.ReflectiveSurfaceReflectances    .key(),
+    config.ReflectiveSurfaceDiffuseFractions.key(),
+    config.TpbEmmisionEnergies  .key(),
+    config.TpbEmmisionSpectrum  .key(),
+    config.TpbAbsorptionEnergies.key(),
+    config.TpbAbsorptionSpectrum.key()
+  };
+}
+
 //------------------------------------------------
 bool detinfo::LArPropertiesStandard::Update(uint64_t ts)
 {
@@ -240,19 +346,100 @@ bool detinfo::LArPropertiesStandard::Update(uint64_t ts)
   return true;
 }
 
+//------------------------------------------------
+template <typename Self, typename Op>
+void detinfo::LArPropertiesStandard::visitState(Self& self, Op op)
+{
+  // the order here defines the layout of the saved state
+  op(self.fRadiationLength);
+  op(self.fArgon39DecayRate);
+  op(self.fZ);
+  op(self.fA);
+  op(self.fI);
+
+  op(self.fOpticalTables.fastScintSpectrum);
+  op(self.fOpticalTables.fastScintEnergies);
+  op(self.fOpticalTables.slowScintSpectrum);
+  op(self.fOpticalTables.slowScintEnergies);
+  op(self.fOpticalTables.rIndexSpectrum);
+  op(self.fOpticalTables.rIndexEnergies);
+  op(self.fOpticalTables.absLengthSpectrum);
+  op(self.fOpticalTables.absLengthEnergies);
+  op(self.fOpticalTables.rayleighSpectrum);
+  op(self.fOpticalTables.rayleighEnergies);
+
+  op(self.fScintByParticleType);
+  op(self.fProtonScintYield);
+  op(self.fProtonScintYieldRatio);
+  op(self.fMuonScintYield);
+  op(self.fMuonScintYieldRatio);
+  op(self.fPionScintYield);
+  op(self.fPionScintYieldRatio);
+  op(self.fKaonScintYield);
+  op(self.fKaonScintYieldRatio);
+  op(self.fElectronScintYield);
+  op(self.fElectronScintYieldRatio);
+  op(self.fAlphaScintYield);
+  op(self.fAlphaScintYieldRatio);
+
+  op(self.fScintYield);
+  op(self.fScintPreScale);
+  op(self.fScintResolutionScale);
+  op(self.fScintFastTimeConst);
+  op(self.fScintSlowTimeConst);
+  op(self.fScintYieldRatio);
+  op(self.fScintBirksConstant);
+  op(self.fEnableCerenkovLight);
+
+  op(self.fOpticalTables.reflectiveSurfaceNames);
+  op(self.fOpticalTables.reflectiveSurfaceEnergies);
+  op(self.fOpticalTables.reflectiveSurfaceReflectances);
+  op(self.fOpticalTables.reflectiveSurfaceDiffuseFractions);
+
+  op(self.fExtraMatProperties);
+  op(self.fTpbTimeConstant);
+  op(self.fOpticalTables.tpbEmmisionEnergies);
+  op(self.fOpticalTables.tpbEmmisionSpectrum);
+  op(self.fOpticalTables.tpbAbsorptionEnergies);
+  op(self.fOpticalTables.tpbAbsorptionSpectrum);
+} // detinfo::LArPropertiesStandard::visitState()
+
+//------------------------------------------------
+void detinfo::LArPropertiesStandard::SaveState(BlobWriter& out) const
+{
+  if (!fIsConfigured) {
+    throw cet::exception("LArPropertiesStandard")
+      << "Can't save the state of a provider which is not configured\n";
+  }
+  OpticalTables(); // make sure the optical tables are loaded
+  visitState(*this, [&out](auto const& member){ out.write(member); });
+}
+
+//------------------------------------------------
+void detinfo::LArPropertiesStandard::LoadState(BlobReader& in)
+{
+  fOpticalTablesPending = false;
+  fOpticalConfig.reset();
+  visitState(*this, [&in](auto& member){ in.read(member); });
+  fIsConfigured = true;
+}
+
 //---------------------------------------------------------------------------------
 std::map<double,double> detinfo::LArPropertiesStandard::FastScintSpectrum() const
 {
-  if(fFastScintSpectrum.size()!=fFastScintEnergies.size()){
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::FastScintSpectrum");
+  OpticalTables_t const& tables = OpticalTables();
+
+  if(tables.fastScintSpectrum.size()!=tables.fastScintEnergies.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the fast scintillation spectrum are "
-      << " different sizes - " << fFastScintSpectrum.size()
-      << " " << fFastScintEnergies.size();
+      << " different sizes - " << tables.fastScintSpectrum.size()
+      << " " << tables.fastScintEnergies.size();
   }
 
   std::map<double, double> ToReturn;
-  for(size_t i=0; i!=fFastScintSpectrum.size(); ++i)
-    ToReturn[fFastScintEnergies.at(i)]=fFastScintSpectrum.at(i);
+  for(size_t i=0; i!=tables.fastScintSpectrum.size(); ++i)
+    ToReturn[tables.fastScintEnergies.at(i)]=tables.fastScintSpectrum.at(i);
 
   return ToReturn;
 }
@@ -260,16 +447,19 @@ std::map<double,double> detinfo::LArPropertiesStandard::FastScintSpectrum() cons
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::SlowScintSpectrum() const
 {
-  if(fSlowScintSpectrum.size()!=fSlowScintEnergies.size()){
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::SlowScintSpectrum");
+  OpticalTables_t const& tables = OpticalTables();
+
+  if(tables.slowScintSpectrum.size()!=tables.slowScintEnergies.size()){
       throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
   << "The vectors specifying the slow scintillation spectrum are "
-  << " different sizes - " << fSlowScintSpectrum.size()
-  << " " << fSlowScintEnergies.size();
+  << " different sizes - " << tables.slowScintSpectrum.size()
+  << " " << tables.slowScintEnergies.size();
     }
 
   std::map<double, double> ToReturn;
-  for(size_t i=0; i!=fSlowScintSpectrum.size(); ++i)
-    ToReturn[fSlowScintEnergies.at(i)]=fSlowScintSpectrum.at(i);
+  for(size_t i=0; i!=tables.slowScintSpectrum.size(); ++i)
+    ToReturn[tables.slowScintEnergies.at(i)]=tables.slowScintSpectrum.at(i);
 
   return ToReturn;
 }
@@ -277,16 +467,19 @@ std::map<double, double> detinfo::LArPropertiesStandard::SlowScintSpectrum() con
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::RIndexSpectrum() const
 {
-  if(fRIndexSpectrum.size()!=fRIndexEnergies.size()){
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::RIndexSpectrum");
+  OpticalTables_t const& tables = OpticalTables();
+
+  if(tables.rIndexSpectrum.size()!=tables.rIndexEnergies.size()){
       throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
   << "The vectors specifying the RIndex spectrum are "
-  << " different sizes - " << fRIndexSpectrum.size()
-  << " " << fRIndexEnergies.size();
+  << " different sizes - " << tables.rIndexSpectrum.size()
+  << " " << tables.rIndexEnergies.size();
   }
 
   std::map<double, double> ToReturn;
-  for(size_t i=0; i!=fRIndexSpectrum.size(); ++i)
-    ToReturn[fRIndexEnergies.at(i)]=fRIndexSpectrum.at(i);
+  for(size_t i=0; i!=tables.rIndexSpectrum.size(); ++i)
+    ToReturn[tables.rIndexEnergies.at(i)]=tables.rIndexSpectrum.at(i);
 
   return ToReturn;
 }
@@ -295,16 +488,19 @@ std::map<double, double> detinfo::LArPropertiesStandard::RIndexSpectrum() const
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::AbsLengthSpectrum() const
 {
-  if(fAbsLengthSpectrum.size()!=fAbsLengthEnergies.size()){
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::AbsLengthSpectrum");
+  OpticalTables_t const& tables = OpticalTables();
+
+  if(tables.absLengthSpectrum.size()!=tables.absLengthEnergies.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the Abs Length spectrum are "
-      << " different sizes - " << fAbsLengthSpectrum.size()
-      << " " << fAbsLengthEnergies.size();
+      << " different sizes - " << tables.absLengthSpectrum.size()
+      << " " << tables.absLengthEnergies.size();
   }
 
   std::map<double, double> ToReturn;
-  for(size_t i=0; i!=fAbsLengthSpectrum.size(); ++i)
-    ToReturn[fAbsLengthEnergies.at(i)]=fAbsLengthSpectrum.at(i);
+  for(size_t i=0; i!=tables.absLengthSpectrum.size(); ++i)
+    ToReturn[tables.absLengthEnergies.at(i)]=tables.absLengthSpectrum.at(i);
 
   return ToReturn;
 }
@@ -312,16 +508,19 @@ std::map<double, double> detinfo::LArPropertiesStandard::AbsLengthSpectrum() con
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::RayleighSpectrum() const
 {
-  if(fRayleighSpectrum.size()!=fRayleighEnergies.size()){
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::RayleighSpectrum");
+  OpticalTables_t const& tables = OpticalTables();
+
+  if(tables.rayleighSpectrum.size()!=tables.rayleighEnergies.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the rayleigh spectrum are "
-      << " different sizes - " << fRayleighSpectrum.size()
-      << " " << fRayleighEnergies.size();
+      << " different sizes - " << tables.rayleighSpectrum.size()
+      << " " << tables.rayleighEnergies.size();
   }
 
   std::map<double, double> ToReturn;
-  for(size_t i=0; i!=fRayleighSpectrum.size(); ++i)
-    ToReturn[fRayleighEnergies.at(i)]=fRayleighSpectrum.at(i);
+  for(size_t i=0; i!=tables.rayleighSpectrum.size(); ++i)
+    ToReturn[tables.rayleighEnergies.at(i)]=tables.rayleighSpectrum.at(i);
 
   return ToReturn;
 }
@@ -329,22 +528,25 @@ std::map<double, double> detinfo::LArPropertiesStandard::RayleighSpectrum() cons
 //---------------------------------------------------------------------------------
 std::map<std::string, std::map<double,double> > detinfo::LArPropertiesStandard::SurfaceReflectances() const
 {
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::SurfaceReflectances");
+  OpticalTables_t const& tables = OpticalTables();
+
   std::map<std::string, std::map<double, double> > ToReturn;
 
-  if(fReflectiveSurfaceNames.size()!=fReflectiveSurfaceReflectances.size()){
+  if(tables.reflectiveSurfaceNames.size()!=tables.reflectiveSurfaceReflectances.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the surface reflectivities "
       << "do not have consistent sizes";
   }
-  for(size_t i=0; i!=fReflectiveSurfaceNames.size(); ++i){
-    if(fReflectiveSurfaceEnergies.size()!=fReflectiveSurfaceReflectances.at(i).size()){
+  for(size_t i=0; i!=tables.reflectiveSurfaceNames.size(); ++i){
+    if(tables.reflectiveSurfaceEnergies.size()!=tables.reflectiveSurfaceReflectances.at(i).size()){
       throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
   << "The vectors specifying the surface reflectivities do not have consistent sizes";
     }
   }
-  for(size_t iName=0; iName!=fReflectiveSurfaceNames.size(); ++iName)
-    for(size_t iEnergy=0; iEnergy!=fReflectiveSurfaceEnergies.size(); ++iEnergy)
-      ToReturn[fReflectiveSurfaceNames.at(iName)][fReflectiveSurfaceEnergies.at(iEnergy)]=fReflectiveSurfaceReflectances[iName][iEnergy];
+  for(size_t iName=0; iName!=tables.reflectiveSurfaceNames.size(); ++iName)
+    for(size_t iEnergy=0; iEnergy!=tables.reflectiveSurfaceEnergies.size(); ++iEnergy)
+      ToReturn[tables.reflectiveSurfaceNames.at(iName)][tables.reflectiveSurfaceEnergies.at(iEnergy)]=tables.reflectiveSurfaceReflectances[iName][iEnergy];
 
   return ToReturn;
 
@@ -353,72 +555,81 @@ std::map<std::string, std::map<double,double> > detinfo::LArPropertiesStandard::
 //---------------------------------------------------------------------------------
 std::map<std::string, std::map<double,double> > detinfo::LArPropertiesStandard::SurfaceReflectanceDiffuseFractions() const
 {
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::SurfaceReflectanceDiffuseFractions");
+  OpticalTables_t const& tables = OpticalTables();
+
   std::map<std::string, std::map<double, double> > ToReturn;
 
-  if(fReflectiveSurfaceNames.size()!=fReflectiveSurfaceDiffuseFractions.size()){
+  if(tables.reflectiveSurfaceNames.size()!=tables.reflectiveSurfaceDiffuseFractions.size()){
     throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
       << "The vectors specifying the surface reflectivities do not have consistent sizes";
   }
-  for(size_t i=0; i!=fReflectiveSurfaceNames.size(); ++i){
-    if(fReflectiveSurfaceEnergies.size()!=fReflectiveSurfaceDiffuseFractions.at(i).size()){
+  for(size_t i=0; i!=tables.reflectiveSurfaceNames.size(); ++i){
+    if(tables.reflectiveSurfaceEnergies.size()!=tables.reflectiveSurfaceDiffuseFractions.at(i).size()){
       throw cet::exception("Incorrect vector sizes in LArPropertiesStandard")
   << "The vectors specifying the surface reflectivities do not have consistent sizes";
 
     }
   }
-  for(size_t iName=0; iName!=fReflectiveSurfaceNames.size(); ++iName)
-    for(size_t iEnergy=0; iEnergy!=fReflectiveSurfaceEnergies.size(); ++iEnergy)
-      ToReturn[fReflectiveSurfaceNames.at(iName)][fReflectiveSurfaceEnergies.at(iEnergy)]=fReflectiveSurfaceDiffuseFractions[iName][iEnergy];
+  for(size_t iName=0; iName!=tables.reflectiveSurfaceNames.size(); ++iName)
+    for(size_t iEnergy=0; iEnergy!=tables.reflectiveSurfaceEnergies.size(); ++iEnergy)
+      ToReturn[tables.reflectiveSurfaceNames.at(iName)][tables.reflectiveSurfaceEnergies.at(iEnergy)]=tables.reflectiveSurfaceDiffuseFractions[iName][iEnergy];
 
   return ToReturn;
 }
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::TpbAbs() const
 {
-  if(fTpbAbsorptionEnergies.size()!=fTpbAbsorptionSpectrum.size()){
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::TpbAbs");
+  OpticalTables_t const& tables = OpticalTables();
+
+  if(tables.tpbAbsorptionEnergies.size()!=tables.tpbAbsorptionSpectrum.size()){
     throw cet::exception("Incorrect vector sizes in LArProperties")
       << "The vectors specifying the TpbAbsorption spectrum are "
-      << " different sizes - " << fTpbAbsorptionEnergies.size()
-      << " " << fTpbAbsorptionSpectrum.size();
+      << " different sizes - " << tables.tpbAbsorptionEnergies.size()
+      << " " << tables.tpbAbsorptionSpectrum.size();
   }
 
   std::map<double, double> ToReturn;
-  for(size_t i=0; i!=fTpbAbsorptionSpectrum.size(); ++i)
-    ToReturn[fTpbAbsorptionEnergies.at(i)]=fTpbAbsorptionSpectrum.at(i);
+  for(size_t i=0; i!=tables.tpbAbsorptionSpectrum.size(); ++i)
+    ToReturn[tables.tpbAbsorptionEnergies.at(i)]=tables.tpbAbsorptionSpectrum.at(i);
 
   return ToReturn;
 }
 //---------------------------------------------------------------------------------
 std::map<double, double> detinfo::LArPropertiesStandard::TpbEm() const
 {
-  if(fTpbEmmisionEnergies.size()!=fTpbEmmisionSpectrum.size()){
+  LARDATAALG_DETECTORINFO_INSTRUMENT("LArPropertiesStandard::TpbEm");
+  OpticalTables_t const& tables = OpticalTables();
+
+  if(tables.tpbEmmisionEnergies.size()!=tables.tpbEmmisionSpectrum.size()){
     throw cet::exception("Incorrect vector sizes in LArProperties")
       << "The vectors specifying the TpbEmmision spectrum are "
-      << " different sizes - " << fTpbEmmisionEnergies.size()
-      << " " << fTpbEmmisionSpectrum.size();
+      << " different sizes - " << tables.tpbEmmisionEnergies.size()
+      << " " << tables.tpbEmmisionSpectrum.size();
   }
   //using interpolation for more smooth spectrum of TPB emmision - won't affect anything but the effective size of table passed to G4
   Int_t tablesize=100;
   std::vector<double> new_x;
   double xrange=0.0;
-  Double_t *en = new Double_t[int(fTpbEmmisionSpectrum.size())+1];
-  Double_t *spectr = new Double_t[int(fTpbEmmisionSpectrum.size())+1];
-  for(int j=0;j<int(fTpbEmmisionSpectrum.size())+1;j++){
+  Double_t *en = new Double_t[int(tables.tpbEmmisionSpectrum.size())+1];
+  Double_t *spectr = new Double_t[int(tables.tpbEmmisionSpectrum.size())+1];
+  for(int j=0;j<int(tables.tpbEmmisionSpectrum.size())+1;j++){
     if(j==0){
       en[j]=0.;
       en[j]=0.;
     }
     else{
-      en[j]=fTpbEmmisionEnergies[j-1];
-      spectr[j]=fTpbEmmisionSpectrum[j-1];
-      //if(j==int(fTpbEmmisionSpectrum.size())) spectr[j]=+0.5;
+      en[j]=tables.tpbEmmisionEnergies[j-1];
+      spectr[j]=tables.tpbEmmisionSpectrum[j-1];
+      //if(j==int(tables.tpbEmmisionSpectrum.size())) spectr[j]=+0.5;
     }
-    //std::cout<<j<<" "<<int(fTpbEmmisionSpectrum.size())<<" energiestpb "<<en[j]<<std::endl;
+    //std::cout<<j<<" "<<int(tables.tpbEmmisionSpectrum.size())<<" energiestpb "<<en[j]<<std::endl;
   }
   TH1D *energyhist=new TH1D();
-  energyhist->SetBins(int(fTpbEmmisionSpectrum.size()),en);
-  for(int ii=0;ii<int(fTpbEmmisionSpectrum.size());ii++) energyhist->SetBinContent(ii,spectr[ii]);
-  xrange=double((en[int(fTpbEmmisionSpectrum.size())]-en[0])/double(fTpbEmmisionSpectrum.size()));
+  energyhist->SetBins(int(tables.tpbEmmisionSpectrum.size()),en);
+  for(int ii=0;ii<int(tables.tpbEmmisionSpectrum.size());ii++) energyhist->SetBinContent(ii,spectr[ii]);
+  xrange=double((en[int(tables.tpbEmmisionSpectrum.size())]-en[0])/double(tables.tpbEmmisionSpectrum.size()));
   new_x.clear();
   for(int jj=0; jj<int(tablesize); jj++){
 
@@ -426,8 +637,8 @@ std::map<double, double> detinfo::LArPropertiesStandard::TpbEm() const
     //std::cout<<"position "<<jj<<" "<<new_x[jj]<<" size of table "<<tablesize<<" range x "<<xrange<<std::endl;
   }
   std::map<double, double> ToReturn;
-  //for(size_t i=0; i!=fTpbEmmisionSpectrum.size(); ++i)
-  //  ToReturn[fTpbEmmisionEnergies.at(i)]=fTpbEmmisionSpectrum.at(i);
+  //for(size_t i=0; i!=tables.tpbEmmisionSpectrum.size(); ++i)
+  //  ToReturn[tables.tpbEmmisionEnergies.at(i)]=tables.tpbEmmisionSpectrum.at(i);
   for(int i=0; i<tablesize; i++){
     ToReturn[new_x.at(i)]=energyhist->Interpolate(new_x[i]);
     //std::cout<<ToReturn[new_x[i]]<< " is set in material propertiestpb at energy "<<new_x[i]<<" size of x "<<new_x.size()<<" "<<energyhist->Interpolate(new_x[i])<<std::end;
@@ -439,3 +650,11 @@ std::map<double, double> detinfo::LArPropertiesStandard::TpbEm() const
   return ToReturn;
 }
 //---------------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------------
+void detinfo::LArPropertiesStandard::debugReport() const
+{
+  std::cout << "LArPropertiesStandard instrumentation:\n";
+  detinfo::instrumentation::report(std::cout, "LArPropertiesStandard::", "  ");
+  std::cout.flush();
+}
@@ -48,9 +48,17 @@
 #include "fhiclcpp/types/Sequence.h"
 
 namespace fhicl { class ParameterSet; }
+namespace detinfo {
+  class BlobWriter;
+  class BlobReader;
+}
 
 // C/C++ standard libraries
+#include <atomic>
+#include <memory> // std::shared_ptr
+#include <mutex>
 #include <string>
+#include <utility> // std::move()
 #include <vector>
 #include <map>
 #include <set>
@@ -68,6 +76,18 @@ namespace detinfo {
    * aware of it. These properties petrain, so far, only the connection mode
    * and not any content of the databases themselves.
    * @note 2: the database connection features for this base class have been removed
+   *
+   * Optical tables
+   * ---------------
+   *
+   * The optical properties (scintillation, refraction index, absorption and
+   * Rayleigh scattering spectra, TPB spectra and reflective surfaces) are
+   * needed only by jobs simulating or reconstructing light. If the
+   * configuration parameter `LazyOpticalTables` is set to `true`, these tables
+   * are neither validated nor read during configuration; the configuration is
+   * kept and they are read and validated on the first access to any of them
+   * (this is thread-safe and happens only once). In that case, errors in the
+   * optical configuration are reported at that first access.
    */
   class LArPropertiesStandard : public LArProperties {
       public:
@@ -90,6 +110,20 @@ namespace detinfo {
       (fhicl::ParameterSet const& pset, std::set<std::string> ignore_params = {});
     bool   Update(uint64_t ts=0);
 
+    /// Appends the full configured state of the provider to `out`.
+    /// @see `LoadState()`, `detinfo::BlobWriter`
+    void SaveState(BlobWriter& out) const;
+
+    /**
+     * @brief Restores the state written by `SaveState()`.
+     * @param in reader positioned at the beginning of the saved state
+     * @throw cet::exception (category: `"BinaryBlob"`) if data is missing
+     *
+     * After the call, the provider is configured (no validation of the values
+     * is performed, since they are assumed to come from a configured provider).
+     */
+    void LoadState(BlobReader& in);
+
     virtual double RadiationLength()  	     const override { return fRadiationLength; } ///< g/cm^2
 
     virtual double Argon39DecayRate()              const override { return fArgon39DecayRate; }  // decays per cm^3 per second
@@ -142,16 +176,16 @@ namespace detinfo {
     void SetAtomicMass(double a) { fA = a;}
     void SetMeanExcitationEnergy(double e) { fI = e;}
 
-    void SetFastScintSpectrum(std::vector<double> s) { fFastScintSpectrum = s;}
-    void SetFastScintEnergies(std::vector<double> s) { fFastScintEnergies = s;}
-    void SetSlowScintSpectrum(std::vector<double> s) { fSlowScintSpectrum = s;}
-    void SetSlowScintEnergies(std::vector<double> s) { fSlowScintEnergies = s;}
-    void SetRIndexSpectrum(std::vector<double> s)    { fRIndexSpectrum = s;}
-    void SetRIndexEnergies(std::vector<double> s)    { fRIndexEnergies = s;}
-    void SetAbsLengthSpectrum(std::vector<double> s) { fAbsLengthSpectrum = s;}
-    void SetAbsLengthEnergies(std::vector<double> s) { fAbsLengthEnergies = s;}
-    void SetRayleighSpectrum(std::vector<double> s)  { fRayleighSpectrum = s;}
-    void SetRayleighEnergies(std::vector<double> s)  { fRayleighEnergies = s;}
+    void SetFastScintSpectrum(std::vector<double> s) { LoadedOpticalTables().fastScintSpectrum = std::move(s);}
+    void SetFastScintEnergies(std::vector<double> s) { LoadedOpticalTables().fastScintEnergies = std::move(s);}
+    void SetSlowScintSpectrum(std::vector<double> s) { LoadedOpticalTables().slowScintSpectrum = std::move(s);}
+    void SetSlowScintEnergies(std::vector<double> s) { LoadedOpticalTables().slowScintEnergies = std::move(s);}
+    void SetRIndexSpectrum(std::vector<double> s)    { LoadedOpticalTables().rIndexSpectrum = std::move(s);}
+    void SetRIndexEnergies(std::vector<double> s)    { LoadedOpticalTables().rIndexEnergies = std::move(s);}
+    void SetAbsLengthSpectrum(std::vector<double> s) { LoadedOpticalTables().absLengthSpectrum = std::move(s);}
+    void SetAbsLengthEnergies(std::vector<double> s) { LoadedOpticalTables().absLengthEnergies = std::move(s);}
+    void SetRayleighSpectrum(std::vector<double> s)  { LoadedOpticalTables().rayleighSpectrum = std::move(s);}
+    void SetRayleighEnergies(std::vector<double> s)  { LoadedOpticalTables().rayleighEnergies = std::move(s);}
 
     void SetScintByParticleType(bool l)        { fScintByParticleType = l;}
     void SetProtonScintYield(double y)         { fProtonScintYield = y;}
@@ -176,10 +210,10 @@ namespace detinfo {
     void SetScintBirksConstant(double kb)      { fScintBirksConstant = kb;}
     void SetEnableCerenkovLight(bool f)        { fEnableCerenkovLight = f; }
 
-    void SetReflectiveSurfaceNames(std::vector<std::string> n) { fReflectiveSurfaceNames = n;}
-    void SetReflectiveSurfaceEnergies(std::vector<double> e)   { fReflectiveSurfaceEnergies = e;}
-    void SetReflectiveSurfaceReflectances(std::vector<std::vector<double> > r) { fReflectiveSurfaceReflectances = r;}
-    void SetReflectiveSurfaceDiffuseFractions(std::vector<std::vector<double> > f) { fReflectiveSurfaceDiffuseFractions = f;}
+    void SetReflectiveSurfaceNames(std::vector<std::string> n) { LoadedOpticalTables().reflectiveSurfaceNames = std::move(n);}
+    void SetReflectiveSurfaceEnergies(std::vector<double> e)   { LoadedOpticalTables().reflectiveSurfaceEnergies = std::move(e);}
+    void SetReflectiveSurfaceReflectances(std::vector<std::vector<double> > r) { LoadedOpticalTables().reflectiveSurfaceReflectances = std::move(r);}
+    void SetReflectiveSurfaceDiffuseFractions(std::vector<std::vector<double> > f) { LoadedOpticalTables().reflectiveSurfaceDiffuseFractions = std::move(f);}
 
     void SetExtraMatProperties(bool l)        { fExtraMatProperties = l;}
     virtual bool ExtraMatProperties() const override { return fExtraMatProperties; }
@@ -190,17 +224,71 @@ namespace detinfo {
 
     void SetTpbTimeConstant(double y)         { fTpbTimeConstant = y;}
 
-    void SetTpbEmmisionEnergies(std::vector<double> s) { fTpbEmmisionEnergies = s;}
-    void SetTpbEmmisionSpectrum(std::vector<double> s) { fTpbEmmisionSpectrum = s;}
-    void SetTpbAbsorptionEnergies(std::vector<double> s) { fTpbAbsorptionEnergies = s;}
-    void SetTpbAbsorptionSpectrum(std::vector<double> s) { fTpbAbsorptionSpectrum = s;}
+    void SetTpbEmmisionEnergies(std::vector<double> s) { LoadedOpticalTables().tpbEmmisionEnergies = std::move(s);}
+    void SetTpbEmmisionSpectrum(std::vector<double> s) { LoadedOpticalTables().tpbEmmisionSpectrum = std::move(s);}
+    void SetTpbAbsorptionEnergies(std::vector<double> s) { LoadedOpticalTables().tpbAbsorptionEnergies = std::move(s);}
+    void SetTpbAbsorptionSpectrum(std::vector<double> s) { LoadedOpticalTables().tpbAbsorptionSpectrum = std::move(s);}
+
+    /// Returns whether optical tables are still waiting to be read (lazy mode).
+    bool OpticalTablesPending() const
+      { return fOpticalTablesPending.load(std::memory_order_acquire); }
+
+    /// Prints the call statistics of the instrumented functions to screen
+    /// (see `lardataalg/DetectorInfo/ProviderInstrumentation.h`).
+    void debugReport() const;
 
 
   private:
+
+    /// Calls `op(member)` on each data member of the configured state of `self`.
+    template <typename Self, typename Op>
+    static void visitState(Self& self, Op op);
+
+    /// Validates `pset` as a `Config` table and sets the parameters in there.
+    template <typename Config>
+    void ConfigureWith(
+      fhicl::ParameterSet const& pset,
+      std::set<std::string> const& ignorable_keys,
+      bool bScintByParticleType
+      );
+
   protected:
 
-    /// structure with all configuration parameters
-    struct Configuration_t {
+    /// structure with the configuration parameters of the optical tables
+    struct OpticalConfiguration_t {
+      using Name = fhicl::Name;
+      using Comment = fhicl::Comment;
+
+      // scintillation spectra
+      fhicl::Sequence<double> FastScintEnergies { Name("FastScintEnergies"), Comment("") };
+      fhicl::Sequence<double> FastScintSpectrum { Name("FastScintSpectrum"), Comment("") };
+      fhicl::Sequence<double> SlowScintEnergies { Name("SlowScintEnergies"), Comment("") };
+      fhicl::Sequence<double> SlowScintSpectrum { Name("SlowScintSpectrum"), Comment("") };
+      fhicl::Sequence<double> AbsLengthEnergies { Name("AbsLengthEnergies"), Comment("") };
+      fhicl::Sequence<double> AbsLengthSpectrum { Name("AbsLengthSpectrum"), Comment("") };
+      fhicl::Sequence<double> RIndexEnergies    { Name("RIndexEnergies"   ), Comment("") };
+      fhicl::Sequence<double> RIndexSpectrum    { Name("RIndexSpectrum"   ), Comment("") };
+      fhicl::Sequence<double> RayleighEnergies  { Name("RayleighEnergies" ), Comment("") };
+      fhicl::Sequence<double> RayleighSpectrum  { Name("RayleighSpectrum" ), Comment("") };
+
+      fhicl::Sequence<double> TpbEmmisionEnergies   { Name("TpbEmmisionEnergies"  ), Comment("") };
+      fhicl::Sequence<double> TpbEmmisionSpectrum   { Name("TpbEmmisionSpectrum"  ), Comment("") };
+      fhicl::Sequence<double> TpbAbsorptionEnergies { Name("TpbAbsorptionEnergies"), Comment("") };
+      fhicl::Sequence<double> TpbAbsorptionSpectrum { Name("TpbAbsorptionSpectrum"), Comment("") };
+
+      fhicl::Sequence<std::string> ReflectiveSurfaceNames
+        { Name("ReflectiveSurfaceNames"),            Comment("") };
+      fhicl::Sequence<double> ReflectiveSurfaceEnergies
+        { Name("ReflectiveSurfaceEnergies"),         Comment("") };
+      fhicl::Sequence<fhicl::Sequence<double>> ReflectiveSurfaceReflectances
+        { Name("ReflectiveSurfaceReflectances"),     Comment("") };
+      fhicl::Sequence<fhicl::Sequence<double>> ReflectiveSurfaceDiffuseFractions
+        { Name("ReflectiveSurfaceDiffuseFractions"), Comment("") };
+
+    }; // OpticalConfiguration_t
+
+    /// structure with all the configuration parameters except optical tables
+    struct CoreConfiguration_t {
       using Name = fhicl::Name;
       using Comment = fhicl::Comment;
 
@@ -217,17 +305,6 @@ namespace detinfo {
         { Name("Argon39DecayRate"), Comment("decays/(cm^3 s)") };
 
       // scintillation parameters
-      fhicl::Sequence<double> FastScintEnergies { Name("FastScintEnergies"), Comment("") };
-      fhicl::Sequence<double> FastScintSpectrum { Name("FastScintSpectrum"), Comment("") };
-      fhicl::Sequence<double> SlowScintEnergies { Name("SlowScintEnergies"), Comment("") };
-      fhicl::Sequence<double> SlowScintSpectrum { Name("SlowScintSpectrum"), Comment("") };
-      fhicl::Sequence<double> AbsLengthEnergies { Name("AbsLengthEnergies"), Comment("") };
-      fhicl::Sequence<double> AbsLengthSpectrum { Name("AbsLengthSpectrum"), Comment("") };
-      fhicl::Sequence<double> RIndexEnergies    { Name("RIndexEnergies"   ), Comment("") };
-      fhicl::Sequence<double> RIndexSpectrum    { Name("RIndexSpectrum"   ), Comment("") };
-      fhicl::Sequence<double> RayleighEnergies  { Name("RayleighEnergies" ), Comment("") };
-      fhicl::Sequence<double> RayleighSpectrum  { Name("RayleighSpectrum" ), Comment("") };
-
       fhicl::Atom<double> ScintResolutionScale { Name("ScintResolutionScale"), Comment("") };
       fhicl::Atom<double> ScintFastTimeConst   { Name("ScintFastTimeConst"  ), Comment("") };
       fhicl::Atom<double> ScintSlowTimeConst   { Name("ScintSlowTimeConst"  ), Comment("") };
@@ -237,11 +314,6 @@ namespace detinfo {
       fhicl::Atom<double> ScintYieldRatio      { Name("ScintYieldRatio"     ), Comment("") };
       fhicl::Atom<bool  > ScintByParticleType  { Name("ScintByParticleType" ), Comment("") };
 
-      fhicl::Sequence<double> TpbEmmisionEnergies   { Name("TpbEmmisionEnergies"  ), Comment("") };
-      fhicl::Sequence<double> TpbEmmisionSpectrum   { Name("TpbEmmisionSpectrum"  ), Comment("") };
-      fhicl::Sequence<double> TpbAbsorptionEnergies { Name("TpbAbsorptionEnergies"), Comment("") };
-      fhicl::Sequence<double> TpbAbsorptionSpectrum { Name("TpbAbsorptionSpectrum"), Comment("") };
-
       fhicl::Atom<double> TpbTimeConstant    { Name("TpbTimeConstant"       ), Comment("") };
       fhicl::Atom<bool  > ExtraMatProperties { Name("LoadExtraMatProperties"), Comment("") };
 
@@ -275,20 +347,28 @@ namespace detinfo {
 
       fhicl::Atom<bool  > EnableCerenkovLight  { Name("EnableCerenkovLight" ), Comment("") };
 
-      fhicl::Sequence<std::string> ReflectiveSurfaceNames
-        { Name("ReflectiveSurfaceNames"),            Comment("") };
-      fhicl::Sequence<double> ReflectiveSurfaceEnergies
-        { Name("ReflectiveSurfaceEnergies"),         Comment("") };
-      fhicl::Sequence<fhicl::Sequence<double>> ReflectiveSurfaceReflectances
-        { Name("ReflectiveSurfaceReflectances"),     Comment("") };
-      fhicl::Sequence<fhicl::Sequence<double>> ReflectiveSurfaceDiffuseFractions
-        { Name("ReflectiveSurfaceDiffuseFractions"), Comment("") };
+      fhicl::Atom<bool> LazyOpticalTables {
+        Name("LazyOpticalTables"),
+        Comment("read and validate the optical tables only on their first use"),
+        false
+        };
+
+    }; // CoreConfiguration_t
 
+    /// structure with all configuration parameters
+    struct Configuration_t
+      : public CoreConfiguration_t, public OpticalConfiguration_t
+    {
+      using Name = fhicl::Name;
+      using Comment = fhicl::Comment;
     }; // Configuration_t
 
 #if !DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM
-    /// structure with all configuration parameters
-    struct ConfigWithScintByType_t: public Configuration_t {
+    /// structure adding the parameters by particle type to `Base`
+    template <typename Base>
+    struct WithScintByType_t: public Base {
+      using Name = fhicl::Name;
+      using Comment = fhicl::Comment;
 
       fhicl::Atom<double> ProtonScintYield
         { Name("ProtonScintYield"       ), Comment("(only if ScintByParticleType is true)") };
@@ -315,7 +395,13 @@ namespace detinfo {
       fhicl::Atom<double> AlphaScintYieldRatio
         { Name("AlphaScintYieldRatio"   ), Comment("(only if ScintByParticleType is true)") };
 
-    }; // ConfigWithScintByType_t
+    }; // WithScintByType_t
+
+    /// structure with all configuration parameters
+    using ConfigWithScintByType_t = WithScintByType_t<Configuration_t>;
+
+    /// structure with all configuration parameters except optical tables
+    using CoreConfigWithScintByType_t = WithScintByType_t<CoreConfiguration_t>;
 #endif // !DETECTORINFO_LARPROPERTIESSTANDARD_HASOPTIONALATOM?
 
 
@@ -331,18 +417,54 @@ namespace detinfo {
     double fI;                ///< Ar mean excitation energy (eV)
 
 
-    // Optical parameters for LAr
+    /// Optical parameters for LAr.
+    struct OpticalTables_t {
+      std::vector<double> fastScintSpectrum;
+      std::vector<double> fastScintEnergies;
+      std::vector<double> slowScintSpectrum;
+      std::vector<double> slowScintEnergies;
+      std::vector<double> rIndexSpectrum;
+      std::vector<double> rIndexEnergies;
+      std::vector<double> absLengthSpectrum;
+      std::vector<double> absLengthEnergies;
+      std::vector<double> rayleighSpectrum;
+      std::vector<double> rayleighEnergies;
 
-    std::vector<double> fFastScintSpectrum;
-    std::vector<double> fFastScintEnergies;
-    std::vector<double> fSlowScintSpectrum;
-    std::vector<double> fSlowScintEnergies;
-    std::vector<double> fRIndexSpectrum;
-    std::vector<double> fRIndexEnergies;
-    std::vector<double> fAbsLengthSpectrum;
-    std::vector<double> fAbsLengthEnergies;
-    std::vector<double> fRayleighSpectrum;
-    std::vector<double> fRayleighEnergies;
+      std::vector<std::string>          reflectiveSurfaceNames;
+      std::vector<double>               reflectiveSurfaceEnergies;
+      std::vector<std::vector<double> > reflectiveSurfaceReflectances;
+      std::vector<std::vector<double> > reflectiveSurfaceDiffuseFractions;
+
+      std::vector<double>               tpbEmmisionEnergies;
+      std::vector<double>               tpbEmmisionSpectrum;
+      std::vector<double>               tpbAbsorptionEnergies;
+      std::vector<double>               tpbAbsorptionSpectrum;
+    }; // OpticalTables_t
+
+    /// Returns the optical tables, reading them first if still pending.
+    OpticalTables_t const& OpticalTables() const;
+
+    /// Returns the optical tables for modification, after reading them.
+    OpticalTables_t& LoadedOpticalTables()
+      { OpticalTables(); return fOpticalTables; }
+
+    /// Reads the optical tables from a validated configuration.
+    static OpticalTables_t ReadOpticalTables(OpticalConfiguration_t const& config);
+
+    /// Returns the names of all the configuration keys of the optical tables.
+    static std::set<std::string> OpticalTableKeys();
+
+    /// Optical tables (filled on first access if `fOpticalTablesPending`).
+    mutable OpticalTables_t fOpticalTables;
+
+    /// Configuration to read the optical tables from, when they are pending.
+    mutable std::shared_ptr<fhicl::ParameterSet const> fOpticalConfig;
+
+    /// Whether the optical tables are still to be read from `fOpticalConfig`.
+    mutable std::atomic<bool> fOpticalTablesPending { false };
+
+    /// Serializes the reading of the optical tables.
+    mutable std::mutex fOpticalTablesMutex;
 
     bool fScintByParticleType;
 
@@ -369,17 +491,8 @@ namespace detinfo {
 
     bool fEnableCerenkovLight;
 
-    std::vector<std::string>          fReflectiveSurfaceNames;
-    std::vector<double>               fReflectiveSurfaceEnergies;
-    std::vector<std::vector<double> > fReflectiveSurfaceReflectances;
-    std::vector<std::vector<double> > fReflectiveSurfaceDiffuseFractions;
-
     bool fExtraMatProperties;
     double fTpbTimeConstant;
-    std::vector<double>               fTpbEmmisionEnergies;
-    std::vector<double>               fTpbEmmisionSpectrum;
-    std::vector<double>               fTpbAbsorptionEnergies;
-    std::vector<double>               fTpbAbsorptionSpectrum;
 
     /*
 	    struct DBsettingsClass {
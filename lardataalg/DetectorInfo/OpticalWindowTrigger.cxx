@@ -0,0 +1,124 @@
+/**
+ * @file   lardataalg/DetectorInfo/OpticalWindowTrigger.cxx
+ * @brief  Multiplicity of optical discriminator ticks in sliding windows.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/OpticalWindowTrigger.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/OpticalWindowTrigger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::fill()
+#include <stdexcept> // std::domain_error
+#include <string>
+#include <utility> // std::move()
+
+
+//------------------------------------------------------------------------------
+void detinfo::OpticalWindowTrigger::Accumulator::addChannel
+  (TickList_t const& ticks)
+{
+  std::ptrdiff_t const nTicks = fCounts.size();
+  for (tick_t const tick: ticks) {
+    std::ptrdiff_t const bin = tick.value() - fStart.value();
+    if ((bin < 0) || (bin >= nTicks)) ++fOutside;
+    else ++fCounts[bin];
+  } // for
+} // detinfo::OpticalWindowTrigger::Accumulator::addChannel()
+
+
+//------------------------------------------------------------------------------
+detinfo::OpticalWindowTrigger::OpticalWindowTrigger
+  (tick_t start, tick_t end, std::vector<std::size_t> widths)
+  : fStart(start)
+  , fWidths(std::move(widths))
+  , fAll(start, (end.value() > start.value())? end.value() - start.value(): 0)
+{
+  if (nTicks() == 0U) {
+    throw std::domain_error("OpticalWindowTrigger: empty readout window (ticks "
+      + std::to_string(start.value()) + " to " + std::to_string(end.value())
+      + ")");
+  }
+  for (std::size_t const width: fWidths) {
+    if ((width > 0U) && (width <= nTicks())) continue;
+    throw std::domain_error("OpticalWindowTrigger: invalid window width "
+      + std::to_string(width) + " for a readout window of "
+      + std::to_string(nTicks()) + " ticks");
+  } // for
+} // detinfo::OpticalWindowTrigger::OpticalWindowTrigger()
+
+
+//------------------------------------------------------------------------------
+void detinfo::OpticalWindowTrigger::add(Accumulator const& accumulator) {
+  if ((accumulator.fStart != fStart) || (accumulator.fCounts.size() != nTicks()))
+  {
+    throw std::domain_error
+      ("OpticalWindowTrigger: accumulator for a different readout window");
+  }
+  for (std::size_t bin = 0; bin < nTicks(); ++bin)
+    fAll.fCounts[bin] += accumulator.fCounts[bin];
+  fAll.fOutside += accumulator.fOutside;
+} // detinfo::OpticalWindowTrigger::add()
+
+
+//------------------------------------------------------------------------------
+void detinfo::OpticalWindowTrigger::addChannels
+  (std::vector<TickList_t> const& channels)
+{
+  for (TickList_t const& ticks: channels) addChannel(ticks);
+} // detinfo::OpticalWindowTrigger::addChannels()
+
+
+//------------------------------------------------------------------------------
+void detinfo::OpticalWindowTrigger::reset() {
+  std::fill(fAll.fCounts.begin(), fAll.fCounts.end(), 0U);
+  fAll.fOutside = 0U;
+} // detinfo::OpticalWindowTrigger::reset()
+
+
+//------------------------------------------------------------------------------
+auto detinfo::OpticalWindowTrigger::multiplicities() const
+  -> std::vector<Windows_t>
+{
+  std::vector<count_t> const& counts = fAll.fCounts;
+
+  std::vector<Windows_t> windows;
+  windows.reserve(fWidths.size());
+  for (std::size_t const width: fWidths)
+    windows.push_back({ width, fStart, std::vector<count_t>(nTicks() - width + 1U) });
+
+  // one running sum per width; each tick enters the sum once and leaves it once
+  std::vector<count_t> sums(fWidths.size(), 0U);
+  for (std::size_t tick = 0; tick < nTicks(); ++tick) {
+    for (std::size_t iWidth = 0; iWidth < fWidths.size(); ++iWidth) {
+      std::size_t const width = fWidths[iWidth];
+      count_t& sum = sums[iWidth];
+      sum += counts[tick];
+      if (tick + 1U < width) continue;
+      std::size_t const window = tick + 1U - width;
+      windows[iWidth].counts[window] = sum;
+      sum -= counts[window];
+    } // for widths
+  } // for ticks
+
+  return windows;
+} // detinfo::OpticalWindowTrigger::multiplicities()
+
+
+//------------------------------------------------------------------------------
+auto detinfo::OpticalWindowTrigger::triggerTicks
+  (Windows_t const& windows, count_t threshold) -> std::vector<tick_t>
+{
+  std::vector<tick_t> triggers;
+  bool above = false;
+  for (std::size_t window = 0; window < windows.counts.size(); ++window) {
+    bool const wasAbove = above;
+    above = windows.counts[window] >= threshold;
+    if (above && !wasAbove) triggers.push_back(windows.startTick(window));
+  } // for
+  return triggers;
+} // detinfo::OpticalWindowTrigger::triggerTicks()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,210 @@
+/**
+ * @file   lardataalg/DetectorInfo/OpticalWindowTrigger.h
+ * @brief  Multiplicity of optical discriminator ticks in sliding windows.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/OpticalWindowTrigger.cxx
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_OPTICALWINDOWTRIGGER_H
+#define LARDATAALG_DETECTORINFO_OPTICALWINDOWTRIGGER_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h" // detinfo::timescales
+#include "lardataalg/DetectorInfo/DetectorTimings.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <vector>
+
+
+namespace detinfo {
+
+  /**
+   * @brief Counts optical discriminator ticks in sliding windows.
+   *
+   * Hardware triggers are emulated by counting the optical hits above
+   * threshold (discriminator ticks) of all channels in a window of a fixed
+   * number of optical ticks (as defined by
+   * `detinfo::DetectorClocksData::OpticalClock()`), sliding one tick at a time
+   * over the whole readout window.
+   *
+   * The discriminator ticks of each channel are first added into a histogram
+   * with one bin per optical tick of the readout window; ticks outside the
+   * window are only counted (`nOutside()`). Then `multiplicities()` computes
+   * in a single pass the count of every window, for each of the configured
+   * window widths, with a running sum: the cost is linear in the number of
+   * ticks of the readout window for each width, however wide the windows.
+   *
+   * The filling is serial. Callers which want to process the channels in
+   * parallel (e.g. with the task scheduler of the framework) can give each
+   * task its own `Accumulator` (from `makeAccumulator()`), and then add all
+   * of them to this object with `add()`:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<detinfo::OpticalWindowTrigger::Accumulator> accumulators
+   *   (nTasks, trigger.makeAccumulator());
+   * // ... task `i` calls `accumulators[i].addChannel(ticks)` for its channels
+   * for (auto const& accumulator: accumulators) trigger.add(accumulator);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The result does not depend on how the channels are split.
+   *
+   * Times on any time scale can be converted into optical ticks with
+   * `opticalTicks()`:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * detinfo::DetectorTimings const timings { clockData };
+   * detinfo::OpticalWindowTrigger trigger
+   *   { optical_tick{ 0 }, optical_tick{ 10000 }, { 4U, 16U } };
+   * for (std::vector<electronics_time> const& times: channelTimes)
+   *   trigger.addChannel(detinfo::OpticalWindowTrigger::opticalTicks(timings, times));
+   *
+   * std::vector<optical_tick> const triggers
+   *   = trigger.triggerTicks(trigger.multiplicities()[0], 10U);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class OpticalWindowTrigger {
+      public:
+
+    using tick_t = timescales::optical_tick; ///< Type of optical tick.
+    using count_t = unsigned int; ///< Type of hit count.
+    using TickList_t = std::vector<tick_t>; ///< Ticks of one channel.
+
+    /// Counts of all the windows of one width.
+    struct Windows_t {
+      std::size_t width = 0U; ///< Width of the windows [ticks].
+      tick_t firstTick; ///< Start of the first window.
+      std::vector<count_t> counts; ///< Count of each window, one per start tick.
+
+      /// Returns the start tick of the window with index `window`.
+      tick_t startTick(std::size_t window) const
+        { return tick_t{ firstTick.value() + static_cast<std::ptrdiff_t>(window) }; }
+    }; // Windows_t
+
+
+    /// Histogram of discriminator ticks of some of the channels.
+    class Accumulator {
+        public:
+
+      /// Adds all the discriminator ticks of a channel.
+      void addChannel(TickList_t const& ticks);
+
+      /// Returns the number of ticks added outside the readout window.
+      std::size_t nOutside() const { return fOutside; }
+
+        private:
+      friend class OpticalWindowTrigger;
+
+      tick_t fStart; ///< First tick of the readout window.
+      std::vector<count_t> fCounts; ///< Count in each tick.
+      std::size_t fOutside = 0U; ///< Number of ticks out of the window.
+
+      Accumulator(tick_t start, std::size_t nTicks)
+        : fStart(start), fCounts(nTicks, 0U) {}
+
+    }; // Accumulator
+
+
+    /**
+     * @brief Constructor: sets the readout window and the window widths.
+     * @param start first tick of the readout window
+     * @param end tick after the last one of the readout window
+     * @param widths the widths of the sliding windows [ticks]
+     * @throw std::domain_error if the readout window is empty
+     * @throw std::domain_error if any width is `0` or larger than the window
+     */
+    OpticalWindowTrigger
+      (tick_t start, tick_t end, std::vector<std::size_t> widths);
+
+
+    /// Returns the first tick of the readout window.
+    tick_t startTick() const { return fStart; }
+
+    /// Returns the number of ticks in the readout window.
+    std::size_t nTicks() const { return fAll.fCounts.size(); }
+
+    /// Returns the widths of the sliding windows [ticks].
+    std::vector<std::size_t> const& widths() const { return fWidths; }
+
+    /// Returns the number of ticks added outside the readout window.
+    std::size_t nOutside() const { return fAll.nOutside(); }
+
+
+    // --- BEGIN -- Filling ----------------------------------------------------
+    /// @name Filling
+    /// @{
+
+    /// Returns a new, empty accumulator (e.g. for a thread).
+    Accumulator makeAccumulator() const { return { fStart, nTicks() }; }
+
+    /// Adds all the discriminator ticks of a channel.
+    void addChannel(TickList_t const& ticks) { fAll.addChannel(ticks); }
+
+    /// Adds the content of an accumulator.
+    void add(Accumulator const& accumulator);
+
+    /// Adds the discriminator ticks of all the `channels`.
+    void addChannels(std::vector<TickList_t> const& channels);
+
+    /// Removes all the added ticks.
+    void reset();
+
+    /// @}
+    // --- END -- Filling ------------------------------------------------------
+
+
+    // --- BEGIN -- Results ----------------------------------------------------
+    /// @name Results
+    /// @{
+
+    /// Returns the counts of all the windows, one entry per width.
+    std::vector<Windows_t> multiplicities() const;
+
+    /**
+     * @brief Returns the start of the windows where the count reaches `threshold`.
+     * @param windows the counts of all the windows of one width
+     * @param threshold the minimum count to trigger
+     * @return start ticks of the windows at threshold, after ones below it
+     *
+     * A window triggers if it reaches the threshold and the one starting one
+     * tick earlier does not; the first window triggers if it reaches it.
+     */
+    static std::vector<tick_t> triggerTicks
+      (Windows_t const& windows, count_t threshold);
+
+    /// @}
+    // --- END -- Results ------------------------------------------------------
+
+
+    /// Converts `times` (on any time scale) into optical ticks.
+    template <typename Coll>
+    static TickList_t opticalTicks
+      (detinfo::DetectorTimings const& timings, Coll const& times);
+
+
+      private:
+
+    tick_t fStart; ///< First tick of the readout window.
+    std::vector<std::size_t> fWidths; ///< Widths of the windows [ticks].
+    Accumulator fAll; ///< Counts of all the channels.
+
+  }; // class OpticalWindowTrigger
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Coll>
+auto detinfo::OpticalWindowTrigger::opticalTicks
+  (detinfo::DetectorTimings const& timings, Coll const& times) -> TickList_t
+{
+  TickList_t ticks;
+  ticks.reserve(times.size());
+  for (auto const& time: times) ticks.push_back(timings.toOpticalTick(time));
+  return ticks;
+} // detinfo::OpticalWindowTrigger::opticalTicks()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_DETECTORINFO_OPTICALWINDOWTRIGGER_H
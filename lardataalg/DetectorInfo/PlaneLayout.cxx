@@ -0,0 +1,208 @@
+/**
+ * @file   lardataalg/DetectorInfo/PlaneLayout.cxx
+ * @brief  Compact description of the wire planes of all TPCs.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/PlaneLayout.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/PlaneLayout.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+
+// C/C++ standard libraries
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream> // std::istringstream
+#include <stdexcept> // std::domain_error, std::logic_error, ...
+
+
+//------------------------------------------------------------------------------
+void detinfo::PlaneLayout::AddTPC
+  (double driftDirection, double firstPlaneX, std::vector<Plane_t> const& planes)
+{
+  if (fCryostatTPCs.empty())
+    throw std::logic_error("PlaneLayout: TPC added before any cryostat");
+  if (planes.empty())
+    throw std::domain_error("PlaneLayout: TPC with no planes");
+  for (std::size_t iPlane = 0; iPlane + 1U < planes.size(); ++iPlane) {
+    if (!(planes[iPlane].pitch >= 0.0)) {
+      throw std::domain_error("PlaneLayout: invalid pitch "
+        + std::to_string(planes[iPlane].pitch) + " after plane "
+        + std::to_string(iPlane));
+    }
+  } // for
+
+  TPC_t tpc;
+  tpc.driftDirection = driftDirection;
+  tpc.firstPlaneX = firstPlaneX;
+  tpc.firstPlane = fPlanes.size();
+  tpc.nPlanes = planes.size();
+  fTPCs.push_back(tpc);
+
+  fPlanes.insert(fPlanes.end(), planes.begin(), planes.end());
+  fPlanes.back().pitch = 0.0;
+} // detinfo::PlaneLayout::AddTPC()
+
+
+//------------------------------------------------------------------------------
+unsigned int detinfo::PlaneLayout::NTPCs(unsigned int cryo) const {
+  if (cryo >= fCryostatTPCs.size()) return 0U;
+  std::size_t const end = (cryo + 1U < fCryostatTPCs.size())
+    ? fCryostatTPCs[cryo + 1U]: fTPCs.size();
+  return end - fCryostatTPCs[cryo];
+} // detinfo::PlaneLayout::NTPCs()
+
+
+//------------------------------------------------------------------------------
+std::set<geo::View_t> detinfo::PlaneLayout::Views() const {
+  std::set<geo::View_t> views;
+  for (Plane_t const& plane: fPlanes) views.insert(plane.view);
+  return views;
+} // detinfo::PlaneLayout::Views()
+
+
+//------------------------------------------------------------------------------
+void detinfo::PlaneLayout::Write(std::ostream& out) const {
+  auto const oldPrecision
+    = out.precision(std::numeric_limits<double>::max_digits10);
+  out << "# cryostat TPC drift_direction first_plane_x planes views... pitches...\n";
+  for (unsigned int cryo = 0; cryo < NCryostats(); ++cryo) {
+    for (unsigned int iTPC = 0; iTPC < NTPCs(cryo); ++iTPC) {
+      TPC_t const& tpc = TPC(cryo, iTPC);
+      Plane_t const* planes = Planes(tpc);
+      out << cryo << " " << iTPC << " " << tpc.driftDirection
+        << " " << tpc.firstPlaneX << " " << tpc.nPlanes;
+      for (unsigned int iPlane = 0; iPlane < tpc.nPlanes; ++iPlane)
+        out << " " << static_cast<int>(planes[iPlane].view);
+      for (unsigned int iPlane = 0; iPlane + 1U < tpc.nPlanes; ++iPlane)
+        out << " " << planes[iPlane].pitch;
+      out << "\n";
+    } // for TPC
+  } // for cryostat
+  out.precision(oldPrecision);
+} // detinfo::PlaneLayout::Write()
+
+
+//------------------------------------------------------------------------------
+void detinfo::PlaneLayout::WriteFile(std::string const& path) const {
+  std::ofstream out { path };
+  if (out) Write(out);
+  if (!out)
+    throw std::runtime_error("PlaneLayout: can't write file '" + path + "'");
+} // detinfo::PlaneLayout::WriteFile()
+
+
+//------------------------------------------------------------------------------
+detinfo::PlaneLayout detinfo::PlaneLayout::FromGeometry
+  (geo::GeometryCore const& geom)
+{
+  PlaneLayout layout;
+  std::vector<Plane_t> planes;
+  for (unsigned int cryo = 0; cryo < geom.Ncryostats(); ++cryo) {
+    geo::CryostatGeo const& cryostat = geom.Cryostat(cryo);
+    layout.AddCryostat();
+    for (unsigned int iTPC = 0; iTPC < cryostat.NTPC(); ++iTPC) {
+      geo::TPCGeo const& tpc = cryostat.TPC(iTPC);
+      unsigned int const nPlanes = tpc.Nplanes();
+      planes.resize(nPlanes);
+      for (unsigned int iPlane = 0; iPlane < nPlanes; ++iPlane) {
+        planes[iPlane].view = tpc.Plane(iPlane).View();
+        planes[iPlane].pitch = (iPlane + 1U < nPlanes)
+          ? tpc.PlanePitch(iPlane, iPlane + 1U): 0.0;
+      } // for planes
+      // only works if xyz[0]<=0
+      layout.AddTPC((tpc.DriftDirection() == geo::kNegX)? +1.0: -1.0,
+        tpc.PlaneLocation(0)[0], planes);
+    } // for TPC
+  } // for cryostat
+  return layout;
+} // detinfo::PlaneLayout::FromGeometry()
+
+
+//------------------------------------------------------------------------------
+detinfo::PlaneLayout detinfo::PlaneLayout::Read(std::istream& in) {
+
+  PlaneLayout layout;
+  std::vector<Plane_t> planes;
+  std::string line;
+  unsigned int iLine = 0;
+  while (std::getline(in, line)) {
+    ++iLine;
+    if (auto const comment = line.find('#'); comment != std::string::npos)
+      line.erase(comment);
+
+    std::istringstream sline { line };
+    unsigned int cryo, iTPC, nPlanes;
+    double driftDirection, firstPlaneX;
+    if (!(sline >> cryo)) {
+      if (sline.eof()) continue; // empty line
+      throw std::domain_error
+        ("PlaneLayout: malformed line " + std::to_string(iLine));
+    }
+    if (!(sline >> iTPC >> driftDirection >> firstPlaneX >> nPlanes)) {
+      throw std::domain_error
+        ("PlaneLayout: malformed line " + std::to_string(iLine));
+    }
+    if (nPlanes > PlaneLayoutMaxPlanes) {
+      throw std::domain_error("PlaneLayout: " + std::to_string(nPlanes)
+        + " planes on line " + std::to_string(iLine) + " (the limit is "
+        + std::to_string(PlaneLayoutMaxPlanes) + ")");
+    }
+
+    // cryostats and TPCs must be listed in order
+    bool const nextTPC
+      = (cryo + 1U == layout.NCryostats()) && (iTPC == layout.NTPCs(cryo));
+    bool const nextCryostat = (cryo == layout.NCryostats()) && (iTPC == 0U);
+    if (nextCryostat) layout.AddCryostat();
+    else if (!nextTPC) {
+      throw std::domain_error("PlaneLayout: unexpected C:"
+        + std::to_string(cryo) + " T:" + std::to_string(iTPC)
+        + " on line " + std::to_string(iLine));
+    }
+
+    planes.assign(nPlanes, Plane_t{ geo::kUnknown, 0.0 });
+    for (Plane_t& plane: planes) {
+      int view;
+      if (!(sline >> view)) break;
+      plane.view = static_cast<geo::View_t>(view);
+    }
+    for (unsigned int iPlane = 0; iPlane + 1U < nPlanes; ++iPlane) {
+      if (!(sline >> planes[iPlane].pitch)) break;
+    }
+    std::string extra;
+    if (sline.fail() || (sline >> extra)) {
+      throw std::domain_error("PlaneLayout: expected " + std::to_string(nPlanes)
+        + " views and " + std::to_string(nPlanes? nPlanes - 1U: 0U)
+        + " pitches on line " + std::to_string(iLine));
+    }
+
+    try {
+      layout.AddTPC(driftDirection, firstPlaneX, planes);
+    }
+    catch (std::domain_error const& e) {
+      throw std::domain_error
+        (std::string(e.what()) + " on line " + std::to_string(iLine));
+    }
+  } // while
+
+  return layout;
+} // detinfo::PlaneLayout::Read()
+
+
+//------------------------------------------------------------------------------
+detinfo::PlaneLayout detinfo::PlaneLayout::FromFile(std::string const& path) {
+  std::ifstream in { path };
+  if (!in)
+    throw std::runtime_error("PlaneLayout: can't read file '" + path + "'");
+  return Read(in);
+} // detinfo::PlaneLayout::FromFile()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,157 @@
+/**
+ * @file   lardataalg/DetectorInfo/PlaneLayout.h
+ * @brief  Compact description of the wire planes of all TPCs.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/PlaneLayout.cxx
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_PLANELAYOUT_H
+#define LARDATAALG_DETECTORINFO_PLANELAYOUT_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <iosfwd> // std::istream, std::ostream
+#include <set>
+#include <string>
+#include <vector>
+
+
+namespace geo { class GeometryCore; }
+
+namespace detinfo {
+
+  /// Largest number of planes of a TPC read from text.
+  inline constexpr unsigned int PlaneLayoutMaxPlanes = 64U;
+
+
+  /**
+   * @brief The information on the wire planes needed for the drift.
+   *
+   * This table holds, for each TPC of each cryostat, the drift direction, the
+   * position of the first plane along the drift direction and, for each of
+   * its planes, the view and the distance from the next plane.
+   * The data of all TPCs and of all planes are each stored in a single
+   * contiguous array, so that they can be scanned without any access to the
+   * geometry service.
+   *
+   * The table can be extracted from the geometry (`FromGeometry()`), built
+   * TPC by TPC (`AddCryostat()`, `AddTPC()`), or read from a text file
+   * (`FromFile()`) previously written by `Write()`. The text format has one
+   * line per TPC, in order of cryostat and TPC number:
+   *
+   *     <cryostat> <TPC> <drift direction> <first plane x> <planes> <view 0> ... <pitch 0> ...
+   *
+   * with one view (as `geo::View_t` numeric value) for each plane and one
+   * pitch [cm] for each plane except the last one. The drift direction is
+   * `+1` for TPCs drifting toward negative _x_ and `-1` otherwise, as in
+   * `detinfo::TPCDriftParameters_t`. Empty lines and text following a `#`
+   * are ignored. A TPC read from text can't have more than
+   * `PlaneLayoutMaxPlanes` planes.
+   *
+   * Example of usage with a `DetectorPropertiesStandard` provider `detProp`
+   * without geometry:
+   *
+   *     detProp.SetPlaneLayout(detinfo::PlaneLayout::FromFile("layout.txt"));
+   *     detinfo::DetectorPropertiesData const detPropData
+   *       = detProp.DataFor(clockData);
+   *
+   */
+  class PlaneLayout {
+      public:
+
+    /// Description of a TPC.
+    struct TPC_t {
+      double driftDirection = 0.0; ///< `+1` drifting to negative _x_, else `-1`.
+      double firstPlaneX = 0.0; ///< Position of the first plane on _x_ [cm].
+      std::size_t firstPlane = 0U; ///< Index of the first plane in `Planes()`.
+      unsigned int nPlanes = 0U; ///< Number of planes.
+    }; // TPC_t
+
+    /// Description of a plane.
+    struct Plane_t {
+      geo::View_t view; ///< View of the plane.
+      double pitch = 0.0; ///< Distance from the next plane (`0` if last) [cm].
+    }; // Plane_t
+
+
+    /// Creates an empty layout, with no cryostat.
+    PlaneLayout() = default;
+
+    /// Starts a new cryostat, with no TPC.
+    void AddCryostat() { fCryostatTPCs.push_back(fTPCs.size()); }
+
+    /**
+     * @brief Adds a TPC to the last cryostat.
+     * @param driftDirection `+1` for drift toward negative _x_, `-1` otherwise
+     * @param firstPlaneX position of the first plane on _x_ [cm]
+     * @param planes the planes of the TPC, starting from the first one
+     * @throw std::logic_error if there is no cryostat yet
+     * @throw std::domain_error if there are no planes, or pitches are negative
+     */
+    void AddTPC(double driftDirection, double firstPlaneX,
+                std::vector<Plane_t> const& planes);
+
+
+    /// Returns the number of cryostats.
+    unsigned int NCryostats() const { return fCryostatTPCs.size(); }
+
+    /// Returns the number of TPCs in cryostat `cryo` (`0` if none).
+    unsigned int NTPCs(unsigned int cryo) const;
+
+    /// Returns the description of TPC `tpc` in cryostat `cryo` (unchecked).
+    TPC_t const& TPC(unsigned int cryo, unsigned int tpc) const
+      { return fTPCs[fCryostatTPCs[cryo] + tpc]; }
+
+    /// Returns the description of all TPCs, cryostat after cryostat.
+    std::vector<TPC_t> const& TPCs() const { return fTPCs; }
+
+    /// Returns the description of all planes, TPC after TPC.
+    std::vector<Plane_t> const& Planes() const { return fPlanes; }
+
+    /// Returns a pointer to the first plane of `tpc` (see `TPC_t::nPlanes`).
+    Plane_t const* Planes(TPC_t const& tpc) const
+      { return fPlanes.data() + tpc.firstPlane; }
+
+    /// Returns all the views present in the layout.
+    std::set<geo::View_t> Views() const;
+
+
+    /// Writes the layout in the text format read by `Read()`.
+    void Write(std::ostream& out) const;
+
+    /// Writes the layout into the text file at `path`.
+    /// @throw std::runtime_error if the file can't be written
+    void WriteFile(std::string const& path) const;
+
+
+    /// Extracts the layout from the geometry.
+    static PlaneLayout FromGeometry(geo::GeometryCore const& geom);
+
+    /**
+     * @brief Reads a layout in the text format described above.
+     * @param in the stream to read from
+     * @throw std::domain_error on malformed or inconsistent input
+     */
+    static PlaneLayout Read(std::istream& in);
+
+    /// Reads a layout from the text file at `path`.
+    /// @throw std::runtime_error if the file can't be read
+    /// @throw std::domain_error on malformed or inconsistent input
+    static PlaneLayout FromFile(std::string const& path);
+
+
+      private:
+
+    std::vector<std::size_t> fCryostatTPCs; ///< First TPC of each cryostat.
+    std::vector<TPC_t> fTPCs; ///< All TPCs.
+    std::vector<Plane_t> fPlanes; ///< All planes.
+
+  }; // class PlaneLayout
+
+} // namespace detinfo
+
+
+#endif // LARDATAALG_DETECTORINFO_PLANELAYOUT_H
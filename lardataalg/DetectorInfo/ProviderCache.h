@@ -0,0 +1,152 @@
+/**
+ * @file   lardataalg/DetectorInfo/ProviderCache.h
+ * @brief  Thread-safe cache of service providers built once per key.
+ * @date   October 17, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_PROVIDERCACHE_H
+#define LARDATAALG_DETECTORINFO_PROVIDERCACHE_H
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <exception> // std::current_exception()
+#include <future>
+#include <map>
+#include <memory> // std::shared_ptr
+#include <mutex>
+
+
+namespace detinfo {
+
+  /**
+   * @brief Cache of providers, each built only once for each key.
+   * @tparam Key type of the key identifying a provider configuration
+   * @tparam Provider type of the cached provider
+   *
+   * Providers are created on the first request of their key, by the factory
+   * passed to `get()`, and are then shared as constant objects among all the
+   * callers requesting the same key.
+   *
+   * The cache can be used concurrently from many threads: requests for a key
+   * already being built wait for that construction to complete, while
+   * providers with different keys are built in parallel.
+   * If the construction fails, all the callers waiting for it receive the
+   * exception, and the key is removed from the cache, so that a following
+   * request will try again.
+   *
+   * The `Key` type must be ordered (`operator<`).
+   */
+  template <typename Key, typename Provider>
+  class ProviderCache {
+      public:
+
+    using key_type = Key; ///< Type of the key of the providers.
+    using provider_type = Provider; ///< Type of the cached providers.
+
+    /// Pointer to a cached provider.
+    using provider_ptr = std::shared_ptr<Provider const>;
+
+    /**
+     * @brief Returns the provider for `key`, building it if needed.
+     * @tparam Factory type of callable object creating a provider
+     * @param key the key identifying the provider
+     * @param factory called with no argument to create the provider
+     * @return a pointer to the (constant) provider
+     *
+     * The `factory` must return a pointer to a new provider, either as a
+     * `std::unique_ptr` or as a `std::shared_ptr`.
+     * It is called only if `key` is not in the cache yet, and its exceptions
+     * are propagated to the caller.
+     */
+    template <typename Factory>
+    provider_ptr get(Key const& key, Factory&& factory);
+
+    /// Returns whether a provider for `key` is cached or being built.
+    bool has(Key const& key) const;
+
+    /// Returns the number of providers cached or being built.
+    std::size_t size() const;
+
+    /// Removes all the providers from the cache (owners keep their copies).
+    void clear();
+
+      private:
+
+    mutable std::mutex fMutex; ///< Protects `fProviders`.
+
+    /// Providers (or their pending construction) by key.
+    std::map<Key, std::shared_future<provider_ptr>> fProviders;
+
+  }; // class ProviderCache
+
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Key, typename Provider>
+template <typename Factory>
+auto detinfo::ProviderCache<Key, Provider>::get
+  (Key const& key, Factory&& factory) -> provider_ptr
+{
+  std::promise<provider_ptr> promise;
+  std::shared_future<provider_ptr> future;
+  bool builder = false;
+  {
+    std::lock_guard<std::mutex> const lock { fMutex };
+    auto const iProvider = fProviders.find(key);
+    if (iProvider != fProviders.end()) future = iProvider->second;
+    else {
+      future = promise.get_future().share();
+      fProviders.emplace(key, future);
+      builder = true;
+    }
+  }
+
+  // if the provider is not ours to build, we wait for whoever is building it
+  if (!builder) return future.get();
+
+  try {
+    promise.set_value(provider_ptr{ factory() });
+  }
+  catch (...) {
+    promise.set_exception(std::current_exception());
+    std::lock_guard<std::mutex> const lock { fMutex };
+    fProviders.erase(key);
+  }
+  return future.get();
+
+} // detinfo::ProviderCache<>::get()
+
+
+//------------------------------------------------------------------------------
+template <typename Key, typename Provider>
+bool detinfo::ProviderCache<Key, Provider>::has(Key const& key) const {
+  std::lock_guard<std::mutex> const lock { fMutex };
+  return fProviders.count(key) > 0;
+} // detinfo::ProviderCache<>::has()
+
+
+//------------------------------------------------------------------------------
+template <typename Key, typename Provider>
+std::size_t detinfo::ProviderCache<Key, Provider>::size() const {
+  std::lock_guard<std::mutex> const lock { fMutex };
+  return fProviders.size();
+} // detinfo::ProviderCache<>::size()
+
+
+//------------------------------------------------------------------------------
+template <typename Key, typename Provider>
+void detinfo::ProviderCache<Key, Provider>::clear() {
+  std::lock_guard<std::mutex> const lock { fMutex };
+  fProviders.clear();
+} // detinfo::ProviderCache<>::clear()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAALG_DETECTORINFO_PROVIDERCACHE_H
@@ -0,0 +1,155 @@
+/**
+ * @file   lardataalg/DetectorInfo/ProviderInstrumentation.cxx
+ * @brief  Optional call counting and timing of provider functions.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ProviderInstrumentation.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::find()
+#include <mutex>
+#include <ostream>
+
+
+namespace {
+
+  using namespace detinfo::instrumentation;
+  using detinfo::instrumentation::details::ProbeCounters_t;
+  using detinfo::instrumentation::details::ThreadCounters_t;
+
+  /// Names of the functions and list of the counters of all the threads.
+  struct Registry_t {
+    std::mutex mutex;
+    std::vector<std::string> names; ///< Name of each registered function.
+    std::vector<ThreadCounters_t*> threads; ///< Counters of live threads.
+    std::array<FunctionStats_t, MaxProbes> ended; ///< Counts of ended threads.
+  }; // Registry_t
+
+  /// Returns the registry, which is never destroyed (threads may outlive it).
+  Registry_t& registry() {
+    static Registry_t* const reg = new Registry_t;
+    return *reg;
+  }
+
+  /// Adds the counters of a thread to the merged statistics `stats`.
+  void addCounters(FunctionStats_t& stats, ProbeCounters_t const& counters) {
+    stats.calls += counters.calls.load(std::memory_order_relaxed);
+    stats.sampledCalls += counters.sampledCalls.load(std::memory_order_relaxed);
+    stats.sampledTime += counters.sampledTime.load(std::memory_order_relaxed);
+    for (std::size_t bin = 0; bin < NLatencyBins; ++bin)
+      stats.latency[bin] += counters.latency[bin].load(std::memory_order_relaxed);
+  } // addCounters()
+
+  /// Resets the counters of a thread.
+  void resetCounters(ProbeCounters_t& counters) {
+    counters.calls.store(0U, std::memory_order_relaxed);
+    counters.sampledCalls.store(0U, std::memory_order_relaxed);
+    counters.sampledTime.store(0U, std::memory_order_relaxed);
+    for (auto& count: counters.latency) count.store(0U, std::memory_order_relaxed);
+  } // resetCounters()
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+detinfo::instrumentation::details::ThreadCounters_t::ThreadCounters_t() {
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock { reg.mutex };
+  reg.threads.push_back(this);
+} // ThreadCounters_t::ThreadCounters_t()
+
+
+detinfo::instrumentation::details::ThreadCounters_t::~ThreadCounters_t() {
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock { reg.mutex };
+  for (std::size_t id = 0; id < MaxProbes; ++id)
+    addCounters(reg.ended[id], probes[id]);
+  reg.threads.erase(std::find(reg.threads.begin(), reg.threads.end(), this));
+} // ThreadCounters_t::~ThreadCounters_t()
+
+
+//------------------------------------------------------------------------------
+std::size_t detinfo::instrumentation::details::registerProbe(std::string name) {
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock { reg.mutex };
+  // the same function may be registered from different libraries
+  auto const iName = std::find(reg.names.begin(), reg.names.end(), name);
+  if (iName != reg.names.end()) return iName - reg.names.begin();
+  if (reg.names.size() >= MaxProbes) return MaxProbes;
+  reg.names.push_back(std::move(name));
+  return reg.names.size() - 1U;
+} // detinfo::instrumentation::details::registerProbe()
+
+
+//------------------------------------------------------------------------------
+auto detinfo::instrumentation::collect(std::string const& prefix)
+  -> std::vector<FunctionStats_t>
+{
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock { reg.mutex };
+
+  std::vector<FunctionStats_t> stats;
+  for (std::size_t id = 0; id < reg.names.size(); ++id) {
+    if (reg.names[id].compare(0U, prefix.size(), prefix) != 0) continue;
+    FunctionStats_t merged = reg.ended[id];
+    merged.name = reg.names[id];
+    for (ThreadCounters_t const* thread: reg.threads)
+      addCounters(merged, thread->probes[id]);
+    stats.push_back(std::move(merged));
+  } // for
+  return stats;
+} // detinfo::instrumentation::collect()
+
+
+//------------------------------------------------------------------------------
+void detinfo::instrumentation::reset() {
+  Registry_t& reg = registry();
+  std::lock_guard<std::mutex> const lock { reg.mutex };
+  reg.ended.fill(FunctionStats_t{});
+  for (ThreadCounters_t* thread: reg.threads) {
+    // only the owning thread increments the counters; resetting them from
+    // here may lose the calls being recorded right now
+    for (ProbeCounters_t& counters: thread->probes) resetCounters(counters);
+  }
+} // detinfo::instrumentation::reset()
+
+
+//------------------------------------------------------------------------------
+void detinfo::instrumentation::report
+  (std::ostream& out, std::string const& prefix, std::string const& indent)
+{
+  if (!Enabled) {
+    out << indent << "Instrumentation not enabled"
+      " (build option LARDATAALG_DETECTORINFO_ENABLE_INSTRUMENTATION is off)\n";
+    return;
+  }
+
+  std::vector<FunctionStats_t> const stats = collect(prefix);
+  out << indent << "Instrumented functions: " << stats.size()
+    << " (one call every " << SamplingPeriod << " timed)\n";
+  for (FunctionStats_t const& function: stats) {
+    out << indent << "  " << function.name << ": " << function.calls
+      << " calls";
+    if (function.sampledCalls == 0U) {
+      out << "\n";
+      continue;
+    }
+    out << ", " << function.sampledCalls << " timed, average "
+      << function.AverageLatency() << " ns\n"
+      << indent << "    latency [ns]:";
+    for (std::size_t bin = 0; bin < NLatencyBins; ++bin) {
+      if (function.latency[bin] == 0U) continue;
+      out << " [" << FunctionStats_t::BinLowerEdge(bin) << ";"
+        << FunctionStats_t::BinLowerEdge(bin + 1U) << "[: "
+        << function.latency[bin];
+    } // for bins
+    out << "\n";
+  } // for functions
+
+} // detinfo::instrumentation::report()
+
+
+//------------------------------------------------------------------------------
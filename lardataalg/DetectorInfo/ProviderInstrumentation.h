@@ -0,0 +1,222 @@
+/**
+ * @file   lardataalg/DetectorInfo/ProviderInstrumentation.h
+ * @brief  Optional call counting and timing of provider functions.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ProviderInstrumentation.cxx
+ *
+ * The instrumentation is enabled by the CMake option
+ * `LARDATAALG_DETECTORINFO_ENABLE_INSTRUMENTATION`, which defines the
+ * preprocessor symbol of the same name in the generated header
+ * `lardataalg/DetectorInfo/ProviderInstrumentationConfig.h`. Since that
+ * header is installed with the library, the library and all the code using
+ * the inline functions of its headers are compiled with the same setting.
+ * The symbol should not be defined any other way. Without instrumentation,
+ * `LARDATAALG_DETECTORINFO_INSTRUMENT()` expands to an empty statement and
+ * no counter is ever touched.
+ *
+ * An instrumented function starts with:
+ *
+ *     LARDATAALG_DETECTORINFO_INSTRUMENT("DetectorPropertiesStandard::DataFor");
+ *
+ * A `constexpr` function can't be instrumented, and the `constexpr` accessors
+ * of `detinfo::DetectorClocksData` are not.
+ *
+ * Each call is counted, and one call every `SamplingPeriod` is also timed;
+ * the duration of the timed calls fills a histogram with bins of powers of
+ * two of nanoseconds. Counters are kept per thread, so that recording needs
+ * no synchronization; `collect()` merges the counters of all the threads,
+ * including the ones which have already ended.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_PROVIDERINSTRUMENTATION_H
+#define LARDATAALG_DETECTORINFO_PROVIDERINSTRUMENTATION_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/ProviderInstrumentationConfig.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <iosfwd> // std::ostream
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+
+namespace detinfo::instrumentation {
+
+  /// Whether the instrumentation is compiled in.
+  inline constexpr bool Enabled =
+#ifdef LARDATAALG_DETECTORINFO_ENABLE_INSTRUMENTATION
+    true;
+#else
+    false;
+#endif
+
+  /// Maximum number of instrumented functions; additional ones are ignored.
+  inline constexpr std::size_t MaxProbes = 64U;
+
+  /// Number of latency bins; bin `i` covers [ 2^i, 2^(i+1) [ ns (bin 0 from 0).
+  inline constexpr std::size_t NLatencyBins = 32U;
+
+  /// One call every this many is timed.
+  inline constexpr std::uint64_t SamplingPeriod = 64U;
+
+
+  /// Merged statistics of an instrumented function.
+  struct FunctionStats_t {
+    std::string name; ///< Name of the instrumented function.
+    std::uint64_t calls = 0U; ///< Number of calls.
+    std::uint64_t sampledCalls = 0U; ///< Number of timed calls.
+    std::uint64_t sampledTime = 0U; ///< Total time of the timed calls [ns].
+    std::array<std::uint64_t, NLatencyBins> latency {}; ///< Timed calls per bin.
+
+    /// Returns the average duration of the timed calls [ns].
+    double AverageLatency() const
+      { return sampledCalls? double(sampledTime) / sampledCalls: 0.0; }
+
+    /// Returns the lower edge of the latency bin `bin` [ns].
+    static std::uint64_t BinLowerEdge(std::size_t bin)
+      { return bin? (std::uint64_t(1) << bin): 0U; }
+
+  }; // FunctionStats_t
+
+
+  namespace details {
+
+    /// Counters of a function in a thread.
+    struct ProbeCounters_t {
+      std::atomic<std::uint64_t> calls { 0U };
+      std::atomic<std::uint64_t> sampledCalls { 0U };
+      std::atomic<std::uint64_t> sampledTime { 0U };
+      std::array<std::atomic<std::uint64_t>, NLatencyBins> latency {};
+    }; // ProbeCounters_t
+
+    /// Counters of all functions in a thread; registered while alive.
+    struct ThreadCounters_t {
+      std::array<ProbeCounters_t, MaxProbes> probes;
+
+      ThreadCounters_t();
+      ~ThreadCounters_t();
+      ThreadCounters_t(ThreadCounters_t const&) = delete;
+      ThreadCounters_t& operator=(ThreadCounters_t const&) = delete;
+    }; // ThreadCounters_t
+
+    /// Returns the counters of the current thread.
+    inline ThreadCounters_t& threadCounters()
+      { thread_local ThreadCounters_t counters; return counters; }
+
+    /// Increments a counter only ever written by the current thread.
+    inline void increment(std::atomic<std::uint64_t>& counter, std::uint64_t by = 1U)
+      {
+        counter.store
+          (counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+      }
+
+    /// Returns the latency bin of a duration in nanoseconds.
+    inline std::size_t latencyBin(std::uint64_t ns)
+      {
+        std::size_t bin = 0U;
+        while ((ns >>= 1) && (bin + 1U < NLatencyBins)) ++bin;
+        return bin;
+      }
+
+    /// Registers a function name, returns its index (`MaxProbes` if full).
+    std::size_t registerProbe(std::string name);
+
+  } // namespace details
+
+
+  /// Identifier of an instrumented function.
+  class Probe {
+      public:
+    /// Registers the function with the specified name.
+    explicit Probe(std::string name)
+      : fID(details::registerProbe(std::move(name))) {}
+
+    /// Returns the index of the counters of this function.
+    std::size_t ID() const { return fID; }
+
+    /// Returns whether calls of this function are recorded.
+    bool isRecorded() const { return fID < MaxProbes; }
+
+      private:
+    std::size_t fID;
+  }; // class Probe
+
+
+  /// Counts a call of a function, timing it if it is a sampled one.
+  class ScopedTimer {
+      public:
+    explicit ScopedTimer(Probe const& probe)
+      {
+        if (!probe.isRecorded()) return;
+        fCounters = &(details::threadCounters().probes[probe.ID()]);
+        std::uint64_t const calls
+          = fCounters->calls.load(std::memory_order_relaxed);
+        fCounters->calls.store(calls + 1U, std::memory_order_relaxed);
+        fSampled = (calls % SamplingPeriod == 0U);
+        if (fSampled) fStart = std::chrono::steady_clock::now();
+      }
+
+    ~ScopedTimer()
+      {
+        if (!fSampled) return;
+        std::uint64_t const ns
+          = std::chrono::duration_cast<std::chrono::nanoseconds>
+            (std::chrono::steady_clock::now() - fStart).count();
+        details::increment(fCounters->sampledCalls);
+        details::increment(fCounters->sampledTime, ns);
+        details::increment(fCounters->latency[details::latencyBin(ns)]);
+      }
+
+    ScopedTimer(ScopedTimer const&) = delete;
+    ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+      private:
+    details::ProbeCounters_t* fCounters = nullptr;
+    bool fSampled = false;
+    std::chrono::steady_clock::time_point fStart;
+  }; // class ScopedTimer
+
+
+  /**
+   * @brief Returns the statistics of the functions, merged from all threads.
+   * @param prefix only functions whose name starts with this are included
+   *
+   * Functions are listed in the order they were first called.
+   * Counts from threads still recording may be slightly out of date.
+   */
+  std::vector<FunctionStats_t> collect(std::string const& prefix = "");
+
+  /// Resets all the counters (approximate for threads still recording).
+  void reset();
+
+  /**
+   * @brief Prints the statistics of the functions into `out`.
+   * @param out stream to print into
+   * @param prefix only functions whose name starts with this are printed
+   * @param indent indentation of each output line
+   */
+  void report
+    (std::ostream& out, std::string const& prefix = "", std::string const& indent = "");
+
+} // namespace detinfo::instrumentation
+
+
+#ifdef LARDATAALG_DETECTORINFO_ENABLE_INSTRUMENTATION
+/// Counts the calls of the current function (and times some of them).
+#  define LARDATAALG_DETECTORINFO_INSTRUMENT(name)                             \
+  static ::detinfo::instrumentation::Probe const                             \
+    lardataalg_detectorinfo_probe { name };                                    \
+  ::detinfo::instrumentation::ScopedTimer const                              \
+    lardataalg_detectorinfo_timer { lardataalg_detectorinfo_probe }
+#else
+#  define LARDATAALG_DETECTORINFO_INSTRUMENT(name) static_cast<void>(0)
+#endif // LARDATAALG_DETECTORINFO_ENABLE_INSTRUMENTATION
+
+
+#endif // LARDATAALG_DETECTORINFO_PROVIDERINSTRUMENTATION_H
@@ -0,0 +1,226 @@
+/**
+ * @file   lardataalg/DetectorInfo/RecombinationCorrection.h
+ * @brief  Charge to energy conversion with recombination corrections.
+ * @date   October 17, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_RECOMBINATIONCORRECTION_H
+#define LARDATAALG_DETECTORINFO_RECOMBINATIONCORRECTION_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/VectorExp.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+
+namespace detinfo {
+
+  /**
+   * @brief Converts charge (dQ/dx) into energy (dE/dx) correcting for
+   *        recombination.
+   *
+   * Two models are supported:
+   * * `Birks()`: parameterization from S. Amoruso et al.,
+   *   NIM A 523 (2004) 275;
+   * * `ModBox()`: modified box model, which has better behavior than the
+   *   Birks correction at high values of dQ/dx.
+   *
+   * Both expect dQ/dx in electrons/cm, already corrected for lifetime and
+   * effective pitch, and return dE/dx in MeV/cm.
+   * These are the implementations of
+   * `detinfo::DetectorPropertiesStandard::BirksCorrection()` and
+   * `detinfo::DetectorPropertiesStandard::ModBoxCorrection()`.
+   *
+   * The argon density and the nominal electric field are captured on
+   * construction, and all the constants of the models are precomputed.
+   * Each model offers a version for a single value and versions for a sequence
+   * of values, with the nominal electric field or with a field value for each
+   * charge value. The sequence versions are plain loops with no function call.
+   * The modified box model uses `details::vectorExp()` instead of `std::exp()`,
+   * which the compiler can't vectorize unless the math library semantics are
+   * relaxed (e.g. `-ffast-math`); GCC vectorizes the sequence loops at `-O3`
+   * when the iterators are pointers or vector iterators.
+   *
+   * Example:
+   *
+   *     detinfo::RecombinationCorrection const recomb{ detProp };
+   *     std::vector<double> dEdx(dQdx.size());
+   *     recomb.ModBox(dQdx.begin(), dQdx.end(), dEdx.begin());
+   *
+   */
+  class RecombinationCorrection {
+      public:
+
+    /**
+     * @brief Constructor: captures the liquid argon state.
+     * @param density argon density [g/cm^3]
+     * @param efield nominal electric field [kV/cm]
+     */
+    RecombinationCorrection(double density, double efield)
+      : fDensity(density)
+      , fEfield(efield)
+      , fBirksK(util::kRecombk / density)
+      , fModBoxK(util::kModBoxB * Wion / density)
+      , fModBoxInvB(density / util::kModBoxB)
+      {}
+
+    /// Constructor: uses current density and nominal field (gap `0`).
+    explicit RecombinationCorrection(DetectorPropertiesData const& detProp)
+      : RecombinationCorrection(detProp.Density(), detProp.Efield())
+      {}
+
+
+    /// Argon density the constants are computed for [g/cm^3].
+    double Density() const { return fDensity; }
+
+    /// Nominal electric field [kV/cm].
+    double Efield() const { return fEfield; }
+
+
+    // --- BEGIN -- Birks model ------------------------------------------------
+    /// @name Birks model
+    /// @{
+
+    /// Returns dE/dx [MeV/cm] from `dQdx` [e/cm] in field `efield` [kV/cm].
+    double Birks(double dQdx, double efield) const
+      { return dQdx / (BirksA - fBirksK / efield * dQdx); }
+
+    /// Returns dE/dx [MeV/cm] from `dQdx` [e/cm] in the nominal field.
+    double Birks(double dQdx) const { return Birks(dQdx, fEfield); }
+
+    /**
+     * @brief Converts a sequence of dQ/dx in the nominal field.
+     * @tparam BIter type of iterator to the input values
+     * @tparam EIter type of end iterator to the input values
+     * @tparam OIter type of output iterator
+     * @param begin iterator to the first dQ/dx [e/cm]
+     * @param end iterator past the last dQ/dx
+     * @param dEdx iterator to the first output dE/dx [MeV/cm]
+     * @return the output iterator past the last written element
+     */
+    template <typename BIter, typename EIter, typename OIter>
+    OIter Birks(BIter begin, EIter end, OIter dEdx) const;
+
+    /**
+     * @brief Converts a sequence of dQ/dx, each in its own field.
+     * @tparam BIter type of iterator to the input values
+     * @tparam EIter type of end iterator to the input values
+     * @tparam FIter type of iterator to the electric field values
+     * @tparam OIter type of output iterator
+     * @param begin iterator to the first dQ/dx [e/cm]
+     * @param end iterator past the last dQ/dx
+     * @param efield iterator to the field for the first dQ/dx [kV/cm]
+     * @param dEdx iterator to the first output dE/dx [MeV/cm]
+     * @return the output iterator past the last written element
+     */
+    template <typename BIter, typename EIter, typename FIter, typename OIter>
+    OIter Birks(BIter begin, EIter end, FIter efield, OIter dEdx) const;
+
+    /// @}
+    // --- END -- Birks model --------------------------------------------------
+
+
+    // --- BEGIN -- Modified box model -----------------------------------------
+    /// @name Modified box model
+    /// @{
+
+    /// Returns dE/dx [MeV/cm] from `dQdx` [e/cm] in field `efield` [kV/cm].
+    double ModBox(double dQdx, double efield) const
+      {
+        return (details::vectorExp(fModBoxK / efield * dQdx) - util::kModBoxA)
+          * fModBoxInvB * efield;
+      }
+
+    /// Returns dE/dx [MeV/cm] from `dQdx` [e/cm] in the nominal field.
+    double ModBox(double dQdx) const { return ModBox(dQdx, fEfield); }
+
+    /// Converts a sequence of dQ/dx in the nominal field.
+    /// @see `Birks(BIter, EIter, OIter)`
+    template <typename BIter, typename EIter, typename OIter>
+    OIter ModBox(BIter begin, EIter end, OIter dEdx) const;
+
+    /// Converts a sequence of dQ/dx, each in its own field.
+    /// @see `Birks(BIter, EIter, FIter, OIter)`
+    template <typename BIter, typename EIter, typename FIter, typename OIter>
+    OIter ModBox(BIter begin, EIter end, FIter efield, OIter dEdx) const;
+
+    /// @}
+    // --- END -- Modified box model -------------------------------------------
+
+
+      private:
+
+    /// Ionization work function: 23.6 eV = 1e, Wion in MeV/e.
+    static constexpr double Wion = 1000. / util::kGeVToElectrons;
+
+    /// Constant term of the Birks denominator.
+    static constexpr double BirksA = util::kRecombA / Wion;
+
+    double fDensity; ///< LAr density [g/cm^3].
+    double fEfield; ///< Nominal electric field [kV/cm].
+
+    double fBirksK; ///< Birks `k` over density [kV/MeV].
+    double fModBoxK; ///< `B Wion / density`: exponent is this times dQ/dx / E.
+    double fModBoxInvB; ///< `density / B`: dE/dx scale is this times E.
+
+  }; // class RecombinationCorrection
+
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename BIter, typename EIter, typename OIter>
+OIter detinfo::RecombinationCorrection::Birks
+  (BIter begin, EIter end, OIter dEdx) const
+{
+  double const k = fBirksK / fEfield;
+  while (begin != end) {
+    double const dQdx = *begin++;
+    *dEdx++ = dQdx / (BirksA - k * dQdx);
+  }
+  return dEdx;
+} // detinfo::RecombinationCorrection::Birks(BIter, EIter, OIter)
+
+
+//------------------------------------------------------------------------------
+template <typename BIter, typename EIter, typename FIter, typename OIter>
+OIter detinfo::RecombinationCorrection::Birks
+  (BIter begin, EIter end, FIter efield, OIter dEdx) const
+{
+  while (begin != end) *dEdx++ = Birks(*begin++, *efield++);
+  return dEdx;
+} // detinfo::RecombinationCorrection::Birks(BIter, EIter, FIter, OIter)
+
+
+//------------------------------------------------------------------------------
+template <typename BIter, typename EIter, typename OIter>
+OIter detinfo::RecombinationCorrection::ModBox
+  (BIter begin, EIter end, OIter dEdx) const
+{
+  double const k = fModBoxK / fEfield;
+  double const scale = fModBoxInvB * fEfield;
+  double const offset = util::kModBoxA * scale;
+  while (begin != end)
+    *dEdx++ = details::vectorExp(k * *begin++) * scale - offset;
+  return dEdx;
+} // detinfo::RecombinationCorrection::ModBox(BIter, EIter, OIter)
+
+
+//------------------------------------------------------------------------------
+template <typename BIter, typename EIter, typename FIter, typename OIter>
+OIter detinfo::RecombinationCorrection::ModBox
+  (BIter begin, EIter end, FIter efield, OIter dEdx) const
+{
+  while (begin != end) *dEdx++ = ModBox(*begin++, *efield++);
+  return dEdx;
+} // detinfo::RecombinationCorrection::ModBox(BIter, EIter, FIter, OIter)
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAALG_DETECTORINFO_RECOMBINATIONCORRECTION_H
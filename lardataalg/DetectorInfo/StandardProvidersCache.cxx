@@ -0,0 +1,95 @@
+/**
+ * @file   lardataalg/DetectorInfo/StandardProvidersCache.cxx
+ * @brief  Cache of standard detector providers keyed by their configuration.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/StandardProvidersCache.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/StandardProvidersCache.h"
+
+// framework libraries
+#include "fhiclcpp/ParameterSet.h"
+
+
+//------------------------------------------------------------------------------
+auto detinfo::StandardProvidersCache::LArProperties(
+  fhicl::ParameterSet const& config,
+  std::set<std::string> const& ignore_params /* = {} */
+) -> std::shared_ptr<LArPropertiesStandard const>
+{
+  return fLArProp.get(config.id(), [&config, &ignore_params]()
+    { return std::make_unique<LArPropertiesStandard>(config, ignore_params); }
+    );
+} // detinfo::StandardProvidersCache::LArProperties()
+
+
+//------------------------------------------------------------------------------
+auto detinfo::StandardProvidersCache::DetectorClocks
+  (fhicl::ParameterSet const& config)
+  -> std::shared_ptr<DetectorClocksStandard const>
+{
+  return fDetClocks.get(config.id(),
+    [&config](){ return std::make_unique<DetectorClocksStandard>(config); }
+    );
+} // detinfo::StandardProvidersCache::DetectorClocks()
+
+
+//------------------------------------------------------------------------------
+auto detinfo::StandardProvidersCache::DetectorProperties(
+  fhicl::ParameterSet const& config,
+  fhicl::ParameterSet const& larPropConfig,
+  geo::GeometryCore const& geom,
+  std::set<std::string> const& ignore_params /* = {} */
+) -> std::shared_ptr<DetectorPropertiesStandard const>
+{
+  DetPropKey_t const key { config.id(), larPropConfig.id(), &geom };
+  return fDetProp.get(key, [this, &config, &larPropConfig, &geom, &ignore_params]()
+    {
+      std::shared_ptr<LArPropertiesStandard const> larProp
+        = LArProperties(larPropConfig);
+      auto detProp = std::make_unique<DetectorPropertiesStandard>
+        (config, &geom, larProp.get(), ignore_params);
+
+      // the deleter holds the LAr properties alive as long as detProp is
+      return std::shared_ptr<DetectorPropertiesStandard const>{
+        detProp.release(),
+        [larProp](DetectorPropertiesStandard const* ptr){ delete ptr; }
+        };
+    });
+} // detinfo::StandardProvidersCache::DetectorProperties()
+
+
+//------------------------------------------------------------------------------
+auto detinfo::StandardProvidersCache::Providers(
+  fhicl::ParameterSet const& larPropConfig,
+  fhicl::ParameterSet const& detClocksConfig,
+  fhicl::ParameterSet const& detPropConfig,
+  geo::GeometryCore const& geom,
+  std::set<std::string> const& detPropIgnoreParams /* = {} */
+) -> StandardProviderPack_t
+{
+  StandardProviderPack_t pack;
+  pack.larProp = LArProperties(larPropConfig);
+  pack.detClocks = DetectorClocks(detClocksConfig);
+  pack.detProp
+    = DetectorProperties(detPropConfig, larPropConfig, geom, detPropIgnoreParams);
+  return pack;
+} // detinfo::StandardProvidersCache::Providers()
+
+
+//------------------------------------------------------------------------------
+std::size_t detinfo::StandardProvidersCache::NProviders() const {
+  return fLArProp.size() + fDetClocks.size() + fDetProp.size();
+} // detinfo::StandardProvidersCache::NProviders()
+
+
+//------------------------------------------------------------------------------
+void detinfo::StandardProvidersCache::Clear() {
+  fDetProp.clear();
+  fDetClocks.clear();
+  fLArProp.clear();
+} // detinfo::StandardProvidersCache::Clear()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,119 @@
+/**
+ * @file   lardataalg/DetectorInfo/StandardProvidersCache.h
+ * @brief  Cache of standard detector providers keyed by their configuration.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/StandardProvidersCache.cxx
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_STANDARDPROVIDERSCACHE_H
+#define LARDATAALG_DETECTORINFO_STANDARDPROVIDERSCACHE_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksStandard.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/LArPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/ProviderCache.h"
+
+// framework libraries
+#include "fhiclcpp/ParameterSetID.h"
+#include "fhiclcpp/fwd.h"
+
+// C/C++ standard libraries
+#include <memory> // std::shared_ptr
+#include <set>
+#include <string>
+#include <tuple>
+
+
+namespace geo { class GeometryCore; }
+
+namespace detinfo {
+
+  /// The three standard detector information providers, shared and constant.
+  struct StandardProviderPack_t {
+    std::shared_ptr<LArPropertiesStandard const> larProp;
+    std::shared_ptr<DetectorClocksStandard const> detClocks;
+    std::shared_ptr<DetectorPropertiesStandard const> detProp;
+  }; // StandardProviderPack_t
+
+
+  /**
+   * @brief Creates standard detector providers, once per configuration.
+   *
+   * Jobs evaluating many detector configurations (for example, validation of
+   * all the shipped configurations) can request the providers through this
+   * cache: each distinct configuration is validated and built only once, and
+   * the same constant provider is returned on any later request.
+   * Requests may come concurrently from different threads.
+   *
+   * Providers are identified by the hash (`fhicl::ParameterSetID`) of their
+   * configuration; the detector properties provider is identified also by the
+   * configuration of the liquid argon properties and by the geometry it is
+   * bound to. The list of parameters to be ignored in the validation is not
+   * part of the key: it is expected to be the same for all the requests.
+   *
+   * The returned detector properties provider keeps alive the liquid argon
+   * properties provider it uses, even after the cache is destroyed; the
+   * geometry must instead be kept alive by the caller.
+   */
+  class StandardProvidersCache {
+      public:
+
+    /// Returns the liquid argon properties provider for `config`.
+    std::shared_ptr<LArPropertiesStandard const> LArProperties(
+      fhicl::ParameterSet const& config,
+      std::set<std::string> const& ignore_params = {}
+      );
+
+    /// Returns the detector clocks provider for `config`.
+    std::shared_ptr<DetectorClocksStandard const> DetectorClocks
+      (fhicl::ParameterSet const& config);
+
+    /**
+     * @brief Returns the detector properties provider for `config`.
+     * @param config configuration of the detector properties provider
+     * @param larPropConfig configuration of the liquid argon properties
+     * @param geom the geometry the provider is bound to
+     * @param ignore_params parameters to be ignored in `config` validation
+     * @return the provider
+     *
+     * The liquid argon properties provider is also obtained from the cache.
+     */
+    std::shared_ptr<DetectorPropertiesStandard const> DetectorProperties(
+      fhicl::ParameterSet const& config,
+      fhicl::ParameterSet const& larPropConfig,
+      geo::GeometryCore const& geom,
+      std::set<std::string> const& ignore_params = {}
+      );
+
+    /// Returns all the three providers for the specified configurations.
+    StandardProviderPack_t Providers(
+      fhicl::ParameterSet const& larPropConfig,
+      fhicl::ParameterSet const& detClocksConfig,
+      fhicl::ParameterSet const& detPropConfig,
+      geo::GeometryCore const& geom,
+      std::set<std::string> const& detPropIgnoreParams = {}
+      );
+
+    /// Returns the number of distinct providers built (or being built).
+    std::size_t NProviders() const;
+
+    /// Removes all the providers from the cache.
+    void Clear();
+
+      private:
+
+    /// Key of detector properties: configuration, LAr configuration, geometry.
+    using DetPropKey_t = std::tuple
+      <fhicl::ParameterSetID, fhicl::ParameterSetID, geo::GeometryCore const*>;
+
+    ProviderCache<fhicl::ParameterSetID, LArPropertiesStandard> fLArProp;
+    ProviderCache<fhicl::ParameterSetID, DetectorClocksStandard> fDetClocks;
+    ProviderCache<DetPropKey_t, DetectorPropertiesStandard> fDetProp;
+
+  }; // class StandardProvidersCache
+
+} // namespace detinfo
+
+
+#endif // LARDATAALG_DETECTORINFO_STANDARDPROVIDERSCACHE_H
@@ -0,0 +1,61 @@
+/**
+ * @file   lardataalg/DetectorInfo/StandardProvidersState.cxx
+ * @brief  Saving and reloading of the configured standard detector providers.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/StandardProvidersState.h
+ */
+
+// library header
+#include "lardataalg/DetectorInfo/StandardProvidersState.h"
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+
+//------------------------------------------------------------------------------
+void detinfo::saveStandardProviders(std::string const& path,
+                                    LArPropertiesStandard const& larProp,
+                                    DetectorClocksStandard const& detClocks,
+                                    DetectorPropertiesStandard const& detProp,
+                                    std::string const& tag /* = "" */)
+{
+  DetectorClocksData const clockData = detClocks.DataForJob();
+
+  BlobWriter out;
+  larProp.SaveState(out);
+  detClocks.SaveState(out);
+  detProp.SaveState(out, &clockData);
+  out.saveTo(path, StandardProvidersStateVersion, tag);
+
+} // detinfo::saveStandardProviders()
+
+
+//------------------------------------------------------------------------------
+auto detinfo::loadStandardProviders(std::string const& path,
+                                    geo::GeometryCore const* geom,
+                                    std::string const& tag /* = "" */)
+  -> StandardProviders_t
+{
+  MappedBlob const blob{path, StandardProvidersStateVersion, tag};
+  BlobReader in = blob.reader();
+
+  StandardProviders_t providers;
+  providers.larProp = std::make_unique<LArPropertiesStandard>();
+  providers.larProp->LoadState(in);
+  providers.detClocks = std::make_unique<DetectorClocksStandard>(in);
+  providers.detProp =
+    std::make_unique<DetectorPropertiesStandard>(in, geom, providers.larProp.get());
+
+  if (!in.atEnd()) {
+    throw cet::exception("BinaryBlob")
+      << "Unexpected data after the state of the providers in '" << path << "'\n";
+  }
+  return providers;
+
+} // detinfo::loadStandardProviders()
+
+
+//------------------------------------------------------------------------------
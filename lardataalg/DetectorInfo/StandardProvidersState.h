@@ -0,0 +1,84 @@
+/**
+ * @file   lardataalg/DetectorInfo/StandardProvidersState.h
+ * @brief  Saving and reloading of the configured standard detector providers.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/StandardProvidersState.cxx
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_STANDARDPROVIDERSSTATE_H
+#define LARDATAALG_DETECTORINFO_STANDARDPROVIDERSSTATE_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksStandard.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
+#include "lardataalg/DetectorInfo/LArPropertiesStandard.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint32_t
+#include <memory> // std::unique_ptr
+#include <string>
+
+
+namespace geo { class GeometryCore; }
+
+namespace detinfo {
+
+  /// Version of the content of the state files of the standard providers.
+  /// It must be increased on every change of the layout of the saved state.
+  inline constexpr std::uint32_t StandardProvidersStateVersion = 2U;
+
+
+  /// The three standard detector information providers.
+  struct StandardProviders_t {
+    std::unique_ptr<LArPropertiesStandard> larProp;
+    std::unique_ptr<DetectorClocksStandard> detClocks;
+    std::unique_ptr<DetectorPropertiesStandard> detProp;
+  }; // StandardProviders_t
+
+
+  /**
+   * @brief Saves the state of the configured standard providers into a file.
+   * @param path path of the file to be written
+   * @param larProp liquid argon properties provider
+   * @param detClocks detector clocks provider
+   * @param detProp detector properties provider
+   * @param tag a free tag to identify the configuration (up to 47 characters)
+   * @throw cet::exception on error
+   *
+   * Together with the configuration values, the drift conversion table that
+   * `detProp` computes for the default timing (`detClocks.DataForJob()`) is
+   * saved, so that reloading does not need to go through the geometry unless
+   * a different timing is requested.
+   *
+   * The file is written in the format of `detinfo::BlobWriter`.
+   */
+  void saveStandardProviders(std::string const& path,
+                             LArPropertiesStandard const& larProp,
+                             DetectorClocksStandard const& detClocks,
+                             DetectorPropertiesStandard const& detProp,
+                             std::string const& tag = "");
+
+  /**
+   * @brief Creates the standard providers from the state saved in a file.
+   * @param path path of the file written by `saveStandardProviders()`
+   * @param geom geometry provider for the detector properties (may be null)
+   * @param tag the tag the file is required to have (empty to accept any)
+   * @return the restored providers
+   * @throw cet::exception (category: `"BinaryBlob"`) on any mismatch
+   *
+   * The file is memory-mapped and its checksum verified. The caller is
+   * expected to fall back to the configuration from FHiCL when an exception
+   * is thrown (for example, because the file was written by a different
+   * version of the code, or for a different configuration `tag`).
+   *
+   * If `geom` is `nullptr`, the detector properties provider can serve only
+   * the timing configuration the file was saved with.
+   */
+  StandardProviders_t loadStandardProviders(std::string const& path,
+                                            geo::GeometryCore const* geom,
+                                            std::string const& tag = "");
+
+} // namespace detinfo
+
+
+#endif // LARDATAALG_DETECTORINFO_STANDARDPROVIDERSSTATE_H
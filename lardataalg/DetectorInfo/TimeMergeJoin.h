@@ -0,0 +1,327 @@
+/**
+ * @file   lardataalg/DetectorInfo/TimeMergeJoin.h
+ * @brief  Time-ordered merge and coincidence matching of sorted streams.
+ * @date   October 17, 2026
+ *
+ * This library is header-only.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_TIMEMERGEJOIN_H
+#define LARDATAALG_DETECTORINFO_TIMEMERGEJOIN_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h" // detinfo::timescales
+#include "lardataalg/DetectorInfo/DetectorTimings.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::push_heap(), std::pop_heap()
+#include <cstddef> // std::size_t
+#include <functional> // std::function
+#include <iterator> // std::distance()
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <type_traits> // std::decay_t
+#include <utility> // std::move(), std::as_const()
+#include <vector>
+
+
+namespace detinfo {
+
+  /**
+   * @brief Merges and matches time-sorted streams on different time scales.
+   * @tparam CommonTime type of time point of the scale all times are moved to
+   *
+   * Each stream is a sequence of elements sorted by time, for example optical
+   * flashes on the optical time scale and hits on the TPC electronics time
+   * scale. Streams are added with `addStream()`, which needs a function
+   * extracting the time from each element. The time of an element is moved to
+   * the common time scale only when the element is reached, and at the cost
+   * of a single addition: the shift between the two scales is computed once
+   * per stream with `detinfo::DetectorTimings`.
+   *
+   * The streams can then be:
+   * * merged (`merge()`) into a single time-ordered sequence;
+   * * split into groups of coincident elements (`groups()`);
+   * * matched against one reference stream (`join()`): each element of the
+   *   reference is associated with the elements of the other streams within
+   *   a time window around it.
+   *
+   * All the operations visit each element a bounded number of times, so that
+   * their cost grows linearly with the total number of elements (and with the
+   * logarithm of the number of streams for `merge()` and `groups()`), in
+   * addition to the size of the output.
+   *
+   * Elements are identified by an `Element_t` record with the number of the
+   * stream, the index of the element within the stream, and its time on the
+   * common scale. The streams are not copied: the caller must keep them
+   * alive and unchanged for the whole life of this object.
+   *
+   * Example matching flashes and hits within 2 microseconds:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * using namespace detinfo::timescales;
+   * detinfo::TimeMergeJoin<electronics_time> matcher
+   *   { detinfo::makeDetectorTimings(clockData) };
+   *
+   * std::size_t const flashStream = matcher.addStream(flashes.begin(), flashes.end(),
+   *   [](recob::OpFlash const& flash){ return optical_time{ flash.AbsTime() }; });
+   * matcher.addStream(hits.begin(), hits.end(), [&timings](recob::Hit const& hit)
+   *   { return timings.toTimeScale<TPCelectronics_time>(TPCelectronics_tick_d{ hit.PeakTime() }); });
+   *
+   * matcher.join(flashStream, 2_us, 2_us,
+   *   [](auto const& flash, auto const& matches){ ... });
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * Streams not sorted by time produce unspecified (but safe) results.
+   */
+  template <typename CommonTime = timescales::electronics_time>
+  class TimeMergeJoin {
+
+      public:
+
+    using time_point_t = CommonTime; ///< Type of time on the common scale.
+    using time_interval_t = timescales::time_interval; ///< Type of interval.
+
+    /// Record of an element of a stream.
+    struct Element_t {
+      std::size_t stream; ///< Number of the stream.
+      std::size_t index; ///< Index of the element within the stream.
+      time_point_t time; ///< Time of the element on the common scale.
+    }; // Element_t
+
+    /// Range of elements `[ begin, end [` of a stream.
+    struct Range_t {
+      std::size_t stream; ///< Number of the stream.
+      std::size_t begin; ///< Index of the first element in the range.
+      std::size_t end; ///< Index after the last element in the range.
+
+      /// Returns the number of elements in the range.
+      std::size_t size() const { return end - begin; }
+
+      /// Returns whether the range is empty.
+      bool empty() const { return begin == end; }
+    }; // Range_t
+
+
+    /// Constructor: uses `timings` to convert the times of the streams.
+    explicit TimeMergeJoin(detinfo::DetectorTimings const& timings)
+      : fTimings(timings) {}
+
+    /**
+     * @brief Adds a time-sorted stream.
+     * @tparam BIter type of random access iterator to the elements
+     * @tparam EIter type of end iterator
+     * @tparam TimeOf type of function extracting the time from an element
+     * @param begin iterator to the first element of the stream
+     * @param end iterator past the last element of the stream
+     * @param timeOf function returning the time (any time scale) of an element
+     * @return the number of the new stream
+     */
+    template <typename BIter, typename EIter, typename TimeOf>
+    std::size_t addStream(BIter begin, EIter end, TimeOf timeOf);
+
+    /// Adds a stream of time points (of any time scale) from a collection.
+    template <typename Coll>
+    std::size_t addStream(Coll const& times)
+      { return addStream(times.begin(), times.end(), [](auto t){ return t; }); }
+
+    /// Returns the number of streams.
+    std::size_t nStreams() const { return fStreams.size(); }
+
+    /// Returns the number of elements in stream `stream`.
+    std::size_t streamSize(std::size_t stream) const
+      { return fStreams.at(stream).size; }
+
+    /// Returns the time of an element on the common scale.
+    time_point_t timeOf(std::size_t stream, std::size_t index) const
+      { return fStreams[stream].time(index); }
+
+
+    /**
+     * @brief Calls `func(Element_t const&)` on all elements in time order.
+     *
+     * Elements with the same time are visited in order of stream number.
+     */
+    template <typename Func>
+    void merge(Func&& func) const;
+
+    /**
+     * @brief Splits the merged elements into groups of coincident ones.
+     * @param window maximum time of a group element after the first one
+     * @param func called as `func(std::vector<Element_t> const&)` per group
+     *
+     * Each group starts with the first element not yet grouped, and includes
+     * all the following elements not later than `window` after it.
+     */
+    template <typename Func>
+    void groups(time_interval_t window, Func&& func) const;
+
+    /**
+     * @brief Matches the elements of the other streams to a reference stream.
+     * @param reference number of the reference stream
+     * @param before how much earlier than a reference element a match may be
+     * @param after how much later than a reference element a match may be
+     * @param func called as `func(Element_t const&, std::vector<Range_t> const&)`
+     * @throw std::out_of_range if there is no `reference` stream
+     *
+     * `func` is called once per element of the reference stream, with the
+     * ranges of elements of each of the other streams (in stream order) with
+     * time in `[ t - before, t + after ]`, `t` being the time of the reference
+     * element. The same element may match more reference elements.
+     */
+    template <typename Func>
+    void join(
+      std::size_t reference, time_interval_t before, time_interval_t after,
+      Func&& func
+      ) const;
+
+
+      private:
+
+    /// Information on a stream.
+    struct Stream_t {
+      std::size_t size; ///< Number of elements.
+      std::function<time_point_t(std::size_t)> time; ///< Time of element.
+    }; // Stream_t
+
+    detinfo::DetectorTimings fTimings; ///< Conversion of time scales.
+    std::vector<Stream_t> fStreams; ///< All the streams.
+
+    /// Calls `func(Element_t const&)` on the elements in time order.
+    template <typename Func>
+    void mergeImpl(Func&& func) const;
+
+  }; // class TimeMergeJoin
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename CommonTime>
+template <typename BIter, typename EIter, typename TimeOf>
+std::size_t detinfo::TimeMergeJoin<CommonTime>::addStream
+  (BIter begin, EIter end, TimeOf timeOf)
+{
+  using FromTime = std::decay_t<decltype(timeOf(*begin))>;
+
+  // the shift is the time of the origin of the stream scale on the common one
+  time_point_t const origin
+    = fTimings.template toTimeScale<time_point_t>(FromTime{ 0.0 });
+
+  std::size_t const size = std::distance(begin, end);
+  fStreams.push_back({ size,
+    [begin, timeOf=std::move(timeOf), origin](std::size_t index)
+      { return origin + timeOf(begin[index]).quantity(); }
+    });
+  return fStreams.size() - 1U;
+} // detinfo::TimeMergeJoin<>::addStream()
+
+
+//------------------------------------------------------------------------------
+template <typename CommonTime>
+template <typename Func>
+void detinfo::TimeMergeJoin<CommonTime>::merge(Func&& func) const {
+  mergeImpl(std::forward<Func>(func));
+} // detinfo::TimeMergeJoin<>::merge()
+
+
+//------------------------------------------------------------------------------
+template <typename CommonTime>
+template <typename Func>
+void detinfo::TimeMergeJoin<CommonTime>::groups
+  (time_interval_t window, Func&& func) const
+{
+  std::vector<Element_t> group;
+  mergeImpl([&group, &func, window](Element_t const& element)
+    {
+      if (!group.empty() && (element.time - group.front().time > window)) {
+        func(std::as_const(group));
+        group.clear();
+      }
+      group.push_back(element);
+    });
+  if (!group.empty()) func(std::as_const(group));
+} // detinfo::TimeMergeJoin<>::groups()
+
+
+//------------------------------------------------------------------------------
+template <typename CommonTime>
+template <typename Func>
+void detinfo::TimeMergeJoin<CommonTime>::join(
+  std::size_t reference, time_interval_t before, time_interval_t after,
+  Func&& func
+) const {
+
+  if (reference >= nStreams()) {
+    throw std::out_of_range("TimeMergeJoin::join(): no reference stream #"
+      + std::to_string(reference) + " (" + std::to_string(nStreams())
+      + " streams)");
+  }
+
+  // one range per stream other than the reference, in stream order;
+  // each range only ever moves forward
+  std::vector<Range_t> ranges;
+  for (std::size_t stream = 0; stream < nStreams(); ++stream)
+    if (stream != reference) ranges.push_back({ stream, 0U, 0U });
+
+  Stream_t const& refStream = fStreams[reference];
+  for (std::size_t index = 0; index < refStream.size; ++index) {
+    Element_t const element { reference, index, refStream.time(index) };
+    time_point_t const start = element.time - before;
+    time_point_t const stop = element.time + after;
+
+    for (Range_t& range: ranges) {
+      Stream_t const& stream = fStreams[range.stream];
+      while ((range.begin < stream.size) && (stream.time(range.begin) < start))
+        ++range.begin;
+      if (range.end < range.begin) range.end = range.begin;
+      while ((range.end < stream.size) && !(stop < stream.time(range.end)))
+        ++range.end;
+    } // for streams
+
+    func(element, std::as_const(ranges));
+  } // for reference elements
+
+} // detinfo::TimeMergeJoin<>::join()
+
+
+//------------------------------------------------------------------------------
+template <typename CommonTime>
+template <typename Func>
+void detinfo::TimeMergeJoin<CommonTime>::mergeImpl(Func&& func) const {
+
+  // min-heap of the next element of each stream; ties resolved by stream
+  auto const later = [](Element_t const& a, Element_t const& b)
+    {
+      return (b.time < a.time) || (!(a.time < b.time) && (b.stream < a.stream));
+    };
+
+  std::vector<Element_t> heap;
+  heap.reserve(nStreams());
+  for (std::size_t stream = 0; stream < nStreams(); ++stream) {
+    if (fStreams[stream].size == 0U) continue;
+    heap.push_back({ stream, 0U, fStreams[stream].time(0U) });
+    std::push_heap(heap.begin(), heap.end(), later);
+  }
+
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    Element_t& next = heap.back();
+    func(std::as_const(next));
+
+    Stream_t const& stream = fStreams[next.stream];
+    if (++next.index < stream.size) {
+      next.time = stream.time(next.index);
+      std::push_heap(heap.begin(), heap.end(), later);
+    }
+    else heap.pop_back();
+  } // while
+
+} // detinfo::TimeMergeJoin<>::mergeImpl()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_DETECTORINFO_TIMEMERGEJOIN_H
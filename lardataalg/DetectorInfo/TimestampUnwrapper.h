@@ -0,0 +1,280 @@
+/**
+ * @file   lardataalg/DetectorInfo/TimestampUnwrapper.h
+ * @brief  Unwrapping of rolling over electronics timestamps.
+ * @date   October 17, 2026
+ *
+ * This library is header-only.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_TIMESTAMPUNWRAPPER_H
+#define LARDATAALG_DETECTORINFO_TIMESTAMPUNWRAPPER_H
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksException.h"
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h" // detinfo::timescales
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t, std::uint32_t
+#include <string>
+#include <vector>
+
+
+namespace detinfo {
+
+  /**
+   * @brief Converts rolling over timestamps of a stream into monotonic times.
+   * @tparam TimePoint type of time point on the output time scale
+   *
+   * In continuous readout, the hardware stamps each sample with its number
+   * within the current frame of an electronics clock (`ElecClock`), a counter
+   * which rolls over to `0` at the end of each frame. This object follows one
+   * stream of such raw timestamps, in the order they are read, and counts the
+   * frames, assigning each timestamp its absolute, 64-bit tick number and
+   * time.
+   *
+   * A timestamp smaller than the previous one marks the start of a new frame.
+   * To allow for data slightly out of order, a timestamp earlier than the
+   * latest one by no more than the configured tolerance (in ticks) is instead
+   * considered late, and assigned to the same frame as the latest one (or to
+   * the previous frame, if the latest timestamp has just rolled over).
+   * The tolerance must be smaller than half a frame. Rollovers are detected by
+   * comparing each timestamp only with the latest one, so the cost is constant
+   * per timestamp; but a stream with gaps longer than a frame can't be
+   * unwrapped correctly.
+   *
+   * Example of usage with the optical clock of `clockData`:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * detinfo::TimestampUnwrapper<detinfo::timescales::optical_time> unwrapper
+   *   { clockData.OpticalClock(), 16U };
+   *
+   * std::vector<detinfo::timescales::optical_time> times;
+   * for (std::vector<std::uint32_t> const& batch: batches)
+   *   unwrapper.unwrap(batch, times); // appends the times of the batch
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * Each stream needs its own unwrapper.
+   */
+  template <typename TimePoint = timescales::electronics_time>
+  class TimestampUnwrapper {
+
+      public:
+
+    using time_point_t = TimePoint; ///< Type of the output time.
+    using timestamp_t = std::uint32_t; ///< Type of raw timestamp (sample).
+    using tick_t = std::int64_t; ///< Type of the unwrapped tick number.
+
+    /**
+     * @brief Constructor: sets the clock and the tolerance.
+     * @param clock the clock of the timestamps (only frame and frequency used)
+     * @param tolerance how many ticks a timestamp may be late
+     * @param start time of the first tick of the first frame
+     * @throw DetectorClocksException if the tolerance is not below half frame
+     */
+    TimestampUnwrapper(
+      ElecClock const& clock, timestamp_t tolerance = 0U,
+      time_point_t start = time_point_t{}
+      );
+
+    /// Forgets all the timestamps seen so far, restarting from frame `0`.
+    void reset();
+
+
+    // --- BEGIN -- Unwrapping -------------------------------------------------
+    /// @name Unwrapping
+    /// @{
+
+    /**
+     * @brief Processes the next timestamp of the stream.
+     * @param timestamp raw timestamp (sample number within its frame)
+     * @return the absolute tick number of the timestamp
+     * @throw DetectorClocksException if `timestamp` is beyond the frame size
+     */
+    tick_t unwrapTick(timestamp_t timestamp);
+
+    /// Processes the next timestamp of the stream, returning its time.
+    time_point_t unwrap(timestamp_t timestamp)
+      { return timeOf(unwrapTick(timestamp)); }
+
+    /**
+     * @brief Processes a batch of timestamps of the stream.
+     * @param begin iterator to the first timestamp
+     * @param end iterator past the last timestamp
+     * @param out iterator to the first output time
+     * @return the output iterator past the last written time
+     */
+    template <typename BIter, typename EIter, typename OIter>
+    OIter unwrap(BIter begin, EIter end, OIter out);
+
+    /// Processes a batch of timestamps, appending their times to `times`.
+    void unwrap
+      (std::vector<timestamp_t> const& timestamps, std::vector<time_point_t>& times);
+
+    /// @}
+    // --- END -- Unwrapping ---------------------------------------------------
+
+
+    // --- BEGIN -- Status -----------------------------------------------------
+    /// @name Status
+    /// @{
+
+    /// Returns the time of the absolute tick `tick`.
+    time_point_t timeOf(tick_t tick) const;
+
+    /// Returns the number of ticks in a frame.
+    tick_t frameTicks() const { return fFrameTicks; }
+
+    /// Returns the tolerance on late timestamps [ticks].
+    timestamp_t tolerance() const { return fTolerance; }
+
+    /// Returns the number of the frame of the latest timestamp.
+    tick_t frame() const { return fFrame; }
+
+    /// Returns the absolute tick of the latest timestamp (`-1` if none).
+    tick_t latestTick() const
+      { return fStarted? fFrame * fFrameTicks + fLatest: tick_t(-1); }
+
+    /// Returns the number of timestamps processed.
+    std::size_t nTimestamps() const { return fNTimestamps; }
+
+    /// Returns the number of rollovers detected.
+    std::size_t nRollovers() const { return fFrame; }
+
+    /// Returns the number of timestamps found late (within tolerance).
+    std::size_t nLate() const { return fNLate; }
+
+    /// @}
+    // --- END -- Status -------------------------------------------------------
+
+
+      private:
+
+    tick_t fFrameTicks; ///< Ticks in a frame.
+    timestamp_t fTolerance; ///< Tolerance on late timestamps [ticks].
+    double fFramePeriod; ///< Duration of a frame [us].
+    double fTickPeriod; ///< Duration of a tick [us].
+    time_point_t fStart; ///< Time of tick `0`.
+
+    bool fStarted = false; ///< Whether any timestamp was processed.
+    tick_t fFrame = 0; ///< Frame of the latest timestamp.
+    tick_t fLatest = 0; ///< Latest timestamp (sample number in its frame).
+    std::size_t fNTimestamps = 0U; ///< Number of processed timestamps.
+    std::size_t fNLate = 0U; ///< Number of late timestamps.
+
+  }; // class TimestampUnwrapper
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename TimePoint>
+detinfo::TimestampUnwrapper<TimePoint>::TimestampUnwrapper(
+  ElecClock const& clock, timestamp_t tolerance, time_point_t start
+)
+  : fFrameTicks(clock.FrameTicks())
+  , fTolerance(tolerance)
+  , fFramePeriod(clock.FramePeriod())
+  , fTickPeriod(1.0 / clock.Frequency())
+  , fStart(start)
+{
+  if (fFrameTicks <= 2 * static_cast<tick_t>(fTolerance)) {
+    throw DetectorClocksException("TimestampUnwrapper: tolerance of "
+      + std::to_string(fTolerance) + " ticks must be smaller than half a frame ("
+      + std::to_string(fFrameTicks) + " ticks)");
+  }
+} // detinfo::TimestampUnwrapper<>::TimestampUnwrapper()
+
+
+//------------------------------------------------------------------------------
+template <typename TimePoint>
+void detinfo::TimestampUnwrapper<TimePoint>::reset() {
+  fStarted = false;
+  fFrame = 0;
+  fLatest = 0;
+  fNTimestamps = 0U;
+  fNLate = 0U;
+} // detinfo::TimestampUnwrapper<>::reset()
+
+
+//------------------------------------------------------------------------------
+template <typename TimePoint>
+auto detinfo::TimestampUnwrapper<TimePoint>::unwrapTick(timestamp_t timestamp)
+  -> tick_t
+{
+  tick_t const sample = timestamp;
+  if (sample >= fFrameTicks) {
+    throw DetectorClocksException("TimestampUnwrapper: timestamp "
+      + std::to_string(timestamp) + " beyond the frame size ("
+      + std::to_string(fFrameTicks) + " ticks)");
+  }
+
+  ++fNTimestamps;
+  if (!fStarted) {
+    fStarted = true;
+    fLatest = sample;
+    return sample;
+  }
+
+  tick_t const tolerance = fTolerance;
+  tick_t const delta = sample - fLatest;
+  if (delta < -tolerance) { // rolled over into a new frame
+    ++fFrame;
+    fLatest = sample;
+  }
+  else if (delta > fFrameTicks - tolerance) { // late, from the previous frame
+    ++fNLate;
+    return (fFrame - 1) * fFrameTicks + sample;
+  }
+  else if (delta < 0) { // late, from the current frame
+    ++fNLate;
+  }
+  else fLatest = sample;
+
+  return fFrame * fFrameTicks + sample;
+} // detinfo::TimestampUnwrapper<>::unwrapTick()
+
+
+//------------------------------------------------------------------------------
+template <typename TimePoint>
+template <typename BIter, typename EIter, typename OIter>
+OIter detinfo::TimestampUnwrapper<TimePoint>::unwrap
+  (BIter begin, EIter end, OIter out)
+{
+  while (begin != end) *out++ = unwrap(*begin++);
+  return out;
+} // detinfo::TimestampUnwrapper<>::unwrap(iterators)
+
+
+//------------------------------------------------------------------------------
+template <typename TimePoint>
+void detinfo::TimestampUnwrapper<TimePoint>::unwrap
+  (std::vector<timestamp_t> const& timestamps, std::vector<time_point_t>& times)
+{
+  times.reserve(times.size() + timestamps.size());
+  for (timestamp_t const timestamp: timestamps)
+    times.push_back(unwrap(timestamp));
+} // detinfo::TimestampUnwrapper<>::unwrap(vector)
+
+
+//------------------------------------------------------------------------------
+template <typename TimePoint>
+auto detinfo::TimestampUnwrapper<TimePoint>::timeOf(tick_t tick) const
+  -> time_point_t
+{
+  // as in ElecClock::Time(sample, frame), without the `int` limitations;
+  // the floor division keeps the sample in the frame also for negative ticks
+  tick_t frame = tick / fFrameTicks;
+  tick_t sample = tick % fFrameTicks;
+  if (sample < 0) { sample += fFrameTicks; --frame; }
+  return fStart + timescales::time_interval
+    { frame * fFramePeriod + sample * fTickPeriod };
+} // detinfo::TimestampUnwrapper<>::timeOf()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_DETECTORINFO_TIMESTAMPUNWRAPPER_H
@@ -0,0 +1,96 @@
+/**
+ * @file   lardataalg/DetectorInfo/VectorExp.h
+ * @brief  Exponential function which the compiler can vectorize.
+ * @date   October 17, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_DETECTORINFO_VECTOREXP_H
+#define LARDATAALG_DETECTORINFO_VECTOREXP_H
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::memcpy()
+
+
+namespace detinfo {
+
+  namespace details {
+
+    /**
+     * @brief Exponential function written to be vectorized by the compiler.
+     * @param x the exponent
+     * @return `exp(x)`, with a relative error below `1e-15`
+     *
+     * The argument is split into `n ln(2) + r` with `|r| <= ln(2) / 2`:
+     * `exp(r)` is evaluated with its Taylor polynomial of degree 12, and the
+     * result is scaled by `2^n` by writing `n` into the exponent bits.
+     * There are no branches, comparisons nor library calls, so that loops
+     * calling this function can be vectorized without relaxing the floating
+     * point semantics.
+     *
+     * The relative error is below `1e-15` where the result is a normal number.
+     * Like `std::exp()`, the result overflows into infinity for `x` above
+     * about `709.8` and underflows to `0` below about `-745`; it is undefined
+     * for `|x| > 1400` and for not-a-number.
+     */
+    inline double vectorExp(double x);
+
+  } // namespace details
+
+} // namespace detinfo
+
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+double detinfo::details::vectorExp(double x) {
+
+  constexpr double Log2e = 1.4426950408889634; // 1 / ln(2)
+  constexpr double Ln2hi = 6.93147180369123816490e-01; // ln(2), high bits
+  constexpr double Ln2lo = 1.90821492927058770002e-10; // ln(2), low bits
+  constexpr double Shifter = 6755399441055744.0; // 1.5 * 2^52
+
+  // returns 2^k for integral k in [ -1022, 1023 ] and t = k + Shifter
+  auto const pow2 = [](double t)
+    {
+      // the low bits of t hold k: biased and shifted into the exponent
+      std::uint64_t bits;
+      std::memcpy(&bits, &t, sizeof(bits));
+      bits = (bits + 1023U) << 52;
+      double value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    };
+
+  // adding Shifter rounds to the nearest integer, stored in the low bits
+  double const t = x * Log2e + Shifter;
+  double const n = t - Shifter;
+  double const r = (x - n * Ln2hi) - n * Ln2lo;
+
+  double p = 1.0 / 479001600.0; // 1/12!
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  // 2^n as 2^n1 2^(n - n1), so that the result overflows or underflows
+  // instead of wrapping the exponent bits
+  double const t1 = n * 0.5 + Shifter;
+  double const n1 = t1 - Shifter;
+  return p * pow2(t1) * pow2((n - n1) + Shifter);
+} // detinfo::details::vectorExp()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATAALG_DETECTORINFO_VECTOREXP_H
@@ -0,0 +1,520 @@
+/**
+ * @file   lardataalg/Dumpers/RawData/RawDigit.h
+ * @brief  Utilities to dump `raw::RawDigit` objects on screen.
+ * @date   October 17, 2026
+ *
+ * Currently this is a header-only library.
+ *
+ */
+
+#ifndef LARDATAALG_DUMPERS_RAWDATA_RAWDIGIT_H
+#define LARDATAALG_DUMPERS_RAWDATA_RAWDIGIT_H
+
+
+// LArSoft includes
+#include "lardataalg/Dumpers/DumperBase.h"
+#include "lardataalg/Utilities/StatCollector.h" // lar::util::StatCollector, ...
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RawData/raw.h" // raw::Uncompress()
+
+// C//C++ standard libraries
+#include <vector>
+#include <string>
+#include <algorithm> // std::min(), std::copy_n(), std::fill_n()
+#include <iomanip> // std::setw()
+#include <iterator> // std::size()
+#include <utility> // std::forward(), std::swap()
+#include <cstddef> // std::size_t
+
+
+namespace dump::raw {
+
+  using namespace ::raw;
+
+  namespace details {
+
+    /**
+     * @brief Decodes the ADC counts of a `raw::RawDigit` one block at a time.
+     *
+     * Uncompressed, zero-suppressed (`raw::kZeroSuppression`) and
+     * Huffman-encoded (`raw::kHuffman`) digits are decoded on the fly, without
+     * ever holding the whole uncompressed waveform in memory.
+     * Digits with any other compression are fully uncompressed with
+     * `raw::Uncompress()` into a buffer provided by the caller, which is then
+     * served one block at a time.
+     * Ticks not stored in a zero-suppressed digit are assigned the pedestal of
+     * the digit, as `raw::Uncompress()` does.
+     */
+    class RawDigitDecoder {
+        public:
+
+      /**
+       * @brief Constructor: prepares the decoding of `digit`.
+       * @param digit the digit to be decoded
+       * @param buffer buffer for digits which can't be decoded on the fly
+       */
+      RawDigitDecoder
+        (::raw::RawDigit const& digit, std::vector<short>& buffer);
+
+      /// Returns whether the digit is decoded without full decompression.
+      bool isStreaming() const { return fMode != Mode::Buffered; }
+
+      /// Returns the number of ticks decoded so far.
+      std::size_t tick() const { return fTick; }
+
+      /**
+       * @brief Decodes the next ticks.
+       * @param dest where to write the ADC counts
+       * @param maxTicks the maximum number of ticks to be written
+       * @return the number of ticks written, `0` when all are decoded
+       */
+      std::size_t next(short* dest, std::size_t maxTicks);
+
+        private:
+
+      /// How the digit is being decoded.
+      enum class Mode { Plain, ZeroSuppressed, Huffman, Buffered };
+
+      Mode fMode; ///< How the digit is being decoded.
+      short const* fADC; ///< Start of the stored ADC words.
+      std::size_t fNADC; ///< Number of stored ADC words.
+      std::size_t fNTicks; ///< Number of ticks after decoding.
+      std::size_t fTick = 0U; ///< Number of ticks decoded so far.
+      std::size_t fIndex = 0U; ///< Next ADC word to be read.
+      short fPedestal; ///< Value of the ticks not stored.
+
+      // zero suppression
+      std::size_t fNBlocks = 0U; ///< Number of stored blocks.
+      std::size_t fBlock = 0U; ///< Current stored block.
+
+      // Huffman encoding
+      short fLast = 0; ///< Last decoded value.
+      unsigned int fWord = 0U; ///< Huffman-encoded word being decoded.
+      int fBit = -1; ///< Next bit of `fWord` to decode (`-1`: none left).
+
+      /// Returns the first tick of the stored block `block`.
+      std::size_t blockStart(std::size_t block) const
+        { return static_cast<unsigned short>(fADC[2U + block]); }
+
+      /// Returns the number of ticks of the stored block `block`.
+      std::size_t blockSize(std::size_t block) const
+        { return static_cast<unsigned short>(fADC[2U + fNBlocks + block]); }
+
+      std::size_t nextPlain(short* dest, std::size_t maxTicks);
+      std::size_t nextZeroSuppressed(short* dest, std::size_t maxTicks);
+      std::size_t nextHuffman(short* dest, std::size_t maxTicks);
+
+    }; // class RawDigitDecoder
+
+  } // namespace details
+
+
+  /**
+   * @brief Prints the content of TPC raw digits on screen.
+   *
+   * Example of usage:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * dump::raw::RawDigitDumper dump { 20U };
+   * dump.setIndent("  ");
+   *
+   * for (raw::RawDigit const& digit: digits)
+   *   dump(mf::LogVerbatim("dumper"), digit);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * For each digit, a summary is printed with the number of ticks, the average
+   * of the ADC counts (a pedestal estimation), their RMS and their range.
+   * If requested, the ADC counts are also printed, with consecutive identical
+   * lines collapsed into a single one as in `OpDetWaveformDumper`.
+   *
+   * The digits are decoded one block of ticks at a time into a buffer owned
+   * by the dumper and reused for all digits (see `details::RawDigitDecoder`
+   * for the supported compression formats), so that the memory used does not
+   * depend on the length of the readout.
+   */
+  class RawDigitDumper: public DumperBase {
+      public:
+
+    /// Default number of ticks decoded at a time.
+    static constexpr std::size_t DefaultBlockSize = 4096U;
+
+    /// Summary of the content of a digit.
+    struct ChannelSummary_t {
+      ::raw::ChannelID_t channel; ///< The channel of the digit.
+      std::size_t nTicks = 0U; ///< Number of decoded ticks.
+      lar::util::StatCollector<double> stats; ///< ADC statistics.
+      lar::util::MinMaxCollector<short> range; ///< ADC range.
+    }; // ChannelSummary_t
+
+
+    /**
+     * @brief Constructor: sets digit dump parameters.
+     * @param digitsPerLine (default: `0`) how many ADC digits to print per
+     *                      line; `0` disables the digit printing completely
+     * @param blockSize (default: `DefaultBlockSize`) number of ticks decoded
+     *                  at a time
+     *
+     * Note that no indentation is set. If some is desired, set it with
+     * `setIndent()` after construction.
+     */
+    RawDigitDumper
+      (unsigned int digitsPerLine = 0U, std::size_t blockSize = DefaultBlockSize)
+      : fDigitsPerLine(digitsPerLine)
+      , fBlock(std::max(blockSize, std::size_t(1)))
+      {}
+
+
+    /**
+     * @brief Dumps the content of a digit into the specified output stream.
+     * @tparam Stream type of stream to dump data into
+     * @param stream stream to dump data into
+     * @param digit the object to be dumped
+     *
+     * Indentation is regulated via base class methods (see `setIndent()`).
+     */
+    template <typename Stream>
+    void dump(Stream&& stream, ::raw::RawDigit const& digit);
+
+    /// An alias of `dump()`.
+    template <typename Stream>
+    void operator()(Stream&& stream, ::raw::RawDigit const& digit)
+      { dump(stream, digit); }
+
+
+    /// Returns statistics of the content of `digit`, without printing.
+    ChannelSummary_t summarize(::raw::RawDigit const& digit);
+
+    /**
+     * @brief Calls `func` on each decoded block of ticks of `digit`.
+     * @tparam Func type of the callable object
+     * @param digit the digit to be decoded
+     * @param func called as `func(firstTick, begin, end)` for each block
+     * @return whether the digit was decoded without full decompression
+     *
+     * The pointers `begin` and `end` delimit the ADC counts of the block,
+     * whose first tick is `firstTick`. They are valid only during the call.
+     */
+    template <typename Func>
+    bool forEachBlock(::raw::RawDigit const& digit, Func&& func);
+
+
+    /// Returns a name for the specified compression type.
+    static std::string compressionName(::raw::Compress_t compression);
+
+      private:
+
+    unsigned int fDigitsPerLine;  ///< ADC readings per line in the output.
+
+    std::vector<short> fBlock; ///< Buffer for the decoded block.
+
+    /// Buffer for digits which can't be decoded a block at a time.
+    std::vector<short> fUncompressed;
+
+    /**
+     * @brief Decodes `digit` collecting its summary, and calls `func` on each
+     *        block.
+     * @see `forEachBlock()`, `summarize()`
+     */
+    template <typename Func>
+    ChannelSummary_t summarizeBlocks(::raw::RawDigit const& digit, Func&& func);
+
+  }; // class RawDigitDumper
+
+} // namespace dump::raw
+
+
+// -----------------------------------------------------------------------------
+// ---  Template implementation
+// -----------------------------------------------------------------------------
+template <typename Func>
+bool dump::raw::RawDigitDumper::forEachBlock
+  (::raw::RawDigit const& digit, Func&& func)
+{
+  details::RawDigitDecoder decoder { digit, fUncompressed };
+  while (true) {
+    std::size_t const firstTick = decoder.tick();
+    std::size_t const n = decoder.next(fBlock.data(), fBlock.size());
+    if (n == 0U) break;
+    func(firstTick, fBlock.data(), fBlock.data() + n);
+  } // while
+  return decoder.isStreaming();
+} // dump::raw::RawDigitDumper::forEachBlock()
+
+
+// -----------------------------------------------------------------------------
+template <typename Func>
+auto dump::raw::RawDigitDumper::summarizeBlocks
+  (::raw::RawDigit const& digit, Func&& func) -> ChannelSummary_t
+{
+  ChannelSummary_t summary;
+  summary.channel = digit.Channel();
+  forEachBlock(digit,
+    [&summary, &func](std::size_t firstTick, short const* begin, short const* end)
+    {
+      summary.nTicks += end - begin;
+      for (short const* iTick = begin; iTick != end; ++iTick) {
+        summary.stats.add(*iTick);
+        summary.range.add(*iTick);
+      }
+      func(firstTick, begin, end);
+    });
+  return summary;
+} // dump::raw::RawDigitDumper::summarizeBlocks()
+
+
+// -----------------------------------------------------------------------------
+template <typename Stream>
+void dump::raw::RawDigitDumper::dump
+  (Stream&& stream, ::raw::RawDigit const& digit)
+{
+  auto out = indenter(std::forward<Stream>(stream));
+
+  // print a header for the raw digit
+  out.start()
+    << "on channel #" << digit.Channel() << ": " << digit.Samples()
+    << " time ticks (" << compressionName(digit.Compression()) << ", "
+    << digit.NADC() << " words); pedestal: " << digit.GetPedestal()
+    << " RMS: " << digit.GetSigma();
+
+  // save and change indentation
+  saveIndentSettings().set(indent() + "  ");
+
+  if (fDigitsPerLine > 0) {
+    out.newline()
+      << "content of the channel (" << fDigitsPerLine << " ticks per line):";
+  }
+
+  unsigned int repeat_count = 0U; // additional lines like the last one
+
+  // local function for printing and resetting the repeat count
+  auto flushRepeatCount = [&out](unsigned int& count)
+    {
+      if (count == 0) return;
+      out.newline() << " [ ... repeated " << count << " more times ]";
+      count = 0;
+    };
+
+  std::vector<short> DigitBuffer, LastBuffer;
+  DigitBuffer.reserve(fDigitsPerLine);
+
+  // local function for printing a full line (or the last one)
+  auto flushLine = [&]()
+    {
+      // if the new buffer is the same as the old one, just mark it
+      if (DigitBuffer == LastBuffer) {
+        ++repeat_count;
+      }
+      else {
+        flushRepeatCount(repeat_count);
+        out.newline();
+        for (auto adc: DigitBuffer) out << " " << std::setw(4) << adc;
+        std::swap(LastBuffer, DigitBuffer);
+      }
+      DigitBuffer.clear();
+    };
+
+  ChannelSummary_t const summary = summarizeBlocks(digit,
+    [&](std::size_t, short const* begin, short const* end)
+    {
+      if (fDigitsPerLine == 0) return;
+      while (begin != end) {
+        std::size_t const n = std::min(
+          std::size_t(end - begin), fDigitsPerLine - DigitBuffer.size()
+          );
+        DigitBuffer.insert(DigitBuffer.end(), begin, begin + n);
+        begin += n;
+        if (DigitBuffer.size() == fDigitsPerLine) flushLine();
+      } // while
+    }
+    );
+  if (!DigitBuffer.empty()) flushLine();
+  flushRepeatCount(repeat_count);
+
+  if (summary.nTicks != digit.Samples()) {
+    out.newline() << "WARNING: " << summary.nTicks << " ticks decoded!";
+  }
+  if (summary.nTicks > 0) {
+    out.newline()
+      << "average: " << summary.stats.Average()
+      << " RMS: " << summary.stats.RMS()
+      << " range: [" << summary.range.min() << ";" << summary.range.max()
+      << "] (span: " << (summary.range.max() - summary.range.min()) << ")";
+  }
+
+  restoreIndentSettings();
+
+} // dump::raw::RawDigitDumper::dump()
+
+
+// -----------------------------------------------------------------------------
+// ---  Non-template implementation
+// -----------------------------------------------------------------------------
+inline dump::raw::details::RawDigitDecoder::RawDigitDecoder
+  (::raw::RawDigit const& digit, std::vector<short>& buffer)
+  : fMode(Mode::Plain)
+  , fADC(digit.ADCs().data())
+  , fNADC(digit.NADC())
+  , fNTicks(digit.Samples())
+  , fPedestal(static_cast<short>(digit.GetPedestal()))
+{
+  switch (digit.Compression()) {
+    case ::raw::kNone:
+      fMode = Mode::Plain;
+      fNTicks = std::min(fNTicks, fNADC);
+      break;
+    case ::raw::kZeroSuppression:
+      fMode = Mode::ZeroSuppressed;
+      if (fNADC < 2U) { fNTicks = 0U; break; }
+      fNTicks = static_cast<unsigned short>(fADC[0]);
+      fNBlocks = static_cast<unsigned short>(fADC[1]);
+      if (fNADC < 2U + 2U * fNBlocks) { fNTicks = 0U; break; }
+      fIndex = 2U + 2U * fNBlocks; // start of the stored ticks
+      break;
+    case ::raw::kHuffman:
+      fMode = Mode::Huffman;
+      break;
+    default:
+      fMode = Mode::Buffered;
+      buffer.resize(fNTicks);
+      ::raw::Uncompress(digit.ADCs(), buffer, fPedestal, digit.Compression());
+      fADC = buffer.data();
+      fNADC = buffer.size();
+      fNTicks = buffer.size();
+  } // switch
+} // dump::raw::details::RawDigitDecoder::RawDigitDecoder()
+
+
+// -----------------------------------------------------------------------------
+inline std::size_t dump::raw::details::RawDigitDecoder::next
+  (short* dest, std::size_t maxTicks)
+{
+  maxTicks = std::min(maxTicks, fNTicks - fTick);
+  if (maxTicks == 0U) return 0U;
+  std::size_t n = 0U;
+  switch (fMode) {
+    case Mode::Plain:
+    case Mode::Buffered:       n = nextPlain(dest, maxTicks);          break;
+    case Mode::ZeroSuppressed: n = nextZeroSuppressed(dest, maxTicks); break;
+    case Mode::Huffman:        n = nextHuffman(dest, maxTicks);        break;
+  } // switch
+  fTick += n;
+  return n;
+} // dump::raw::details::RawDigitDecoder::next()
+
+
+// -----------------------------------------------------------------------------
+inline std::size_t dump::raw::details::RawDigitDecoder::nextPlain
+  (short* dest, std::size_t maxTicks)
+{
+  std::size_t const n = std::min(maxTicks, fNADC - fIndex);
+  std::copy_n(fADC + fIndex, n, dest);
+  fIndex += n;
+  return n;
+} // dump::raw::details::RawDigitDecoder::nextPlain()
+
+
+// -----------------------------------------------------------------------------
+inline std::size_t dump::raw::details::RawDigitDecoder::nextZeroSuppressed
+  (short* dest, std::size_t maxTicks)
+{
+  std::size_t n = 0U;
+  while (n < maxTicks) {
+    std::size_t const tick = fTick + n;
+    std::size_t const left = maxTicks - n;
+    if ((fBlock < fNBlocks) && (tick >= blockStart(fBlock))) {
+      // inside a stored block: copy as much as possible of it
+      std::size_t const blockEnd = blockStart(fBlock) + blockSize(fBlock);
+      std::size_t const count = std::min({ left, blockEnd - tick, fNADC - fIndex });
+      std::copy_n(fADC + fIndex, count, dest + n);
+      fIndex += count;
+      n += count;
+      if (tick + count >= blockEnd) ++fBlock;
+      else if (count < left) break; // stored data ended early
+    }
+    else {
+      // in a gap: fill up to the next stored block
+      std::size_t const gapEnd
+        = (fBlock < fNBlocks)? blockStart(fBlock): fNTicks;
+      std::size_t const count = std::min(left, gapEnd - tick);
+      std::fill_n(dest + n, count, fPedestal);
+      n += count;
+    }
+  } // while
+  return n;
+} // dump::raw::details::RawDigitDecoder::nextZeroSuppressed()
+
+
+// -----------------------------------------------------------------------------
+inline std::size_t dump::raw::details::RawDigitDecoder::nextHuffman
+  (short* dest, std::size_t maxTicks)
+{
+  /*
+   * Huffman encoding as in `raw::CompressHuffman()`: the first word is the
+   * first ADC count; then, a word with the highest bit set holds codes for
+   * the difference from the previous tick, from the next highest bit down
+   * ("1": 0, "01": -1, "001": +1, "0001": -2, "00001": +2, "000001": -3,
+   * "0000001": +3); any other word is the absolute ADC count of one tick.
+   */
+  static constexpr short Differences[] = { 0, -1, +1, -2, +2, -3, +3 };
+
+  std::size_t n = 0U;
+  if ((fTick == 0U) && (fIndex == 0U)) {
+    if (fNADC == 0U) return 0U;
+    dest[n++] = fLast = fADC[fIndex++];
+  }
+
+  unsigned int zeros = 0U;
+  while (n < maxTicks) {
+    if (fBit < 0) { // next word
+      if (fIndex >= fNADC) break; // stored data ended early
+      short const word = fADC[fIndex++];
+      if (word & 0x8000) {
+        fWord = static_cast<unsigned short>(word);
+        fBit = 14;
+        zeros = 0U;
+      }
+      else dest[n++] = fLast = word;
+      continue;
+    }
+    // decode the current word until the end or until the block is full
+    while ((fBit >= 0) && (n < maxTicks)) {
+      if ((fWord >> fBit--) & 1U) {
+        if (zeros < std::size(Differences))
+          dest[n++] = fLast = fLast + Differences[zeros];
+        zeros = 0U;
+      }
+      else ++zeros;
+    } // while bits
+    // (the block can only become full right after a complete code)
+  } // while
+  return n;
+} // dump::raw::details::RawDigitDecoder::nextHuffman()
+
+
+// -----------------------------------------------------------------------------
+inline auto dump::raw::RawDigitDumper::summarize(::raw::RawDigit const& digit)
+  -> ChannelSummary_t
+{
+  return summarizeBlocks(digit, [](std::size_t, short const*, short const*){});
+} // dump::raw::RawDigitDumper::summarize()
+
+
+// -----------------------------------------------------------------------------
+inline std::string dump::raw::RawDigitDumper::compressionName
+  (::raw::Compress_t compression)
+{
+  switch (compression) {
+    case ::raw::kNone:            return "uncompressed";
+    case ::raw::kHuffman:         return "Huffman";
+    case ::raw::kZeroSuppression: return "zero suppression";
+    case ::raw::kZeroHuffman:     return "zero suppression + Huffman";
+    case ::raw::kDynamicDec:      return "dynamic decimation";
+    default:
+      return "compression #" + std::to_string(static_cast<int>(compression));
+  } // switch
+} // dump::raw::RawDigitDumper::compressionName()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_DUMPERS_RAWDATA_RAWDIGIT_H
@@ -18,7 +18,9 @@
 #include <string> // std::to_string()
 #include <iterator> // std::iterator_category, std::size(), ...
 #include <memory> // std::unique_ptr<>
-#include <algorithm> // std::reference_wrapper<>
+#include <algorithm> // std::reference_wrapper<>, std::copy()
+#include <type_traits> // std::void_t, std::false_type, ...
+#include <utility> // std::declval()
 #include <stdexcept> // std::out_of_range
 #include <limits> // std::numeric_limits<>
 #include <cstddef> // std::size_t
@@ -35,6 +37,10 @@ namespace util {
     template <typename Cont, typename = void> class ContainerStorage;
 
     // ---------------------------------------------------------------------------
+    template <typename Mapping, typename = void>
+    struct has_bulk_copy;
+
+    // ---------------------------------------------------------------------------
 
   } // namespace details
 
@@ -406,6 +412,24 @@ namespace util {
     /// @}
     // --- END Iteration -------------------------------------------------------
 
+
+    /**
+     * @brief Copies all the mapped elements into a destination sequence.
+     * @tparam OutIter type of iterator to the destination
+     * @param dest iterator to the first element of the destination
+     * @return an iterator past the last written element
+     *
+     * Exactly `size()` elements are written, as if `std::copy(begin(), end(),
+     * dest)` were called.
+     * If the mapping supports bulk copy (like `util::RunLengthMapping`, whose
+     * runs are copied at once), that is used instead of the element-by-element
+     * mapping; in that case, both data container and destination must
+     * support random access, and the elements beyond the size of the mapping
+     * are assigned the default value.
+     */
+    template <typename OutIter>
+    OutIter copy_to(OutIter dest) const;
+
       protected:
 
     /// Returns the minimum size to include all mapped values.
@@ -534,6 +558,25 @@ namespace util {
     }; // struct ContainerStorage
 
 
+    //--------------------------------------------------------------------------
+    //---  has_bulk_copy
+    //--------------------------------------------------------------------------
+    /// Trait: whether `Mapping` has a `copyMapped(data, dest, defValue, n)`
+    /// method.
+    template <typename Mapping, typename /* = void */>
+    struct has_bulk_copy: std::false_type {};
+
+    template <typename Mapping>
+    struct has_bulk_copy<
+      Mapping,
+      std::void_t<decltype(std::declval<Mapping const&>().copyMapped(
+        std::declval<int const*>(), std::declval<int*>(), 0, std::size_t{}
+        ))>
+      >
+      : std::true_type
+      {};
+
+
     //--------------------------------------------------------------------------
 
 
@@ -814,6 +857,21 @@ decltype(auto) util::MappedContainer<Cont, Mapping>::at
 } // util::MappedContainer<>::at()
 
 
+//------------------------------------------------------------------------------
+template <typename Cont, typename Mapping>
+template <typename OutIter>
+OutIter util::MappedContainer<Cont, Mapping>::copy_to(OutIter dest) const {
+  using MappingCont_t
+    = std::remove_cv_t<std::remove_reference_t<decltype(fMapping.container())>>;
+  if constexpr (details::has_bulk_copy<MappingCont_t>::value) {
+    // the mapping may cover more or fewer elements than the container has
+    return fMapping.container().copyMapped
+      (fData.container(), dest, defaultValue(), size());
+  }
+  else return std::copy(begin(), end(), dest);
+} // util::MappedContainer<>::copy_to()
+
+
 //------------------------------------------------------------------------------
 template <typename Cont, typename Mapping>
 auto util::MappedContainer<Cont, Mapping>::minimal_size
@@ -0,0 +1,389 @@
+/**
+ * @file   lardataalg/Utilities/RunLengthMapping.h
+ * @brief  Provides `RunLengthMapping`, a compact index mapping.
+ * @date   October 17, 2026
+ * @see    lardataalg/Utilities/MappedContainer.h
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_UTILITIES_RUNLENGTHMAPPING_H
+#define LARDATAALG_UTILITIES_RUNLENGTHMAPPING_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::upper_bound(), std::copy_n(), std::fill(), ...
+#include <iterator> // std::begin(), std::next(), std::forward_iterator_tag
+#include <limits> // std::numeric_limits<>
+#include <stdexcept> // std::invalid_argument
+#include <string> // std::to_string()
+#include <type_traits> // std::is_pointer_v
+#include <vector>
+#include <cstddef> // std::size_t, std::ptrdiff_t
+
+
+namespace util {
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Index mapping stored as runs of consecutive indices.
+   * @tparam Index type of the mapped index
+   *
+   * This object maps an index (the "destination") into another (the "source"),
+   * like a `std::vector<Index>` whose element `i` is the source index for the
+   * destination `i`, or `InvalidIndex` if `i` is not mapped.
+   * It can be used as mapping of `util::MappedContainer`.
+   *
+   * The mapping is stored as a list of runs: in each run, a sequence of
+   * consecutive destination indices is mapped to a sequence of consecutive
+   * source indices. The destination indices not covered by any run are not
+   * mapped. The memory used is proportional to the number of runs rather than
+   * to the number of indices, which is very convenient for channel mappings,
+   * typically made of long runs of channels in order with few gaps.
+   *
+   * Access to a single index requires a binary search among the runs, while
+   * iteration through `begin()` and `end()` of the mapping itself follows the
+   * runs and takes constant time per step. Note that `util::MappedContainer`
+   * accesses its mapping by index, so each element visited by iterating a
+   * `MappedContainer` costs a binary search.
+   * Operations on the whole mapping should use `copyMapped()` (or
+   * `util::MappedContainer::copy_to()`), which copies each run in a single
+   * `std::copy_n()` call (a `memmove()` for contiguous containers of trivially
+   * copyable data) and fills the gaps with `std::fill()`, with no per-element
+   * indirection.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * constexpr auto InvalidIndex = util::MappedContainerBase::invalidIndex();
+   *
+   * std::vector<std::size_t> const plainMapping
+   *   { 4U, 5U, 6U, InvalidIndex, InvalidIndex, 0U, 1U, 2U, 3U };
+   * util::RunLengthMapping<std::size_t> const mapping { plainMapping };
+   *
+   * util::MappedContainer const mappedData { std::cref(data), std::cref(mapping) };
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Here `mapping` holds only two runs, `{ 0, 4, 3 }` and `{ 5, 0, 4 }`.
+   */
+  template <typename Index = std::size_t>
+  class RunLengthMapping {
+
+      public:
+
+    using Index_t = Index; ///< Type of mapped index.
+
+    class const_iterator;
+
+    // --- BEGIN -- C++ standard container definitions -------------------------
+    /// @name C++ standard container definitions
+    /// @{
+    using value_type = Index_t; ///< Type of mapped index.
+    using size_type = std::size_t; ///< Type of size of the mapping.
+    using difference_type = std::ptrdiff_t;
+    using reference = Index_t; ///< Mapped indices are returned by value.
+    using const_reference = Index_t; ///< Mapped indices are returned by value.
+    using iterator = const_iterator; ///< The mapping can't be modified.
+    /// @}
+    // --- END -- C++ standard container definitions ---------------------------
+
+    /// Index returned for destination indices which are not mapped.
+    static constexpr Index_t InvalidIndex = std::numeric_limits<Index_t>::max();
+
+    /// A sequence of consecutive indices mapped to consecutive indices.
+    struct Run_t {
+      Index_t destination; ///< First destination index of the run.
+      Index_t source; ///< Source index mapped to `destination`.
+      Index_t length; ///< Number of indices in the run.
+
+      /// Returns the destination index after the last one in the run.
+      Index_t destinationEnd() const { return destination + length; }
+
+    }; // Run_t
+
+
+    /// Constructor: an empty mapping.
+    RunLengthMapping() = default;
+
+    /**
+     * @brief Constructor: compresses a plain mapping.
+     * @tparam Mapping type of the plain mapping
+     * @param mapping the plain mapping (sequence of source indices)
+     *
+     * The plain mapping is a sequence where the element `i` is the source index
+     * of the destination index `i`, or `InvalidIndex` if not mapped.
+     * The size of this mapping is the size of the plain one.
+     */
+    template <typename Mapping>
+    explicit RunLengthMapping(Mapping const& mapping);
+
+    /**
+     * @brief Constructor: uses the specified runs.
+     * @param size the number of destination indices
+     * @param runs the runs of the mapping
+     * @throw std::invalid_argument if the runs are not sorted, overlap or
+     *        exceed the size of the mapping
+     *
+     * Empty runs are dropped.
+     */
+    RunLengthMapping(size_type size, std::vector<Run_t> runs);
+
+
+    /// Returns the number of destination indices.
+    size_type size() const { return fSize; }
+
+    /// Returns whether there are no destination indices.
+    bool empty() const { return fSize == 0U; }
+
+    /// Returns the source index mapped to `index`, or `InvalidIndex`.
+    Index_t operator[] (size_type index) const;
+
+    /// Returns an iterator to the source index of the first destination.
+    const_iterator begin() const
+      { return { fRuns.data(), fRuns.data() + fRuns.size(), 0U }; }
+
+    /// Returns an iterator past the last destination index.
+    const_iterator end() const
+      { return { fRuns.data() + fRuns.size(), fRuns.data() + fRuns.size(), fSize }; }
+
+    /// Returns all the runs, sorted by destination index.
+    std::vector<Run_t> const& runs() const { return fRuns; }
+
+    /// Returns the number of runs.
+    size_type nRuns() const { return fRuns.size(); }
+
+    /// Returns the number of mapped destination indices.
+    size_type nMapped() const;
+
+    /// Returns the equivalent plain mapping (size of `size()`).
+    std::vector<Index_t> expand() const;
+
+
+    /**
+     * @brief Writes the mapped data into a destination sequence.
+     * @tparam Data type of the original data container (random access)
+     * @tparam OutIter type of random access iterator to the destination
+     * @tparam T type of the default value
+     * @param data the original data
+     * @param dest iterator to the first element of the destination
+     * @param defValue value for the destination elements not mapped
+     * @return an iterator past the last written element
+     *
+     * After the call, the element `i` of the destination is `data[s]`, where
+     * `s` is the source index mapped to `i`, or `defValue` if `i` is not
+     * mapped. Exactly `size()` elements are written.
+     * Each run is copied at once, and each gap is filled at once.
+     */
+    template <typename Data, typename OutIter, typename T>
+    OutIter copyMapped(Data const& data, OutIter dest, T const& defValue) const
+      { return copyMapped(data, dest, defValue, size()); }
+
+    /**
+     * @brief Writes the first `n` mapped data into a destination sequence.
+     * @param n number of elements to write
+     * @see `copyMapped(Data const&, OutIter, T const&)`
+     *
+     * Exactly `n` elements are written, which may be fewer or more than
+     * `size()`; the destination indices from `size()` on are not mapped.
+     */
+    template <typename Data, typename OutIter, typename T>
+    OutIter copyMapped
+      (Data const& data, OutIter dest, T const& defValue, size_type n) const;
+
+
+      private:
+
+    size_type fSize = 0U; ///< Number of destination indices.
+
+    std::vector<Run_t> fRuns; ///< Runs, sorted by destination index.
+
+    /// Adds `index` (source of the destination `dest`) to the runs.
+    void push(Index_t dest, Index_t index);
+
+  }; // class RunLengthMapping<>
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Iterator through the source indices of all destination indices.
+   *
+   * The iterator follows the runs, so that each step takes constant time.
+   */
+  template <typename Index>
+  class RunLengthMapping<Index>::const_iterator {
+
+    Run_t const* fRun = nullptr; ///< Current run, or the next one if in a gap.
+    Run_t const* fRunEnd = nullptr; ///< Past the last run.
+    size_type fIndex = 0U; ///< Current destination index.
+
+      public:
+
+    using value_type = Index_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Index_t;
+    using pointer = void;
+    using iterator_category = std::forward_iterator_tag;
+
+    /// Constructor: an invalid iterator.
+    const_iterator() = default;
+
+    /// Constructor: points to destination `index`, with `run` the first run
+    /// (of the ones until `runEnd`) not ending before it.
+    const_iterator(Run_t const* run, Run_t const* runEnd, size_type index)
+      : fRun(run), fRunEnd(runEnd), fIndex(index) {}
+
+    /// Returns the source index of the current destination index.
+    reference operator*() const
+      {
+        return ((fRun != fRunEnd) && (fIndex >= fRun->destination))
+          ? Index_t(fRun->source + (fIndex - fRun->destination)): InvalidIndex;
+      }
+
+    /// Moves to the next destination index.
+    const_iterator& operator++()
+      {
+        ++fIndex;
+        if ((fRun != fRunEnd) && (fIndex >= fRun->destinationEnd())) ++fRun;
+        return *this;
+      }
+
+    /// Moves to the next destination index, returning the old iterator.
+    const_iterator operator++(int)
+      { auto it = *this; this->operator++(); return it; }
+
+    /// Returns whether the two iterators point to the same index.
+    bool operator== (const_iterator const& other) const
+      { return fIndex == other.fIndex; }
+
+    /// Returns whether the two iterators point to different indices.
+    bool operator!= (const_iterator const& other) const
+      { return fIndex != other.fIndex; }
+
+  }; // class RunLengthMapping<>::const_iterator
+
+
+  // ---------------------------------------------------------------------------
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//------------------------------------------------------------------------------
+template <typename Index>
+template <typename Mapping>
+util::RunLengthMapping<Index>::RunLengthMapping(Mapping const& mapping) {
+  Index_t dest = 0;
+  for (auto const index: mapping) {
+    if (Index_t(index) != InvalidIndex) push(dest, Index_t(index));
+    ++dest;
+  } // for
+  fSize = dest;
+  fRuns.shrink_to_fit();
+} // util::RunLengthMapping<>::RunLengthMapping(Mapping)
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+util::RunLengthMapping<Index>::RunLengthMapping
+  (size_type size, std::vector<Run_t> runs)
+  : fSize(size)
+{
+  size_type nextFree = 0U;
+  for (Run_t const& run: runs) {
+    if (run.length == 0) continue;
+    if (run.destination < nextFree) {
+      throw std::invalid_argument("RunLengthMapping: run starting at "
+        + std::to_string(run.destination) + " overlaps the previous one");
+    }
+    if (run.destinationEnd() > size) {
+      throw std::invalid_argument("RunLengthMapping: run starting at "
+        + std::to_string(run.destination) + " exceeds the mapping size ("
+        + std::to_string(size) + ")");
+    }
+    nextFree = run.destinationEnd();
+    fRuns.push_back(run);
+  } // for
+} // util::RunLengthMapping<>::RunLengthMapping(size_type, runs)
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+auto util::RunLengthMapping<Index>::operator[] (size_type index) const
+  -> Index_t
+{
+  // first run starting after `index`; the one before may contain it
+  auto const iNext = std::upper_bound(fRuns.begin(), fRuns.end(), index,
+    [](size_type index, Run_t const& run){ return index < run.destination; });
+  if (iNext == fRuns.begin()) return InvalidIndex;
+  Run_t const& run = *std::prev(iNext);
+  return (index < run.destinationEnd())
+    ? Index_t(run.source + (index - run.destination)): InvalidIndex;
+} // util::RunLengthMapping<>::operator[]
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+auto util::RunLengthMapping<Index>::nMapped() const -> size_type {
+  size_type n = 0U;
+  for (Run_t const& run: fRuns) n += run.length;
+  return n;
+} // util::RunLengthMapping<>::nMapped()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+auto util::RunLengthMapping<Index>::expand() const -> std::vector<Index_t> {
+  std::vector<Index_t> mapping(fSize, InvalidIndex);
+  for (Run_t const& run: fRuns) {
+    for (Index_t i = 0; i < run.length; ++i)
+      mapping[run.destination + i] = run.source + i;
+  }
+  return mapping;
+} // util::RunLengthMapping<>::expand()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+template <typename Data, typename OutIter, typename T>
+OutIter util::RunLengthMapping<Index>::copyMapped
+  (Data const& data, OutIter dest, T const& defValue, size_type n) const
+{
+  auto const dataBegin = [&data]()
+    {
+      if constexpr (std::is_pointer_v<Data>) return data;
+      else { using std::begin; return begin(data); }
+    }();
+  size_type nextDest = 0U;
+  for (Run_t const& run: fRuns) {
+    if (run.destination >= n) break;
+    std::fill(std::next(dest, nextDest), std::next(dest, run.destination),
+      defValue);
+    size_type const length
+      = std::min(size_type(run.length), n - run.destination);
+    std::copy_n(std::next(dataBegin, run.source), length,
+      std::next(dest, run.destination));
+    nextDest = run.destination + length;
+  } // for
+  std::fill(std::next(dest, nextDest), std::next(dest, n), defValue);
+  return std::next(dest, n);
+} // util::RunLengthMapping<>::copyMapped()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+void util::RunLengthMapping<Index>::push(Index_t dest, Index_t index) {
+  if (!fRuns.empty()) {
+    Run_t& last = fRuns.back();
+    if ((last.destinationEnd() == dest)
+      && (last.source + last.length == index))
+    {
+      ++last.length;
+      return;
+    }
+  } // if
+  fRuns.push_back({ dest, index, Index_t(1) });
+} // util::RunLengthMapping<>::push()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_UTILITIES_RUNLENGTHMAPPING_H
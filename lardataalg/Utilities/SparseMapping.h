@@ -0,0 +1,448 @@
+/**
+ * @file   lardataalg/Utilities/SparseMapping.h
+ * @brief  Provides `SparseMapping`, an index mapping for few mapped indices.
+ * @date   October 17, 2026
+ * @see    lardataalg/Utilities/MappedContainer.h
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATAALG_UTILITIES_SPARSEMAPPING_H
+#define LARDATAALG_UTILITIES_SPARSEMAPPING_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::fill()
+#include <iterator> // std::begin(), std::next(), std::forward_iterator_tag
+#include <limits> // std::numeric_limits<>
+#include <stdexcept> // std::invalid_argument
+#include <string> // std::to_string()
+#include <type_traits> // std::is_pointer_v
+#include <utility> // std::pair
+#include <vector>
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+
+
+namespace util {
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Index mapping storing only the mapped indices.
+   * @tparam Index type of the mapped index
+   *
+   * This object maps an index (the "destination") into another (the "source"),
+   * like a `std::vector<Index>` whose element `i` is the source index for the
+   * destination `i`, or `InvalidIndex` if `i` is not mapped.
+   * It can be used as mapping of `util::MappedContainer`, which will then
+   * return its default value for all destination indices not mapped.
+   *
+   * Only the mapped destination indices are stored, so that the memory is
+   * proportional to their number rather than to `size()`: this is convenient
+   * when only a small fraction of the indices is mapped, for example a few
+   * thousand active channels out of hundreds of thousands.
+   *
+   * The entries are kept in a vector sorted by destination index, and an
+   * open-addressing hash table (linear probing, load factor at most 1/2)
+   * indexes them, so that:
+   * * access to a single index (`operator[]`) takes constant time on average;
+   * * `entries()` and `forEachMapped()` visit only the mapped indices, in
+   *   order, from contiguous memory;
+   * * iteration through `begin()` and `end()` visits all the `size()` indices
+   *   in constant time per step, without hash lookups;
+   * * `copyMapped()` (and `util::MappedContainer::copy_to()`) fills the
+   *   destination with the default value and then writes the mapped elements.
+   *
+   * The mapping can't be modified after construction.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * // 3 active channels (data elements 0 to 2) in a detector with 400000
+   * util::SparseMapping<std::size_t> const mapping
+   *   { 400000U, { { 1234U, 0U }, { 2345U, 1U }, { 399999U, 2U } } };
+   *
+   * util::MappedContainer const mappedData
+   *   { std::cref(data), std::cref(mapping), mapping.size(), 0.0 };
+   * mapping.forEachMapped(data, [](std::size_t channel, double value)
+   *   { std::cout << "Channel " << channel << ": " << value << std::endl; });
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename Index = std::size_t>
+  class SparseMapping {
+
+      public:
+
+    using Index_t = Index; ///< Type of mapped index.
+
+    class const_iterator;
+
+    // --- BEGIN -- C++ standard container definitions -------------------------
+    /// @name C++ standard container definitions
+    /// @{
+    using value_type = Index_t; ///< Type of mapped index.
+    using size_type = std::size_t; ///< Type of size of the mapping.
+    using difference_type = std::ptrdiff_t;
+    using reference = Index_t; ///< Mapped indices are returned by value.
+    using const_reference = Index_t; ///< Mapped indices are returned by value.
+    using iterator = const_iterator; ///< The mapping can't be modified.
+    /// @}
+    // --- END -- C++ standard container definitions ---------------------------
+
+    /// Index returned for destination indices which are not mapped.
+    static constexpr Index_t InvalidIndex = std::numeric_limits<Index_t>::max();
+
+    /// A mapped destination index and its source.
+    struct Entry_t {
+      size_type destination; ///< Destination index.
+      Index_t source; ///< Source index mapped to `destination`.
+    }; // Entry_t
+
+
+    /// Constructor: an empty mapping.
+    SparseMapping() = default;
+
+    /**
+     * @brief Constructor: uses the specified entries.
+     * @param size the number of destination indices
+     * @param entries pairs of destination and source index
+     * @throw std::invalid_argument if a destination index is duplicate or not
+     *        smaller than `size`
+     *
+     * The entries may be in any order. Entries with `InvalidIndex` as source
+     * are ignored.
+     */
+    SparseMapping
+      (size_type size, std::vector<std::pair<size_type, Index_t>> const& entries);
+
+    /**
+     * @brief Constructor: extracts the mapped indices from a plain mapping.
+     * @tparam Mapping type of the plain mapping
+     * @param mapping the plain mapping (sequence of source indices)
+     *
+     * The plain mapping is a sequence where the element `i` is the source index
+     * of the destination index `i`, or `InvalidIndex` if not mapped.
+     * The size of this mapping is the size of the plain one.
+     */
+    template <typename Mapping>
+    explicit SparseMapping(Mapping const& mapping);
+
+
+    /// Returns the number of destination indices.
+    size_type size() const { return fSize; }
+
+    /// Returns whether there are no destination indices.
+    bool empty() const { return fSize == 0U; }
+
+    /// Returns the number of mapped destination indices.
+    size_type nMapped() const { return fEntries.size(); }
+
+    /// Returns whether the destination `index` is mapped.
+    bool isMapped(size_type index) const { return find(index) != nullptr; }
+
+    /// Returns the source index mapped to `index`, or `InvalidIndex`.
+    Index_t operator[] (size_type index) const
+      { Entry_t const* entry = find(index); return entry? entry->source: InvalidIndex; }
+
+    /// Returns all the mapped entries, sorted by destination index.
+    std::vector<Entry_t> const& entries() const { return fEntries; }
+
+    /// Returns an iterator to the source index of the first destination.
+    const_iterator begin() const
+      { return { fEntries.data(), fEntries.data() + fEntries.size(), 0U }; }
+
+    /// Returns an iterator past the last destination index.
+    const_iterator end() const
+      {
+        auto const* entriesEnd = fEntries.data() + fEntries.size();
+        return { entriesEnd, entriesEnd, fSize };
+      }
+
+    /// Returns the equivalent plain mapping (size of `size()`).
+    std::vector<Index_t> expand() const;
+
+
+    /**
+     * @brief Calls `func(destination, data[source])` for each mapped index.
+     * @tparam Data type of the original data container (random access)
+     * @tparam Func type of the function to be called
+     * @param data the original data
+     * @param func the function to be called
+     *
+     * The calls are in order of destination index.
+     */
+    template <typename Data, typename Func>
+    void forEachMapped(Data const& data, Func&& func) const;
+
+    /**
+     * @brief Writes the mapped data into a destination sequence.
+     * @tparam Data type of the original data container (random access)
+     * @tparam OutIter type of random access iterator to the destination
+     * @tparam T type of the default value
+     * @param data the original data
+     * @param dest iterator to the first element of the destination
+     * @param defValue value for the destination elements not mapped
+     * @return an iterator past the last written element
+     *
+     * After the call, the element `i` of the destination is `data[s]`, where
+     * `s` is the source index mapped to `i`, or `defValue` if `i` is not
+     * mapped. Exactly `size()` elements are written.
+     */
+    template <typename Data, typename OutIter, typename T>
+    OutIter copyMapped(Data const& data, OutIter dest, T const& defValue) const
+      { return copyMapped(data, dest, defValue, size()); }
+
+    /**
+     * @brief Writes the first `n` mapped data into a destination sequence.
+     * @param n number of elements to write
+     * @see `copyMapped(Data const&, OutIter, T const&)`
+     *
+     * Exactly `n` elements are written, which may be fewer or more than
+     * `size()`; the destination indices from `size()` on are not mapped.
+     */
+    template <typename Data, typename OutIter, typename T>
+    OutIter copyMapped
+      (Data const& data, OutIter dest, T const& defValue, size_type n) const;
+
+
+      private:
+
+    /// Type of the index of an entry in the hash table.
+    using Slot_t = std::uint32_t;
+
+    /// Value of an empty slot of the hash table.
+    static constexpr Slot_t EmptySlot = std::numeric_limits<Slot_t>::max();
+
+    size_type fSize = 0U; ///< Number of destination indices.
+
+    std::vector<Entry_t> fEntries; ///< Entries, sorted by destination index.
+
+    std::vector<Slot_t> fTable; ///< Hash table: index in `fEntries`.
+
+    unsigned int fShift = 64U; ///< Shift of the hash to get a table index.
+
+    /// Returns the entry of destination `index`, `nullptr` if not mapped.
+    Entry_t const* find(size_type index) const;
+
+    /// Returns the first slot to try for destination `index`.
+    size_type hash(size_type index) const
+      {
+        // Fibonacci hashing: the top bits of the product are well mixed
+        return static_cast<size_type>
+          ((std::uint64_t(index) * 0x9E3779B97F4A7C15ULL) >> fShift);
+      }
+
+    /// Sorts and checks the entries, and fills the hash table.
+    void buildTable();
+
+    /// Returns an iterator to the start of `data`.
+    template <typename Data>
+    static auto dataBegin(Data const& data);
+
+  }; // class SparseMapping<>
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Iterator through the source indices of all destination indices.
+   *
+   * The iterator follows the sorted entries, so that each step takes constant
+   * time.
+   */
+  template <typename Index>
+  class SparseMapping<Index>::const_iterator {
+
+    Entry_t const* fEntry = nullptr; ///< First entry not before current index.
+    Entry_t const* fEntryEnd = nullptr; ///< Past the last entry.
+    size_type fIndex = 0U; ///< Current destination index.
+
+      public:
+
+    using value_type = Index_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Index_t;
+    using pointer = void;
+    using iterator_category = std::forward_iterator_tag;
+
+    /// Constructor: an invalid iterator.
+    const_iterator() = default;
+
+    /// Constructor: points to destination `index`, with `entry` the first
+    /// entry (of the ones until `entryEnd`) not before it.
+    const_iterator(Entry_t const* entry, Entry_t const* entryEnd, size_type index)
+      : fEntry(entry), fEntryEnd(entryEnd), fIndex(index) {}
+
+    /// Returns the source index of the current destination index.
+    reference operator*() const
+      {
+        return ((fEntry != fEntryEnd) && (fEntry->destination == fIndex))
+          ? fEntry->source: InvalidIndex;
+      }
+
+    /// Moves to the next destination index.
+    const_iterator& operator++()
+      {
+        if ((fEntry != fEntryEnd) && (fEntry->destination == fIndex)) ++fEntry;
+        ++fIndex;
+        return *this;
+      }
+
+    /// Moves to the next destination index, returning the old iterator.
+    const_iterator operator++(int)
+      { auto it = *this; this->operator++(); return it; }
+
+    /// Returns whether the two iterators point to the same index.
+    bool operator== (const_iterator const& other) const
+      { return fIndex == other.fIndex; }
+
+    /// Returns whether the two iterators point to different indices.
+    bool operator!= (const_iterator const& other) const
+      { return fIndex != other.fIndex; }
+
+  }; // class SparseMapping<>::const_iterator
+
+
+  // ---------------------------------------------------------------------------
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//------------------------------------------------------------------------------
+template <typename Index>
+util::SparseMapping<Index>::SparseMapping
+  (size_type size, std::vector<std::pair<size_type, Index_t>> const& entries)
+  : fSize(size)
+{
+  fEntries.reserve(entries.size());
+  for (auto const& [ destination, source ]: entries) {
+    if (source == InvalidIndex) continue;
+    if (destination >= size) {
+      throw std::invalid_argument("SparseMapping: destination index "
+        + std::to_string(destination) + " exceeds the mapping size ("
+        + std::to_string(size) + ")");
+    }
+    fEntries.push_back({ destination, source });
+  } // for
+  buildTable();
+} // util::SparseMapping<>::SparseMapping(size_type, entries)
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+template <typename Mapping>
+util::SparseMapping<Index>::SparseMapping(Mapping const& mapping) {
+  size_type destination = 0U;
+  for (auto const index: mapping) {
+    if (Index_t(index) != InvalidIndex)
+      fEntries.push_back({ destination, Index_t(index) });
+    ++destination;
+  } // for
+  fSize = destination;
+  buildTable();
+} // util::SparseMapping<>::SparseMapping(Mapping)
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+auto util::SparseMapping<Index>::expand() const -> std::vector<Index_t> {
+  std::vector<Index_t> mapping(fSize, InvalidIndex);
+  for (Entry_t const& entry: fEntries) mapping[entry.destination] = entry.source;
+  return mapping;
+} // util::SparseMapping<>::expand()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+template <typename Data, typename Func>
+void util::SparseMapping<Index>::forEachMapped
+  (Data const& data, Func&& func) const
+{
+  auto const first = dataBegin(data);
+  for (Entry_t const& entry: fEntries)
+    func(entry.destination, *std::next(first, entry.source));
+} // util::SparseMapping<>::forEachMapped()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+template <typename Data, typename OutIter, typename T>
+OutIter util::SparseMapping<Index>::copyMapped
+  (Data const& data, OutIter dest, T const& defValue, size_type n) const
+{
+  auto const first = dataBegin(data);
+  auto const destEnd = std::next(dest, n);
+  std::fill(dest, destEnd, defValue);
+  for (Entry_t const& entry: fEntries) {
+    if (entry.destination >= n) break; // entries are sorted by destination
+    *std::next(dest, entry.destination) = *std::next(first, entry.source);
+  }
+  return destEnd;
+} // util::SparseMapping<>::copyMapped()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+auto util::SparseMapping<Index>::find(size_type index) const
+  -> Entry_t const*
+{
+  if (fTable.empty()) return nullptr;
+  size_type const mask = fTable.size() - 1U;
+  for (size_type slot = hash(index); ; slot = (slot + 1U) & mask) {
+    Slot_t const iEntry = fTable[slot];
+    if (iEntry == EmptySlot) return nullptr;
+    if (fEntries[iEntry].destination == index) return &(fEntries[iEntry]);
+  } // for
+} // util::SparseMapping<>::find()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+void util::SparseMapping<Index>::buildTable() {
+
+  std::sort(fEntries.begin(), fEntries.end(),
+    [](Entry_t const& a, Entry_t const& b){ return a.destination < b.destination; }
+    );
+  for (size_type i = 1U; i < fEntries.size(); ++i) {
+    if (fEntries[i].destination != fEntries[i - 1U].destination) continue;
+    throw std::invalid_argument("SparseMapping: destination index "
+      + std::to_string(fEntries[i].destination) + " mapped more than once");
+  } // for
+  if (fEntries.size() >= EmptySlot / 2U) {
+    throw std::invalid_argument("SparseMapping: too many entries ("
+      + std::to_string(fEntries.size()) + ")");
+  }
+  fEntries.shrink_to_fit();
+
+  fTable.clear();
+  fShift = 64U;
+  if (fEntries.empty()) return;
+
+  // table size: power of 2, at least twice the number of entries
+  size_type tableSize = 8U;
+  fShift = 61U;
+  while (tableSize < 2U * fEntries.size()) { tableSize *= 2U; --fShift; }
+
+  fTable.assign(tableSize, EmptySlot);
+  size_type const mask = tableSize - 1U;
+  for (Slot_t iEntry = 0; iEntry < fEntries.size(); ++iEntry) {
+    size_type slot = hash(fEntries[iEntry].destination);
+    while (fTable[slot] != EmptySlot) slot = (slot + 1U) & mask;
+    fTable[slot] = iEntry;
+  } // for
+
+} // util::SparseMapping<>::buildTable()
+
+
+//------------------------------------------------------------------------------
+template <typename Index>
+template <typename Data>
+auto util::SparseMapping<Index>::dataBegin(Data const& data) {
+  if constexpr (std::is_pointer_v<Data>) return data;
+  else { using std::begin; return begin(data); }
+} // util::SparseMapping<>::dataBegin()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATAALG_UTILITIES_SPARSEMAPPING_H
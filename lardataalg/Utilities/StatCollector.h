@@ -7,6 +7,13 @@
  * Currently includes:
  *  - MinMaxCollector to extract data range
  *  - StatCollector to extract simple statistics (average, RMS etc.)
+ *  - MultiChannelStatCollector to extract simple statistics of many channels
+ *  - WindowedStatCollector and WindowedStatCollector2D for statistics of the
+ *    latest entries only
+ *  - ExponentialStatCollector and ExponentialStatCollector2D for statistics
+ *    with exponentially decaying weights
+ *  - MomentCollector to extract skewness and kurtosis
+ *  - QuantileCollector to estimate median and quantiles in bounded memory
  *
  */
 
@@ -20,9 +27,13 @@
 #include <limits> // std::numeric_limits<>
 #include <initializer_list>
 #include <iterator> // std::begin(), std::end()
-#include <utility> // std::forward()
+#include <utility> // std::forward(), std::index_sequence
 #include <algorithm> // std::for_each()
 #include <stdexcept> // std::range_error
+#include <vector>
+#include <cstddef> // std::size_t
+#include <random> // std::minstd_rand
+#include <string>
 
 
 namespace lar {
@@ -42,6 +53,30 @@ namespace lar {
 
     namespace details {
 
+      /// Adds `weight * value^k` to `sums[k - 1]` for all `k` (unrolled)
+      template <typename W, std::size_t N, std::size_t... I>
+      void addPowerSums(
+        std::array<W, N>& sums, W value, W weight, std::index_sequence<I...>
+      ) {
+        W x = weight;
+        ((sums[I] += (x *= value)), ...);
+      } // addPowerSums()
+
+      /**
+       * @brief Adds `weight * value^k` to `sums[k - 1]`, `k` from 1 to `N`
+       * @tparam N highest power
+       * @param sums the sums to be incremented
+       * @param value the value to be added
+       * @param weight the weight of the value
+       *
+       * The powers are computed with a chain of multiplications unrolled at
+       * compile time, with no loop.
+       */
+      template <typename W, std::size_t N>
+      void addPowerSums(std::array<W, N>& sums, W value, W weight)
+        { addPowerSums(sums, value, weight, std::make_index_sequence<N>()); }
+
+
       /// Class tracking the number of entries and their total weight
       /// @tparam W type of the weight
       template <typename W>
@@ -102,11 +137,7 @@ namespace lar {
         DataTracker() { clear(); }
 
         /// Adds the specified weight to the statistics
-        void add(Data_t v, Weight_t w)
-          {
-            Weight_t x = w;
-            for (size_t i = 0; i < Power; ++i) sums[i] += (x *= v);
-          }
+        void add(Data_t v, Weight_t w) { addPowerSums<Weight_t>(sums, v, w); }
 
         /// Resets the count
         void clear() { sums.fill(Data_t(0)); }
@@ -172,6 +203,140 @@ namespace lar {
 
       }; // class DataTracker3
 
+      /**
+       * @brief Class tracking sums of variables up to power 4
+       * @tparam T type of the quantity
+       * @tparam W type of the weight (as T by default)
+       */
+      template <typename T, typename W = T, unsigned int PWR = 4>
+      class DataTracker4: public DataTracker3<T, W, PWR> {
+        using Base_t = DataTracker3<T, W, PWR>; ///< base class type
+          public:
+        using Base_t::Power;
+        static_assert(Power >= 4, "DataTracker4 must have Power >= 4");
+        using Weight_t = typename Base_t::Weight_t;
+
+        /// Returns the weighted sum of the fourth power of the entries
+        Weight_t SumFourth() const
+          { return Base_t::sums[3]; }
+
+      }; // class DataTracker4
+
+
+      /**
+       * @brief Weighted central moments of a variable, up to the fourth
+       * @tparam W type of the weight and of the moments
+       *
+       * The moments are kept as sums of the powers of the deviations from the
+       * current average, which is much more stable than the sums of the powers
+       * of the values. Sets of entries are combined with the formulae by
+       * P. P&eacute;bay (Sandia report SAND2008-6212).
+       */
+      template <typename W>
+      struct CentralMoments {
+        using Weight_t = W; ///< type of weight and moments
+
+        Weight_t w = Weight_t(0); ///< sum of the weights
+        Weight_t mean = Weight_t(0); ///< weighted average
+        Weight_t M2 = Weight_t(0); ///< weighted sum of squared deviations
+        Weight_t M3 = Weight_t(0); ///< weighted sum of cubed deviations
+        Weight_t M4 = Weight_t(0); ///< weighted sum of 4th power deviations
+
+        /// Adds a single value with the specified weight
+        void add(Weight_t value, Weight_t weight)
+          { merge(CentralMoments{ weight, value }); }
+
+        /// Adds the moments of another set of entries
+        void merge(CentralMoments const& other);
+
+        /// Resets all the moments
+        void clear() { *this = CentralMoments{}; }
+
+        /**
+         * @brief Computes the moments of a block of values
+         * @param values pointer to the first value
+         * @param weights pointer to the first weight (null for all 1)
+         * @param n number of values in the block
+         * @return the moments of the block
+         *
+         * The block is processed in two passes (average, then deviations);
+         * the power sums of the deviations are accumulated on independent
+         * lanes, which lets the compiler vectorize the loop.
+         */
+        static CentralMoments fromBlock
+          (Weight_t const* values, Weight_t const* weights, std::size_t n);
+
+      }; // struct CentralMoments<>
+
+
+      /**
+       * @brief Weighted sums of a variable, supporting removal and decay
+       * @tparam W type of the sums and of the weight
+       *
+       * This is the accumulator of the collectors which forget old entries.
+       */
+      template <typename W>
+      struct RunningSums {
+        using Weight_t = W; ///< type of weight and sums
+
+        Weight_t w = Weight_t(0); ///< sum of the weights
+        Weight_t x = Weight_t(0); ///< weighted sum of the values
+        Weight_t x2 = Weight_t(0); ///< weighted sum of the squared values
+
+        /// Adds a value with the specified weight
+        void add(Weight_t value, Weight_t weight)
+          { w += weight; Weight_t const wx = weight * value; x += wx; x2 += wx * value; }
+
+        /// Removes a value with the specified weight, previously added
+        void remove(Weight_t value, Weight_t weight)
+          { w -= weight; Weight_t const wx = weight * value; x -= wx; x2 -= wx * value; }
+
+        /// Multiplies all the sums (and the weights) by `factor`
+        void scale(Weight_t factor) { w *= factor; x *= factor; x2 *= factor; }
+
+        /// Resets all the sums
+        void clear() { w = x = x2 = Weight_t(0); }
+
+        /// Returns the average; `where` is used in the error message
+        Weight_t average(char const* where) const;
+
+        /// Returns the variance (not negative); `where` is used for errors
+        Weight_t variance(char const* where) const;
+
+      }; // struct RunningSums<>
+
+
+      /// Weighted sums of two variables, supporting removal and decay
+      template <typename W>
+      struct RunningSums2D {
+        using Weight_t = W; ///< type of weight and sums
+
+        RunningSums<Weight_t> x; ///< sums of the first variable
+        RunningSums<Weight_t> y; ///< sums of the second variable
+        Weight_t xy = Weight_t(0); ///< weighted sum of the product
+
+        /// Adds a pair of values with the specified weight
+        void add(Weight_t vx, Weight_t vy, Weight_t weight)
+          { x.add(vx, weight); y.add(vy, weight); xy += weight * vx * vy; }
+
+        /// Removes a pair of values with the specified weight
+        void remove(Weight_t vx, Weight_t vy, Weight_t weight)
+          { x.remove(vx, weight); y.remove(vy, weight); xy -= weight * vx * vy; }
+
+        /// Multiplies all the sums (and the weights) by `factor`
+        void scale(Weight_t factor) { x.scale(factor); y.scale(factor); xy *= factor; }
+
+        /// Resets all the sums
+        void clear() { x.clear(); y.clear(); xy = Weight_t(0); }
+
+        /// Returns the covariance; `where` is used in the error message
+        Weight_t covariance(char const* where) const;
+
+        /// Returns the linear correlation; `where` is used in error messages
+        Weight_t linearCorrelation(char const* where) const;
+
+      }; // struct RunningSums2D<>
+
     } // namespace details
 
 
@@ -734,182 +899,967 @@ namespace lar {
     }; // class StatCollector2D<>
 
 
-
     /** ************************************************************************
-     * @brief Keeps track of the minimum and maximum value we observed
-     * @tparam T type of datum
+     * @brief Collects statistics on a single quantity for many channels
+     * @tparam T type of the quantity
+     * @tparam W type of the weight (as T by default)
      *
-     * Implementation note: a similar class with an arbitrary comparison rule
-     * would require a careful choice of initial values for minimum and maximum,
-     * or a entry count that should be checked at each insertion.
-     * We save that slight overhead here.
+     * This class is equivalent to a collection of `StatCollector` objects, one
+     * per channel, but it stores each statistic (entry count, weights, sum and
+     * sum of squares) of all the channels in a separate contiguous array.
+     * Operations updating many channels at once, like adding one sample to
+     * each channel or a block of samples to a range of channels, then run
+     * through the arrays sequentially and can be vectorized by the compiler.
+     *
+     * Example collecting pedestal statistics from waveforms of `nTicks` ticks
+     * stored channel after channel in `samples`:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * lar::util::MultiChannelStatCollector<double> stats(nChannels);
+     * stats.add_block(0, nChannels, nTicks, samples.begin());
+     * std::cout << "Channel 5: " << stats.Average(5) << " +/- "
+     *   << stats.RMS(5) << std::endl;
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     *
+     * The same caveats about rounding as in `StatCollector` apply.
+     * Channel numbers are not checked in the `add` methods.
      */
-    template <typename T>
-    class MinMaxCollector {
+    template <typename T, typename W = T>
+    class MultiChannelStatCollector {
         public:
-      using Data_t = T; ///< type of data we collect
-      using This_t = MinMaxCollector<T>; ///< this type
+      using This_t = MultiChannelStatCollector<T, W>; ///< this type
+      using Data_t = T; ///< type of the data
+      using Weight_t = W; ///< type of the weight
 
-      //@{
-      /// Default constructor: no data collected so far.
-      MinMaxCollector() = default;
+      /// Constructor: collects statistics for `nChannels` channels
+      explicit MultiChannelStatCollector(std::size_t nChannels = 0)
+        { resize(nChannels); }
 
-      /// Constructor: starts with parsing the specified data
-      MinMaxCollector(std::initializer_list<Data_t> init)
-        { add(init); }
+      /// Returns the number of channels
+      std::size_t NChannels() const { return n.size(); }
+
+      /// Changes the number of channels; new channels have no entries
+      void resize(std::size_t nChannels);
+
+      /// @{
+      /// @name Add elements
+
+      /// Adds one entry with specified value and weight to a channel
+      void add(std::size_t channel, Data_t value, Weight_t weight = Weight_t(1.0));
 
       /**
-       * @brief Include a sequence of values in the statistics
-       * @tparam Iter type of an iterator on values
-       * @param begin iterator pointing to the first value to be included
-       * @param end iterator pointing to the last value to be included
+       * @brief Adds one entry with weight 1 to each of the channels
+       * @tparam Iter forward iterator to the values to be added
+       * @param begin iterator pointing to the value for the first channel
+       *
+       * The sequence starting at `begin` must have one value per channel.
        */
       template <typename Iter>
-      MinMaxCollector(Iter begin, Iter end)
-        { add(begin, end); }
-      //@}
+      void add_to_all(Iter begin);
+
+      /**
+       * @brief Adds a block of entries with weight 1 to a range of channels
+       * @tparam Iter forward iterator to the values to be added
+       * @param firstChannel the first channel to be filled
+       * @param nChannels the number of channels to be filled
+       * @param nEntries the number of entries for each channel
+       * @param begin iterator pointing to the first value to be added
+       *
+       * The sequence starting at `begin` must contain `nEntries` values for
+       * `firstChannel`, followed by `nEntries` values for the next channel,
+       * and so on for `nChannels` channels.
+       */
+      template <typename Iter>
+      void add_block(
+        std::size_t firstChannel, std::size_t nChannels, std::size_t nEntries,
+        Iter begin
+        );
 
+      ///@}
 
-      // default copy and move constructor and assignment, and destructor
+      /// Clears all the statistics of all the channels
+      void clear();
 
       /// @{
-      /// @name Inserters
+      /// @name Statistic retrieval
+
+      /// Returns the number of entries added to `channel`
+      int N(std::size_t channel) const { return n[channel]; }
+
+      /// Returns the sum of the weights of `channel`
+      Weight_t Weights(std::size_t channel) const { return w[channel]; }
+
+      /// Returns the weighted sum of the values of `channel`
+      Weight_t Sum(std::size_t channel) const { return sum[channel]; }
+
+      /// Returns the weighted sum of the square of the values of `channel`
+      Weight_t SumSq(std::size_t channel) const { return sumSq[channel]; }
+
       /**
-       * @brief Include a single value in the statistics
-       * @param value the value to be added
-       * @return this object
+       * @brief Returns the value average of `channel`
+       * @return the value average
+       * @throws std::range_error if the total weight is 0 (usually: no data)
        */
-      This_t& add(Data_t value);
+      Weight_t Average(std::size_t channel) const;
 
       /**
-       * @brief Include a sequence of values in the statistics
-       * @param values the values to be added
-       * @return this object
+       * @brief Returns the square of the RMS of the values of `channel`
+       * @return the square of the RMS of the values
+       * @throws std::range_error if the total weight is 0 (usually: no data)
        */
-      This_t& add(std::initializer_list<Data_t> values);
+      Weight_t Variance(std::size_t channel) const;
 
       /**
-       * @brief Include a sequence of values in the statistics
-       * @tparam Iter type of an iterator on values
-       * @param begin iterator pointing to the first value to be included
-       * @param end iterator pointing to the last value to be included
-       * @return this object
+       * @brief Returns the root mean square of the values of `channel`
+       * @return the RMS of the values
+       * @throws std::range_error if the total weight is 0 (see Variance())
        */
-      template <typename Iter>
-      This_t& add(Iter begin, Iter end);
-      /// @}
+      Weight_t RMS(std::size_t channel) const;
 
+      /**
+       * @brief Returns the arithmetic average of the weights of `channel`
+       * @return the weight average
+       * @throws std::range_error if no entry was added
+       */
+      Weight_t AverageWeight(std::size_t channel) const;
 
-      /// Returns whether at least one datum has been added
-      bool has_data() const { return minimum <= maximum; }
+      /// @}
 
-      /// Returns the accumulated minimum, or a very large number if no values
-      Data_t min() const { return minimum; }
+        protected:
+      std::vector<int> n; ///< number of entries, per channel
+      std::vector<Weight_t> w; ///< total weight, per channel
+      std::vector<Weight_t> sum; ///< weighted sum of values, per channel
+      std::vector<Weight_t> sumSq; ///< weighted sum of squares, per channel
 
-      /// Returns the accumulated maximum, or a very small number if no values
-      Data_t max() const { return maximum; }
+    }; // class MultiChannelStatCollector<>
 
 
-      /// Removes all statistics and reinitializes the object
-      void clear();
+    /** ************************************************************************
+     * @brief Collects statistics on the latest entries of a quantity
+     * @tparam T type of the quantity
+     * @tparam W type of the weight (as T by default)
+     *
+     * This collector provides the same statistics as `StatCollector`, but only
+     * for the last `WindowSize()` entries: when a new entry is added to a full
+     * window, the oldest one is removed from the statistics.
+     * Each update takes constant time. The entries in the window are stored,
+     * and every `WindowSize()` entries the sums are recomputed from them, to
+     * keep the rounding errors of the removals from accumulating.
+     *
+     * Example monitoring the noise of the last 1000 samples:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * lar::util::WindowedStatCollector<double> noise(1000);
+     * for (auto sample: samples) noise.add(sample);
+     * std::cout << "Recent RMS: " << noise.RMS() << std::endl;
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T, typename W = T>
+    class WindowedStatCollector {
+        public:
+      using This_t = WindowedStatCollector<T, W>; ///< this type
+      using Data_t = T; ///< type of the data
+      using Weight_t = W; ///< type of the weight
 
-        protected:
-      /// the accumulated minimum
-      Data_t minimum = std::numeric_limits<Data_t>::max();
+      /// Constructor: keeps the last `windowSize` entries (at least 1)
+      explicit WindowedStatCollector(std::size_t windowSize)
+        : fEntries(std::max(windowSize, std::size_t(1))) {}
 
-      /// the accumulated maximum
-      Data_t maximum = std::numeric_limits<Data_t>::min();
+      /// @{
+      /// @name Add elements
 
-    }; // class MinMaxCollector<>
+      /// Adds one entry with specified value and weight
+      void add(Data_t value, Weight_t weight = Weight_t(1.0));
 
+      /// Adds entries from a sequence with weight 1
+      template <typename Iter>
+      void add_unweighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](Data_t value){ this->add(value); }); }
 
-  } // namespace util
-} // namespace lar
+      /// Adds entries from a sequence of (value, weight) pairs
+      template <typename Iter>
+      void add_weighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](auto p){ this->add(p.first, p.second); }); }
 
+      ///@}
 
-//==============================================================================
-//=== template implementation
-//==============================================================================
+      /// Clears all the statistics
+      void clear();
 
+      /// @{
+      /// @name Statistic retrieval
 
-//******************************************************************************
-//***  details::WeightTracker<>
-//***
+      /// Returns the maximum number of entries in the statistics
+      std::size_t WindowSize() const { return fEntries.size(); }
 
-template <typename W>
-typename lar::util::details::WeightTracker<W>::Weight_t
-  lar::util::details::WeightTracker<W>::AverageWeight() const
-{
-  if (N() == 0)
-    throw std::range_error("WeightTracker<>::AverageWeight(): divide by 0");
-  return Weights() / N();
-} // details::WeightTracker<W>::AverageWeight()
+      /// Returns the number of entries in the window
+      int N() const { return static_cast<int>(fN); }
 
+      /// Returns the sum of the weights in the window
+      Weight_t Weights() const { return fSums.w; }
 
-//******************************************************************************
-//***  StatCollector<>
-//***
+      /// Returns the weighted sum of the values in the window
+      Weight_t Sum() const { return fSums.x; }
 
-template <typename T, typename W>
-void lar::util::StatCollector<T, W>::add
-  (Data_t value, Weight_t weight /* = Weight_t(1.0) */)
-{
-  Base_t::add(weight);
-  x.add(value, weight);
-} // StatCollector<T, W>::add()
+      /// Returns the weighted sum of the square of the values in the window
+      Weight_t SumSq() const { return fSums.x2; }
 
+      /// Returns the value average (see `StatCollector::Average()`)
+      Weight_t Average() const
+        { return fSums.average("WindowedStatCollector<>::Average()"); }
 
-template <typename T, typename W>
-template <typename Iter, typename Pred>
-void lar::util::StatCollector<T, W>::add_unweighted
-  (Iter begin, Iter end, Pred extractor)
-{
-  std::for_each
-    (begin, end, [this, extractor](auto item) { this->add(extractor(item)); });
-} // StatCollector<T, W>::add_unweighted(Iter, Iter, Pred)
+      /// Returns the square of the RMS (see `StatCollector::Variance()`)
+      Weight_t Variance() const
+        { return fSums.variance("WindowedStatCollector<>::Variance()"); }
 
+      /// Returns the root mean square (see `StatCollector::RMS()`)
+      Weight_t RMS() const { return std::sqrt(Variance()); }
 
-template <typename T, typename W>
-template <typename VIter, typename WIter, typename VPred, typename WPred>
-void lar::util::StatCollector<T, W>::add_weighted(
-  VIter begin_value, VIter end_value,
-  WIter begin_weight,
-  VPred value_extractor,
-  WPred weight_extractor /* = WPred() */
-) {
-  while (begin_value != end_value) {
-    add(value_extractor(*begin_value), weight_extractor(*begin_weight));
-    ++begin_value;
-    ++begin_weight;
-  } // while
-} // StatCollector<T, W>::add_weighted(VIter, VIter, WIter, VPred, WPred)
+      /// Returns the arithmetic average of the weights in the window
+      Weight_t AverageWeight() const;
 
+      /// @}
 
-template <typename T, typename W>
-template <typename Iter>
-void lar::util::StatCollector<T, W>::add_weighted(Iter begin, Iter end) {
+        protected:
+      /// Entries in the window, as a circular buffer.
+      std::vector<std::pair<Data_t, Weight_t>> fEntries;
+      std::size_t fNext = 0; ///< position of the next entry in the buffer
+      std::size_t fN = 0; ///< number of entries in the window
+      details::RunningSums<Weight_t> fSums; ///< sums of the window entries
 
-  std::for_each(begin, end, [this](auto p) { this->add(p.first, p.second); });
+      /// Recomputes the sums from the entries in the window
+      void refresh();
 
-} // StatCollector<T, W>::add_weighted(Iter, Iter)
+    }; // class WindowedStatCollector<>
 
 
+    /** ************************************************************************
+     * @brief Collects statistics on the latest entries of two quantities
+     * @tparam T type of the quantities
+     * @tparam W type of the weight (as T by default)
+     * @see WindowedStatCollector
+     *
+     * This collector provides the same statistics as `StatCollector2D`, but
+     * only for the last `WindowSize()` entries.
+     */
+    template <typename T, typename W = T>
+    class WindowedStatCollector2D {
+        public:
+      using This_t = WindowedStatCollector2D<T, W>; ///< this type
+      using Data_t = T; ///< type of the data
+      using Weight_t = W; ///< type of the weight
 
-template <typename T, typename W>
-inline void lar::util::StatCollector<T, W>::clear() {
-  Base_t::clear();
-  x.clear();
-} // StatCollector<T, W>::clear()
+      using Pair_t = std::tuple<Data_t, Data_t>;
+      using WeightedPair_t = std::tuple<Data_t, Data_t, Weight_t>;
 
+      /// Constructor: keeps the last `windowSize` entries (at least 1)
+      explicit WindowedStatCollector2D(std::size_t windowSize)
+        : fEntries(std::max(windowSize, std::size_t(1))) {}
 
-template <typename T, typename W>
-typename lar::util::StatCollector<T, W>::Weight_t
-  lar::util::StatCollector<T, W>::Average() const
-{
-  if (Weights() == Weight_t(0))
-    throw std::range_error("StatCollector<>::Average(): divide by 0");
-  return Sum() / Weights();
-} // StatCollector<T, W>::Average()
+      /// @{
+      /// @name Add elements
+
+      /// Adds one entry with specified values and weight
+      void add(Data_t x, Data_t y, Weight_t weight = Weight_t(1.0));
+
+      void add(Pair_t value, Weight_t weight = Weight_t(1.0))
+        { add(std::get<0>(value), std::get<1>(value), weight); }
+
+      void add(WeightedPair_t value)
+        { add(std::get<0>(value), std::get<1>(value), std::get<2>(value)); }
+
+      /// Adds entries from a sequence of `Pair_t` with weight 1
+      template <typename Iter>
+      void add_unweighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](Pair_t p){ this->add(p); }); }
+
+      /// Adds entries from a sequence of `WeightedPair_t`
+      template <typename Iter>
+      void add_weighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](WeightedPair_t p){ this->add(p); }); }
+
+      ///@}
+
+      /// Clears all the statistics
+      void clear();
+
+      /// @{
+      /// @name Statistic retrieval
+
+      /// Returns the maximum number of entries in the statistics
+      std::size_t WindowSize() const { return fEntries.size(); }
+
+      /// Returns the number of entries in the window
+      int N() const { return static_cast<int>(fN); }
+
+      /// Returns the sum of the weights in the window
+      Weight_t Weights() const { return fSums.x.w; }
+
+      Weight_t SumX() const { return fSums.x.x; }
+      Weight_t SumY() const { return fSums.y.x; }
+      Weight_t SumSqX() const { return fSums.x.x2; }
+      Weight_t SumSqY() const { return fSums.y.x2; }
+      Weight_t SumXY() const { return fSums.xy; }
+
+      Weight_t AverageX() const
+        { return fSums.x.average("WindowedStatCollector2D<>::AverageX()"); }
+      Weight_t AverageY() const
+        { return fSums.y.average("WindowedStatCollector2D<>::AverageY()"); }
+      Weight_t VarianceX() const
+        { return fSums.x.variance("WindowedStatCollector2D<>::VarianceX()"); }
+      Weight_t VarianceY() const
+        { return fSums.y.variance("WindowedStatCollector2D<>::VarianceY()"); }
+      Weight_t RMSx() const { return std::sqrt(VarianceX()); }
+      Weight_t RMSy() const { return std::sqrt(VarianceY()); }
+      Weight_t Covariance() const
+        { return fSums.covariance("WindowedStatCollector2D<>::Covariance()"); }
+
+      /// Returns the linear correlation (see `StatCollector2D`)
+      Weight_t LinearCorrelation() const
+        {
+          return fSums.linearCorrelation
+            ("WindowedStatCollector2D<>::LinearCorrelation()");
+        }
+
+      /// @}
+
+        protected:
+      /// Entries in the window, as a circular buffer.
+      std::vector<WeightedPair_t> fEntries;
+      std::size_t fNext = 0; ///< position of the next entry in the buffer
+      std::size_t fN = 0; ///< number of entries in the window
+      details::RunningSums2D<Weight_t> fSums; ///< sums of the window entries
+
+      /// Recomputes the sums from the entries in the window
+      void refresh();
+
+    }; // class WindowedStatCollector2D<>
+
+
+    /** ************************************************************************
+     * @brief Collects statistics with exponentially decaying weights
+     * @tparam T type of the quantity
+     * @tparam W type of the weight (as T by default)
+     *
+     * This collector provides the same statistics as `StatCollector`, but the
+     * weight of all the entries is multiplied by a `Decay()` factor each time
+     * a new entry is added (exponentially weighted moving statistics).
+     * The effective number of entries contributing to the statistics is about
+     * `1 / (1 - Decay())`. Each update takes constant time and memory.
+     *
+     * Example:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * lar::util::ExponentialStatCollector<double> pedestal(0.999);
+     * for (auto sample: samples) pedestal.add(sample);
+     * std::cout << "Pedestal: " << pedestal.Average() << std::endl;
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T, typename W = T>
+    class ExponentialStatCollector {
+        public:
+      using This_t = ExponentialStatCollector<T, W>; ///< this type
+      using Data_t = T; ///< type of the data
+      using Weight_t = W; ///< type of the weight
+
+      /**
+       * @brief Constructor: sets the decay factor
+       * @param decay factor applied to the old weights at each new entry
+       * @throws std::domain_error if `decay` is not in ]0, 1]
+       */
+      explicit ExponentialStatCollector(Weight_t decay);
+
+      /// @{
+      /// @name Add elements
+
+      /// Adds one entry with specified value and weight
+      void add(Data_t value, Weight_t weight = Weight_t(1.0))
+        { fSums.scale(fDecay); fSums.add(value, weight); ++fN; }
+
+      /// Adds entries from a sequence with weight 1
+      template <typename Iter>
+      void add_unweighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](Data_t value){ this->add(value); }); }
+
+      /// Adds entries from a sequence of (value, weight) pairs
+      template <typename Iter>
+      void add_weighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](auto p){ this->add(p.first, p.second); }); }
+
+      ///@}
+
+      /// Clears all the statistics
+      void clear() { fSums.clear(); fN = 0; }
+
+      /// @{
+      /// @name Statistic retrieval
+
+      /// Returns the factor applied to the old weights at each new entry
+      Weight_t Decay() const { return fDecay; }
+
+      /// Returns the number of entries added so far
+      int N() const { return fN; }
+
+      /// Returns the sum of the decayed weights
+      Weight_t Weights() const { return fSums.w; }
+
+      /// Returns the weighted sum of the values
+      Weight_t Sum() const { return fSums.x; }
+
+      /// Returns the weighted sum of the square of the values
+      Weight_t SumSq() const { return fSums.x2; }
+
+      /// Returns the value average (see `StatCollector::Average()`)
+      Weight_t Average() const
+        { return fSums.average("ExponentialStatCollector<>::Average()"); }
+
+      /// Returns the square of the RMS (see `StatCollector::Variance()`)
+      Weight_t Variance() const
+        { return fSums.variance("ExponentialStatCollector<>::Variance()"); }
+
+      /// Returns the root mean square (see `StatCollector::RMS()`)
+      Weight_t RMS() const { return std::sqrt(Variance()); }
+
+      /// @}
+
+        protected:
+      Weight_t fDecay; ///< decay factor of the weights
+      int fN = 0; ///< number of added entries
+      details::RunningSums<Weight_t> fSums; ///< decayed sums
+
+    }; // class ExponentialStatCollector<>
+
+
+    /** ************************************************************************
+     * @brief Collects statistics on two quantities with decaying weights
+     * @tparam T type of the quantities
+     * @tparam W type of the weight (as T by default)
+     * @see ExponentialStatCollector
+     *
+     * This collector provides the same statistics as `StatCollector2D`, with
+     * the weights of older entries decaying as in `ExponentialStatCollector`.
+     */
+    template <typename T, typename W = T>
+    class ExponentialStatCollector2D {
+        public:
+      using This_t = ExponentialStatCollector2D<T, W>; ///< this type
+      using Data_t = T; ///< type of the data
+      using Weight_t = W; ///< type of the weight
+
+      using Pair_t = std::tuple<Data_t, Data_t>;
+      using WeightedPair_t = std::tuple<Data_t, Data_t, Weight_t>;
+
+      /// Constructor: sets the decay factor (see `ExponentialStatCollector`)
+      explicit ExponentialStatCollector2D(Weight_t decay);
+
+      /// @{
+      /// @name Add elements
+
+      /// Adds one entry with specified values and weight
+      void add(Data_t x, Data_t y, Weight_t weight = Weight_t(1.0))
+        { fSums.scale(fDecay); fSums.add(x, y, weight); ++fN; }
+
+      void add(Pair_t value, Weight_t weight = Weight_t(1.0))
+        { add(std::get<0>(value), std::get<1>(value), weight); }
+
+      void add(WeightedPair_t value)
+        { add(std::get<0>(value), std::get<1>(value), std::get<2>(value)); }
+
+      /// Adds entries from a sequence of `Pair_t` with weight 1
+      template <typename Iter>
+      void add_unweighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](Pair_t p){ this->add(p); }); }
+
+      /// Adds entries from a sequence of `WeightedPair_t`
+      template <typename Iter>
+      void add_weighted(Iter begin, Iter end)
+        { std::for_each(begin, end, [this](WeightedPair_t p){ this->add(p); }); }
+
+      ///@}
+
+      /// Clears all the statistics
+      void clear() { fSums.clear(); fN = 0; }
+
+      /// @{
+      /// @name Statistic retrieval
+
+      /// Returns the factor applied to the old weights at each new entry
+      Weight_t Decay() const { return fDecay; }
+
+      /// Returns the number of entries added so far
+      int N() const { return fN; }
+
+      /// Returns the sum of the decayed weights
+      Weight_t Weights() const { return fSums.x.w; }
+
+      Weight_t SumX() const { return fSums.x.x; }
+      Weight_t SumY() const { return fSums.y.x; }
+      Weight_t SumSqX() const { return fSums.x.x2; }
+      Weight_t SumSqY() const { return fSums.y.x2; }
+      Weight_t SumXY() const { return fSums.xy; }
+
+      Weight_t AverageX() const
+        { return fSums.x.average("ExponentialStatCollector2D<>::AverageX()"); }
+      Weight_t AverageY() const
+        { return fSums.y.average("ExponentialStatCollector2D<>::AverageY()"); }
+      Weight_t VarianceX() const
+        { return fSums.x.variance("ExponentialStatCollector2D<>::VarianceX()"); }
+      Weight_t VarianceY() const
+        { return fSums.y.variance("ExponentialStatCollector2D<>::VarianceY()"); }
+      Weight_t RMSx() const { return std::sqrt(VarianceX()); }
+      Weight_t RMSy() const { return std::sqrt(VarianceY()); }
+      Weight_t Covariance() const
+        { return fSums.covariance("ExponentialStatCollector2D<>::Covariance()"); }
+
+      /// Returns the linear correlation (see `StatCollector2D`)
+      Weight_t LinearCorrelation() const
+        {
+          return fSums.linearCorrelation
+            ("ExponentialStatCollector2D<>::LinearCorrelation()");
+        }
+
+      /// @}
+
+        protected:
+      Weight_t fDecay; ///< decay factor of the weights
+      int fN = 0; ///< number of added entries
+      details::RunningSums2D<Weight_t> fSums; ///< decayed sums
+
+    }; // class ExponentialStatCollector2D<>
+
+
+    /** ************************************************************************
+     * @brief Collects statistics up to the fourth moment (weighted)
+     * @tparam T type of the quantity
+     * @tparam W type of the weight (as T by default)
+     *
+     * In addition to the average and RMS provided by `StatCollector`, this
+     * collector provides the skewness and the kurtosis of the distribution of
+     * the values, so that e.g. noise shape diagnostics can run in the same
+     * pass as the pedestal estimation:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * lar::util::MomentCollector<double> noise;
+     * noise.add_unweighted(samples.begin(), samples.end());
+     * std::cout << "Pedestal " << noise.Average() << " RMS " << noise.RMS()
+     *   << " excess kurtosis " << noise.ExcessKurtosis() << std::endl;
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     *
+     * The moments are accumulated as central moments (see
+     * `details::CentralMoments`), so they do not suffer from the cancellation
+     * that sums of plain powers of the values show with large pedestals.
+     * The bulk insertion methods process the values in blocks of `BlockSize`,
+     * each with a two-pass, vectorizable algorithm, and then merge the blocks.
+     * Collectors filled separately can be combined with `merge()`.
+     *
+     * The weights are treated as frequencies (a weight of 2 is like adding
+     * the same value twice).
+     */
+    template <typename T, typename W = T>
+    class MomentCollector {
+        public:
+      using This_t = MomentCollector<T, W>; ///< this type
+      using Data_t = T; ///< type of the data
+      using Weight_t = W; ///< type of the weight
+
+      /// Number of values processed together by the bulk insertion methods
+      static constexpr std::size_t BlockSize = 256;
+
+      /// @{
+      /// @name Add elements
+
+      /// Adds one entry with specified value and weight
+      void add(Data_t value, Weight_t weight = Weight_t(1.0))
+        { ++fN; fMoments.add(Weight_t(value), weight); }
+
+      /// Adds entries from a sequence with weight 1
+      template <typename Iter>
+      void add_unweighted(Iter begin, Iter end);
+
+      /// Adds entries from a sequence of (value, weight) pairs
+      template <typename Iter>
+      void add_weighted(Iter begin, Iter end);
+
+      /// Adds all the entries collected by `other`
+      void merge(This_t const& other)
+        { fN += other.fN; fMoments.merge(other.fMoments); }
+
+      ///@}
+
+      /// Clears all the statistics
+      void clear() { fN = 0; fMoments.clear(); }
+
+      /// @{
+      /// @name Statistic retrieval
+
+      /// Returns the number of entries added
+      int N() const { return fN; }
+
+      /// Returns the sum of the weights
+      Weight_t Weights() const { return fMoments.w; }
+
+      /// Returns the value average (throws std::range_error with no weight)
+      Weight_t Average() const;
+
+      /// Returns the square of the RMS (throws std::range_error with no weight)
+      Weight_t Variance() const;
+
+      /// Returns the root mean square
+      Weight_t RMS() const { return std::sqrt(Variance()); }
+
+      /**
+       * @brief Returns the skewness of the distribution
+       * @return the third standardized moment
+       * @throws std::range_error if there is no weight or no variance
+       */
+      Weight_t Skewness() const;
+
+      /**
+       * @brief Returns the kurtosis of the distribution
+       * @return the fourth standardized moment (3 for a gaussian)
+       * @throws std::range_error if there is no weight or no variance
+       */
+      Weight_t Kurtosis() const;
+
+      /// Returns the kurtosis in excess of the gaussian one (`Kurtosis() - 3`)
+      Weight_t ExcessKurtosis() const { return Kurtosis() - Weight_t(3); }
+
+      /// @}
+
+        protected:
+      int fN = 0; ///< number of added entries
+      details::CentralMoments<Weight_t> fMoments; ///< collected moments
+
+      /// Throws std::range_error if the moments can't be standardized
+      void checkVariance(char const* where) const;
+
+    }; // class MomentCollector<>
+
+
+
+    /** ************************************************************************
+     * @brief Keeps track of the minimum and maximum value we observed
+     * @tparam T type of datum
+     *
+     * Implementation note: a similar class with an arbitrary comparison rule
+     * would require a careful choice of initial values for minimum and maximum,
+     * or a entry count that should be checked at each insertion.
+     * We save that slight overhead here.
+     */
+    template <typename T>
+    class MinMaxCollector {
+        public:
+      using Data_t = T; ///< type of data we collect
+      using This_t = MinMaxCollector<T>; ///< this type
+
+      //@{
+      /// Default constructor: no data collected so far.
+      MinMaxCollector() = default;
+
+      /// Constructor: starts with parsing the specified data
+      MinMaxCollector(std::initializer_list<Data_t> init)
+        { add(init); }
+
+      /**
+       * @brief Include a sequence of values in the statistics
+       * @tparam Iter type of an iterator on values
+       * @param begin iterator pointing to the first value to be included
+       * @param end iterator pointing to the last value to be included
+       */
+      template <typename Iter>
+      MinMaxCollector(Iter begin, Iter end)
+        { add(begin, end); }
+      //@}
+
+
+      // default copy and move constructor and assignment, and destructor
+
+      /// @{
+      /// @name Inserters
+      /**
+       * @brief Include a single value in the statistics
+       * @param value the value to be added
+       * @return this object
+       */
+      This_t& add(Data_t value);
+
+      /**
+       * @brief Include a sequence of values in the statistics
+       * @param values the values to be added
+       * @return this object
+       */
+      This_t& add(std::initializer_list<Data_t> values);
+
+      /**
+       * @brief Include a sequence of values in the statistics
+       * @tparam Iter type of an iterator on values
+       * @param begin iterator pointing to the first value to be included
+       * @param end iterator pointing to the last value to be included
+       * @return this object
+       */
+      template <typename Iter>
+      This_t& add(Iter begin, Iter end);
+      /// @}
+
+
+      /// Returns whether at least one datum has been added
+      bool has_data() const { return minimum <= maximum; }
+
+      /// Returns the accumulated minimum, or a very large number if no values
+      Data_t min() const { return minimum; }
+
+      /// Returns the accumulated maximum, or a very small number if no values
+      Data_t max() const { return maximum; }
+
+
+      /// Removes all statistics and reinitializes the object
+      void clear();
+
+        protected:
+      /// the accumulated minimum
+      Data_t minimum = std::numeric_limits<Data_t>::max();
+
+      /// the accumulated maximum
+      Data_t maximum = std::numeric_limits<Data_t>::min();
+
+    }; // class MinMaxCollector<>
+
+
+    /** ************************************************************************
+     * @brief Estimates quantiles of a stream of values in bounded memory
+     * @tparam T type of datum
+     *
+     * The collector keeps a sketch of the distribution of the added values
+     * (the "KLL" sketch by Karnin, Lang and Liberty, 2016) instead of the
+     * values themselves. The sketch is a hierarchy of buffers, where each
+     * element of buffer number _h_ stands for @f$ 2^{h} @f$ values: when a
+     * buffer is full, it is sorted and every other element is moved to the next
+     * buffer. The memory used grows only logarithmically with the number of
+     * values, and it is about `3 * K()` elements for any practical input.
+     *
+     * Accuracy: the estimated rank of any value differs from its exact rank by
+     * a fraction of the number of entries `N()` which is inversely proportional
+     * to `K()`; with the default `K()` of 200 the error is smaller than about
+     * 2% of `N()` in 99% of the cases (1% with `K()` of 400, and so on).
+     * The minimum and the maximum (`Quantile(0.0)` and `Quantile(1.0)`) are
+     * exact. Until the first buffer fills up, all quantiles are exact.
+     * The choice of the element to keep in each compaction uses a pseudo-random
+     * generator with a fixed seed, so that results are reproducible.
+     *
+     * Collectors can be filled independently (e.g. one per thread) and then
+     * merged with `merge()`, with the same accuracy as a single collector
+     * filled with all the values.
+     *
+     * Example estimating the median of a waveform:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * lar::util::QuantileCollector<float> pedestal;
+     * pedestal.add(waveform.begin(), waveform.end());
+     * std::cout << "Median: " << pedestal.Median() << std::endl;
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T>
+    class QuantileCollector {
+        public:
+      using Data_t = T; ///< type of data we collect
+      using This_t = QuantileCollector<T>; ///< this type
+
+      /// Default size parameter of the sketch.
+      static constexpr unsigned int DefaultK = 200U;
+
+      /// Constructor: uses a sketch with size parameter `k` (at least 8)
+      explicit QuantileCollector(unsigned int k = DefaultK);
+
+      // default copy and move constructor and assignment, and destructor
+
+      /// @{
+      /// @name Inserters
+      /**
+       * @brief Include a single value in the statistics
+       * @param value the value to be added
+       * @return this object
+       */
+      This_t& add(Data_t value);
+
+      /**
+       * @brief Include a sequence of values in the statistics
+       * @param values the values to be added
+       * @return this object
+       */
+      This_t& add(std::initializer_list<Data_t> values)
+        { return add(values.begin(), values.end()); }
+
+      /**
+       * @brief Include a sequence of values in the statistics
+       * @tparam Iter type of an iterator on values
+       * @param begin iterator pointing to the first value to be included
+       * @param end iterator pointing to the last value to be included
+       * @return this object
+       */
+      template <typename Iter>
+      This_t& add(Iter begin, Iter end);
+
+      /**
+       * @brief Includes all the values collected by another collector
+       * @param other the collector to be merged into this one
+       * @return this object
+       *
+       * The size parameter of this collector is kept.
+       */
+      This_t& merge(This_t const& other);
+      /// @}
+
+
+      /// Returns the number of values added
+      std::size_t N() const { return fN; }
+
+      /// Returns whether at least one datum has been added
+      bool has_data() const { return fN > 0; }
+
+      /// Returns the size parameter of the sketch
+      unsigned int K() const { return fK; }
+
+      /// Returns the number of values currently stored in the sketch
+      std::size_t SketchSize() const { return fSize; }
+
+      /**
+       * @brief Returns the estimated quantile `q` of the values
+       * @param q the quantile to be returned, between 0 and 1
+       * @return the smallest value with estimated rank not lower than `q N()`
+       * @throws std::range_error if no value was added
+       * @throws std::domain_error if `q` is not between 0 and 1
+       */
+      Data_t Quantile(double q) const;
+
+      /// Returns the estimated median of the values (see `Quantile()`)
+      Data_t Median() const { return Quantile(0.5); }
+
+      /**
+       * @brief Returns the estimated fraction of values not larger than `value`
+       * @throws std::range_error if no value was added
+       */
+      double Rank(Data_t value) const;
+
+      /// Returns the smallest value added (exact; undefined if no data)
+      Data_t min() const { return fMin; }
+
+      /// Returns the largest value added (exact; undefined if no data)
+      Data_t max() const { return fMax; }
+
+
+      /// Removes all statistics and reinitializes the object
+      void clear();
+
+        protected:
+      unsigned int fK; ///< size parameter of the sketch
+      std::size_t fN = 0; ///< number of values added
+      std::size_t fSize = 0; ///< number of values stored in the sketch
+      std::size_t fMaxSize = 0; ///< number of values triggering a compaction
+      std::vector<std::vector<Data_t>> fLevels; ///< buffers, by weight level
+      Data_t fMin = Data_t(0); ///< smallest value added
+      Data_t fMax = Data_t(0); ///< largest value added
+      std::minstd_rand fRandom; ///< generator for the compaction choices
+
+      /// Includes the range [ `low`, `high` ] into the exact range
+      void updateRange(Data_t low, Data_t high);
+
+      /// Returns the capacity of the buffer at `level`
+      std::size_t capacity(std::size_t level) const;
+
+      /// Adds a new top level
+      void grow();
+
+      /// Compacts full buffers until the sketch is below its maximum size
+      void compress();
+
+      /// Returns all the stored values with their weights, sorted by value
+      std::vector<std::pair<Data_t, std::size_t>> weightedValues() const;
+
+    }; // class QuantileCollector<>
+
+
+  } // namespace util
+} // namespace lar
+
+
+//==============================================================================
+//=== template implementation
+//==============================================================================
+
+
+//******************************************************************************
+//***  details::WeightTracker<>
+//***
+
+template <typename W>
+typename lar::util::details::WeightTracker<W>::Weight_t
+  lar::util::details::WeightTracker<W>::AverageWeight() const
+{
+  if (N() == 0)
+    throw std::range_error("WeightTracker<>::AverageWeight(): divide by 0");
+  return Weights() / N();
+} // details::WeightTracker<W>::AverageWeight()
+
+
+//******************************************************************************
+//***  StatCollector<>
+//***
+
+template <typename T, typename W>
+void lar::util::StatCollector<T, W>::add
+  (Data_t value, Weight_t weight /* = Weight_t(1.0) */)
+{
+  Base_t::add(weight);
+  x.add(value, weight);
+} // StatCollector<T, W>::add()
+
+
+template <typename T, typename W>
+template <typename Iter, typename Pred>
+void lar::util::StatCollector<T, W>::add_unweighted
+  (Iter begin, Iter end, Pred extractor)
+{
+  std::for_each
+    (begin, end, [this, extractor](auto item) { this->add(extractor(item)); });
+} // StatCollector<T, W>::add_unweighted(Iter, Iter, Pred)
+
+
+template <typename T, typename W>
+template <typename VIter, typename WIter, typename VPred, typename WPred>
+void lar::util::StatCollector<T, W>::add_weighted(
+  VIter begin_value, VIter end_value,
+  WIter begin_weight,
+  VPred value_extractor,
+  WPred weight_extractor /* = WPred() */
+) {
+  while (begin_value != end_value) {
+    add(value_extractor(*begin_value), weight_extractor(*begin_weight));
+    ++begin_value;
+    ++begin_weight;
+  } // while
+} // StatCollector<T, W>::add_weighted(VIter, VIter, WIter, VPred, WPred)
+
+
+template <typename T, typename W>
+template <typename Iter>
+void lar::util::StatCollector<T, W>::add_weighted(Iter begin, Iter end) {
+
+  std::for_each(begin, end, [this](auto p) { this->add(p.first, p.second); });
+
+} // StatCollector<T, W>::add_weighted(Iter, Iter)
+
+
+
+template <typename T, typename W>
+inline void lar::util::StatCollector<T, W>::clear() {
+  Base_t::clear();
+  x.clear();
+} // StatCollector<T, W>::clear()
+
+
+template <typename T, typename W>
+typename lar::util::StatCollector<T, W>::Weight_t
+  lar::util::StatCollector<T, W>::Average() const
+{
+  if (Weights() == Weight_t(0))
+    throw std::range_error("StatCollector<>::Average(): divide by 0");
+  return Sum() / Weights();
+} // StatCollector<T, W>::Average()
 
 
 template <typename T, typename W>
@@ -1082,6 +2032,446 @@ typename lar::util::StatCollector2D<T, W>::Weight_t
 
 
 
+//******************************************************************************
+//***  details::RunningSums<>
+//***
+
+template <typename W>
+W lar::util::details::RunningSums<W>::average(char const* where) const {
+  if (w == Weight_t(0))
+    throw std::range_error(std::string(where) + ": divide by 0");
+  return x / w;
+} // details::RunningSums<W>::average()
+
+
+template <typename W>
+W lar::util::details::RunningSums<W>::variance(char const* where) const {
+  if (w == Weight_t(0))
+    throw std::range_error(std::string(where) + ": divide by 0");
+  return std::max(Weight_t(0), (x2 - x * x / w) / w);
+} // details::RunningSums<W>::variance()
+
+
+template <typename W>
+W lar::util::details::RunningSums2D<W>::covariance(char const* where) const {
+  if (x.w == Weight_t(0))
+    throw std::range_error(std::string(where) + ": divide by 0");
+  return (xy - x.x * y.x / x.w) / x.w;
+} // details::RunningSums2D<W>::covariance()
+
+
+template <typename W>
+W lar::util::details::RunningSums2D<W>::linearCorrelation
+  (char const* where) const
+{
+  Weight_t const var_prod = x.variance(where) * y.variance(where);
+  if (var_prod <= Weight_t(0))
+    throw std::range_error(std::string(where) + ": variance is 0");
+  return covariance(where) / std::sqrt(var_prod);
+} // details::RunningSums2D<W>::linearCorrelation()
+
+
+//******************************************************************************
+//***  WindowedStatCollector<>
+//***
+
+template <typename T, typename W>
+void lar::util::WindowedStatCollector<T, W>::add
+  (Data_t value, Weight_t weight /* = Weight_t(1.0) */)
+{
+  auto& entry = fEntries[fNext];
+  if (fN == fEntries.size()) fSums.remove(entry.first, entry.second);
+  else ++fN;
+  entry = { value, weight };
+  fSums.add(value, weight);
+  if (++fNext == fEntries.size()) {
+    fNext = 0;
+    refresh(); // once per window: amortized constant time
+  }
+} // WindowedStatCollector<T, W>::add()
+
+
+template <typename T, typename W>
+void lar::util::WindowedStatCollector<T, W>::clear() {
+  fNext = 0;
+  fN = 0;
+  fSums.clear();
+} // WindowedStatCollector<T, W>::clear()
+
+
+template <typename T, typename W>
+typename lar::util::WindowedStatCollector<T, W>::Weight_t
+  lar::util::WindowedStatCollector<T, W>::AverageWeight() const
+{
+  if (fN == 0)
+    throw std::range_error("WindowedStatCollector<>::AverageWeight(): divide by 0");
+  return Weights() / N();
+} // WindowedStatCollector<T, W>::AverageWeight()
+
+
+template <typename T, typename W>
+void lar::util::WindowedStatCollector<T, W>::refresh() {
+  fSums.clear();
+  for (std::size_t i = 0; i < fN; ++i)
+    fSums.add(fEntries[i].first, fEntries[i].second);
+} // WindowedStatCollector<T, W>::refresh()
+
+
+//******************************************************************************
+//***  WindowedStatCollector2D<>
+//***
+
+template <typename T, typename W>
+void lar::util::WindowedStatCollector2D<T, W>::add
+  (Data_t x, Data_t y, Weight_t weight /* = Weight_t(1.0) */)
+{
+  auto& entry = fEntries[fNext];
+  if (fN == fEntries.size())
+    fSums.remove(std::get<0>(entry), std::get<1>(entry), std::get<2>(entry));
+  else ++fN;
+  entry = WeightedPair_t{ x, y, weight };
+  fSums.add(x, y, weight);
+  if (++fNext == fEntries.size()) {
+    fNext = 0;
+    refresh(); // once per window: amortized constant time
+  }
+} // WindowedStatCollector2D<T, W>::add()
+
+
+template <typename T, typename W>
+void lar::util::WindowedStatCollector2D<T, W>::clear() {
+  fNext = 0;
+  fN = 0;
+  fSums.clear();
+} // WindowedStatCollector2D<T, W>::clear()
+
+
+template <typename T, typename W>
+void lar::util::WindowedStatCollector2D<T, W>::refresh() {
+  fSums.clear();
+  for (std::size_t i = 0; i < fN; ++i) {
+    auto const& entry = fEntries[i];
+    fSums.add(std::get<0>(entry), std::get<1>(entry), std::get<2>(entry));
+  }
+} // WindowedStatCollector2D<T, W>::refresh()
+
+
+//******************************************************************************
+//***  ExponentialStatCollector<> and ExponentialStatCollector2D<>
+//***
+
+template <typename T, typename W>
+lar::util::ExponentialStatCollector<T, W>::ExponentialStatCollector
+  (Weight_t decay)
+  : fDecay(decay)
+{
+  if (!(decay > Weight_t(0)) || !(decay <= Weight_t(1))) {
+    throw std::domain_error
+      ("ExponentialStatCollector<>: decay factor must be in ]0, 1]");
+  }
+} // ExponentialStatCollector<T, W>::ExponentialStatCollector()
+
+
+template <typename T, typename W>
+lar::util::ExponentialStatCollector2D<T, W>::ExponentialStatCollector2D
+  (Weight_t decay)
+  : fDecay(decay)
+{
+  if (!(decay > Weight_t(0)) || !(decay <= Weight_t(1))) {
+    throw std::domain_error
+      ("ExponentialStatCollector2D<>: decay factor must be in ]0, 1]");
+  }
+} // ExponentialStatCollector2D<T, W>::ExponentialStatCollector2D()
+
+
+//******************************************************************************
+//***  details::CentralMoments<>
+//***
+
+template <typename W>
+void lar::util::details::CentralMoments<W>::merge(CentralMoments const& other)
+{
+  Weight_t const wa = w, wb = other.w;
+  Weight_t const wt = wa + wb;
+  if (wb == Weight_t(0)) return;
+  if (wa == Weight_t(0)) { *this = other; return; }
+
+  Weight_t const delta = other.mean - mean;
+  Weight_t const d_w = delta / wt;
+  Weight_t const d2_w2 = d_w * d_w;
+  Weight_t const wab = wa * wb;
+
+  // the order matters: each moment uses the old values of the lower ones
+  M4 += other.M4
+    + d2_w2 * d_w * delta * wab * (wa * wa - wab + wb * wb)
+    + Weight_t(6) * d2_w2 * (wa * wa * other.M2 + wb * wb * M2)
+    + Weight_t(4) * d_w * (wa * other.M3 - wb * M3);
+  M3 += other.M3
+    + d2_w2 * delta * wab * (wa - wb)
+    + Weight_t(3) * d_w * (wa * other.M2 - wb * M2);
+  M2 += other.M2 + d_w * delta * wab;
+  mean += d_w * wb;
+  w = wt;
+} // details::CentralMoments<W>::merge()
+
+
+template <typename W>
+auto lar::util::details::CentralMoments<W>::fromBlock
+  (Weight_t const* values, Weight_t const* weights, std::size_t n)
+  -> CentralMoments
+{
+  // accumulation lanes: independent sums the compiler can vectorize
+  constexpr std::size_t NLanes = 4;
+  using Sums_t = std::array<Weight_t, 4>; // weight and three moments
+
+  CentralMoments block;
+
+  // first pass: weight and average
+  Weight_t sumW = Weight_t(0), sumX = Weight_t(0);
+  if (weights) {
+    for (std::size_t i = 0; i < n; ++i) {
+      sumW += weights[i];
+      sumX += weights[i] * values[i];
+    }
+  }
+  else {
+    sumW = Weight_t(n);
+    for (std::size_t i = 0; i < n; ++i) sumX += values[i];
+  }
+  if (sumW == Weight_t(0)) return block;
+  block.w = sumW;
+  block.mean = sumX / sumW;
+
+  // second pass: sums of powers of deviations, d^1 ... d^4
+  std::array<Sums_t, NLanes> lanes{};
+  std::size_t const nFull = n - n % NLanes;
+  for (std::size_t i = 0; i < nFull; i += NLanes) {
+    for (std::size_t lane = 0; lane < NLanes; ++lane) {
+      addPowerSums<Weight_t>(lanes[lane], values[i + lane] - block.mean,
+        weights? weights[i + lane]: Weight_t(1));
+    }
+  }
+  for (std::size_t i = nFull; i < n; ++i) {
+    addPowerSums<Weight_t>
+      (lanes[0], values[i] - block.mean, weights? weights[i]: Weight_t(1));
+  }
+  for (std::size_t lane = 0; lane < NLanes; ++lane) {
+    block.M2 += lanes[lane][1];
+    block.M3 += lanes[lane][2];
+    block.M4 += lanes[lane][3];
+  }
+  return block;
+} // details::CentralMoments<W>::fromBlock()
+
+
+//******************************************************************************
+//***  MomentCollector<>
+//***
+
+template <typename T, typename W>
+template <typename Iter>
+void lar::util::MomentCollector<T, W>::add_unweighted(Iter begin, Iter end) {
+  std::array<Weight_t, BlockSize> values;
+  while (begin != end) {
+    std::size_t n = 0;
+    while ((n < BlockSize) && (begin != end)) values[n++] = Weight_t(*begin++);
+    fN += static_cast<int>(n);
+    fMoments.merge
+      (details::CentralMoments<Weight_t>::fromBlock(values.data(), nullptr, n));
+  } // while
+} // MomentCollector<T, W>::add_unweighted()
+
+
+template <typename T, typename W>
+template <typename Iter>
+void lar::util::MomentCollector<T, W>::add_weighted(Iter begin, Iter end) {
+  std::array<Weight_t, BlockSize> values, weights;
+  while (begin != end) {
+    std::size_t n = 0;
+    while ((n < BlockSize) && (begin != end)) {
+      values[n] = Weight_t(begin->first);
+      weights[n] = Weight_t(begin->second);
+      ++n;
+      ++begin;
+    }
+    fN += static_cast<int>(n);
+    fMoments.merge(details::CentralMoments<Weight_t>::fromBlock
+      (values.data(), weights.data(), n));
+  } // while
+} // MomentCollector<T, W>::add_weighted()
+
+
+template <typename T, typename W>
+typename lar::util::MomentCollector<T, W>::Weight_t
+  lar::util::MomentCollector<T, W>::Average() const
+{
+  if (Weights() == Weight_t(0))
+    throw std::range_error("MomentCollector<>::Average(): divide by 0");
+  return fMoments.mean;
+} // MomentCollector<T, W>::Average()
+
+
+template <typename T, typename W>
+typename lar::util::MomentCollector<T, W>::Weight_t
+  lar::util::MomentCollector<T, W>::Variance() const
+{
+  if (Weights() == Weight_t(0))
+    throw std::range_error("MomentCollector<>::Variance(): divide by 0");
+  return std::max(Weight_t(0), fMoments.M2 / fMoments.w);
+} // MomentCollector<T, W>::Variance()
+
+
+template <typename T, typename W>
+typename lar::util::MomentCollector<T, W>::Weight_t
+  lar::util::MomentCollector<T, W>::Skewness() const
+{
+  checkVariance("MomentCollector<>::Skewness()");
+  return std::sqrt(fMoments.w) * fMoments.M3
+    / (fMoments.M2 * std::sqrt(fMoments.M2));
+} // MomentCollector<T, W>::Skewness()
+
+
+template <typename T, typename W>
+typename lar::util::MomentCollector<T, W>::Weight_t
+  lar::util::MomentCollector<T, W>::Kurtosis() const
+{
+  checkVariance("MomentCollector<>::Kurtosis()");
+  return fMoments.w * fMoments.M4 / (fMoments.M2 * fMoments.M2);
+} // MomentCollector<T, W>::Kurtosis()
+
+
+template <typename T, typename W>
+void lar::util::MomentCollector<T, W>::checkVariance(char const* where) const {
+  if (Weights() == Weight_t(0))
+    throw std::range_error(std::string(where) + ": divide by 0");
+  if (!(fMoments.M2 > Weight_t(0)))
+    throw std::range_error(std::string(where) + ": variance is 0");
+} // MomentCollector<T, W>::checkVariance()
+
+
+//******************************************************************************
+//***  MultiChannelStatCollector<>
+//***
+
+template <typename T, typename W>
+void lar::util::MultiChannelStatCollector<T, W>::resize(std::size_t nChannels)
+{
+  n.resize(nChannels, 0);
+  w.resize(nChannels, Weight_t(0));
+  sum.resize(nChannels, Weight_t(0));
+  sumSq.resize(nChannels, Weight_t(0));
+} // MultiChannelStatCollector<T, W>::resize()
+
+
+template <typename T, typename W>
+inline void lar::util::MultiChannelStatCollector<T, W>::add
+  (std::size_t channel, Data_t value, Weight_t weight /* = Weight_t(1.0) */)
+{
+  ++n[channel];
+  w[channel] += weight;
+  Weight_t const wv = weight * value;
+  sum[channel] += wv;
+  sumSq[channel] += wv * value;
+} // MultiChannelStatCollector<T, W>::add()
+
+
+template <typename T, typename W>
+template <typename Iter>
+void lar::util::MultiChannelStatCollector<T, W>::add_to_all(Iter begin) {
+
+  std::size_t const nChannels = NChannels();
+  // plain pointers help the compiler to see that the arrays do not overlap
+  int* const pN = n.data();
+  Weight_t* const pW = w.data();
+  Weight_t* const pSum = sum.data();
+  Weight_t* const pSumSq = sumSq.data();
+  for (std::size_t i = 0; i < nChannels; ++i, ++begin) {
+    Weight_t const value = static_cast<Data_t>(*begin);
+    ++pN[i];
+    pW[i] += Weight_t(1);
+    pSum[i] += value;
+    pSumSq[i] += value * value;
+  } // for
+
+} // MultiChannelStatCollector<T, W>::add_to_all()
+
+
+template <typename T, typename W>
+template <typename Iter>
+void lar::util::MultiChannelStatCollector<T, W>::add_block(
+  std::size_t firstChannel, std::size_t nChannels, std::size_t nEntries,
+  Iter begin
+) {
+  std::size_t const endChannel = firstChannel + nChannels;
+  for (std::size_t channel = firstChannel; channel < endChannel; ++channel) {
+    // accumulate locally, then update the arrays once per channel
+    Weight_t blockSum = Weight_t(0);
+    Weight_t blockSumSq = Weight_t(0);
+    for (std::size_t i = 0; i < nEntries; ++i, ++begin) {
+      Weight_t const value = static_cast<Data_t>(*begin);
+      blockSum += value;
+      blockSumSq += value * value;
+    } // for entries
+    n[channel] += static_cast<int>(nEntries);
+    w[channel] += static_cast<Weight_t>(nEntries);
+    sum[channel] += blockSum;
+    sumSq[channel] += blockSumSq;
+  } // for channels
+} // MultiChannelStatCollector<T, W>::add_block()
+
+
+template <typename T, typename W>
+void lar::util::MultiChannelStatCollector<T, W>::clear() {
+  std::fill(n.begin(), n.end(), 0);
+  std::fill(w.begin(), w.end(), Weight_t(0));
+  std::fill(sum.begin(), sum.end(), Weight_t(0));
+  std::fill(sumSq.begin(), sumSq.end(), Weight_t(0));
+} // MultiChannelStatCollector<T, W>::clear()
+
+
+template <typename T, typename W>
+typename lar::util::MultiChannelStatCollector<T, W>::Weight_t
+  lar::util::MultiChannelStatCollector<T, W>::Average(std::size_t channel) const
+{
+  if (Weights(channel) == Weight_t(0))
+    throw std::range_error("MultiChannelStatCollector<>::Average(): divide by 0");
+  return Sum(channel) / Weights(channel);
+} // MultiChannelStatCollector<T, W>::Average()
+
+
+template <typename T, typename W>
+typename lar::util::MultiChannelStatCollector<T, W>::Weight_t
+  lar::util::MultiChannelStatCollector<T, W>::Variance(std::size_t channel) const
+{
+  Weight_t const weights = Weights(channel);
+  if (weights == Weight_t(0))
+    throw std::range_error("MultiChannelStatCollector<>::Variance(): divide by 0");
+  Weight_t const s = Sum(channel);
+  return std::max(Weight_t(0), (SumSq(channel) - s * s / weights) / weights);
+} // MultiChannelStatCollector<T, W>::Variance()
+
+
+template <typename T, typename W>
+typename lar::util::MultiChannelStatCollector<T, W>::Weight_t
+  lar::util::MultiChannelStatCollector<T, W>::RMS(std::size_t channel) const
+{
+  return std::sqrt(Variance(channel));
+} // MultiChannelStatCollector<T, W>::RMS()
+
+
+template <typename T, typename W>
+typename lar::util::MultiChannelStatCollector<T, W>::Weight_t
+  lar::util::MultiChannelStatCollector<T, W>::AverageWeight
+  (std::size_t channel) const
+{
+  if (N(channel) == 0) {
+    throw std::range_error
+      ("MultiChannelStatCollector<>::AverageWeight(): divide by 0");
+  }
+  return Weights(channel) / N(channel);
+} // MultiChannelStatCollector<T, W>::AverageWeight()
+
+
 //******************************************************************************
 //*** MinMaxCollector
 //***
@@ -1116,6 +2506,171 @@ inline void lar::util::MinMaxCollector<T>::clear() {
   maximum = std::numeric_limits<Data_t>::min();
 } // lar::util::MinMaxCollector<T>::clear()
 
+//******************************************************************************
+//*** QuantileCollector
+//***
+
+template <typename T>
+lar::util::QuantileCollector<T>::QuantileCollector
+  (unsigned int k /* = DefaultK */)
+  : fK(std::max(k, 8U))
+{
+  grow();
+} // lar::util::QuantileCollector<T>::QuantileCollector()
+
+
+template <typename T>
+lar::util::QuantileCollector<T>& lar::util::QuantileCollector<T>::add
+  (Data_t value)
+{
+  updateRange(value, value);
+  fLevels.front().push_back(value);
+  ++fN;
+  if (++fSize >= fMaxSize) compress();
+  return *this;
+} // lar::util::QuantileCollector<T>::add()
+
+
+template <typename T> template <typename Iter>
+inline lar::util::QuantileCollector<T>& lar::util::QuantileCollector<T>::add
+  (Iter begin, Iter end)
+{
+  std::for_each(begin, end, [this](Data_t value) { this->add(value); });
+  return *this;
+} // lar::util::QuantileCollector<T>::add(Iter)
+
+
+template <typename T>
+lar::util::QuantileCollector<T>& lar::util::QuantileCollector<T>::merge
+  (This_t const& other)
+{
+  if (!other.has_data()) return *this;
+  updateRange(other.min(), other.max());
+  while (fLevels.size() < other.fLevels.size()) grow();
+  for (std::size_t level = 0; level < other.fLevels.size(); ++level) {
+    auto const& values = other.fLevels[level];
+    fLevels[level].insert(fLevels[level].end(), values.begin(), values.end());
+  }
+  fN += other.fN;
+  fSize += other.fSize;
+  while (fSize >= fMaxSize) compress();
+  return *this;
+} // lar::util::QuantileCollector<T>::merge()
+
+
+template <typename T>
+T lar::util::QuantileCollector<T>::Quantile(double q) const {
+  if (!has_data())
+    throw std::range_error("QuantileCollector<>::Quantile(): no data");
+  if (!(q >= 0.0) || !(q <= 1.0))
+    throw std::domain_error("QuantileCollector<>::Quantile(): q out of [0,1]");
+  if (q == 0.0) return min();
+  if (q == 1.0) return max();
+
+  double const target = q * fN;
+  std::size_t cumulative = 0;
+  for (auto const& [ value, weight ]: weightedValues()) {
+    cumulative += weight;
+    if (cumulative >= target) return value;
+  }
+  return max();
+} // lar::util::QuantileCollector<T>::Quantile()
+
+
+template <typename T>
+double lar::util::QuantileCollector<T>::Rank(Data_t value) const {
+  if (!has_data())
+    throw std::range_error("QuantileCollector<>::Rank(): no data");
+  std::size_t rank = 0;
+  for (std::size_t level = 0; level < fLevels.size(); ++level) {
+    for (Data_t const& item: fLevels[level])
+      if (!(value < item)) rank += std::size_t(1) << level;
+  }
+  return static_cast<double>(rank) / fN;
+} // lar::util::QuantileCollector<T>::Rank()
+
+
+template <typename T>
+void lar::util::QuantileCollector<T>::clear() {
+  fN = 0;
+  fSize = 0;
+  fLevels.clear();
+  fRandom.seed();
+  grow();
+} // lar::util::QuantileCollector<T>::clear()
+
+
+template <typename T>
+void lar::util::QuantileCollector<T>::updateRange(Data_t low, Data_t high) {
+  if (!has_data()) {
+    fMin = low;
+    fMax = high;
+    return;
+  }
+  if (low < fMin) fMin = low;
+  if (high > fMax) fMax = high;
+} // lar::util::QuantileCollector<T>::updateRange()
+
+
+template <typename T>
+std::size_t lar::util::QuantileCollector<T>::capacity(std::size_t level) const
+{
+  // lower levels are smaller, by a factor 2/3 each
+  std::size_t const depth = fLevels.size() - level - 1;
+  return
+    static_cast<std::size_t>(std::ceil(std::pow(2.0 / 3.0, depth) * fK)) + 1;
+} // lar::util::QuantileCollector<T>::capacity()
+
+
+template <typename T>
+void lar::util::QuantileCollector<T>::grow() {
+  fLevels.emplace_back();
+  fMaxSize = 0;
+  for (std::size_t level = 0; level < fLevels.size(); ++level)
+    fMaxSize += capacity(level);
+} // lar::util::QuantileCollector<T>::grow()
+
+
+template <typename T>
+void lar::util::QuantileCollector<T>::compress() {
+  for (std::size_t level = 0; level < fLevels.size(); ++level) {
+    if (fLevels[level].size() < capacity(level)) continue;
+    if (level + 1 >= fLevels.size()) grow();
+
+    // keep either the odd or the even elements, doubling their weight;
+    // with an odd number of elements, the largest one stays behind
+    std::vector<Data_t>& values = fLevels[level];
+    std::vector<Data_t>& next = fLevels[level + 1];
+    std::sort(values.begin(), values.end());
+    std::size_t const nPairs = values.size() / 2;
+    std::size_t const offset = fRandom() & 1U;
+    for (std::size_t i = 0; i < nPairs; ++i)
+      next.push_back(values[2 * i + offset]);
+    bool const odd = (values.size() % 2) == 1;
+    if (odd) values.front() = values.back();
+    values.resize(odd? 1: 0);
+    fSize -= nPairs;
+
+    if (fSize < fMaxSize) break;
+  } // for
+} // lar::util::QuantileCollector<T>::compress()
+
+
+template <typename T>
+auto lar::util::QuantileCollector<T>::weightedValues() const
+  -> std::vector<std::pair<Data_t, std::size_t>>
+{
+  std::vector<std::pair<Data_t, std::size_t>> values;
+  values.reserve(fSize);
+  for (std::size_t level = 0; level < fLevels.size(); ++level) {
+    std::size_t const weight = std::size_t(1) << level;
+    for (Data_t const& value: fLevels[level]) values.emplace_back(value, weight);
+  }
+  std::sort(values.begin(), values.end(),
+    [](auto const& a, auto const& b){ return a.first < b.first; });
+  return values;
+} // lar::util::QuantileCollector<T>::weightedValues()
+
 //******************************************************************************
 
 
@@ -424,7 +424,7 @@ namespace util::quantities {
        * The `value` is cast into `value_t` via `static_cast()`.
        */
       template <typename U>
-      static interval_t castFrom(U value)
+      static constexpr interval_t castFrom(U value)
         { return interval_t{ static_cast<value_t>(value) }; }
 
 
@@ -988,7 +988,7 @@ namespace util::quantities {
        * The `value` is cast into `value_t` via `static_cast()`.
        */
       template <typename U>
-      static point_t castFrom(U value)
+      static constexpr point_t castFrom(U value)
         { return point_t{ static_cast<value_t>(value) }; }
 
 
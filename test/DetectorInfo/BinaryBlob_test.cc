@@ -0,0 +1,165 @@
+/**
+ * @file   BinaryBlob_test.cc
+ * @brief  Test of the binary blob storage.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/BinaryBlob.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( BinaryBlob_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+
+// C/C++ standard libraries
+#include <cstdint>
+#include <cstdio> // std::remove()
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+enum class TestEnum_t: std::uint8_t { A, B, C };
+
+detinfo::BlobWriter makeTestBlob() {
+  detinfo::BlobWriter out;
+  out.write(3.5);
+  out.write(-7);
+  out.write(true);
+  out.write(TestEnum_t::C);
+  out.write(std::string{"argon"});
+  out.write(std::vector<double>{ 1.0, 2.0, 4.0 });
+  out.write(std::vector<std::string>{ "U", "", "Z" });
+  out.write(std::vector<std::vector<float>>{ { 1.0f }, {}, { 2.0f, 3.0f } });
+  return out;
+} // makeTestBlob()
+
+
+void checkTestBlob(detinfo::BlobReader in) {
+  BOOST_TEST(in.read<double>() == 3.5);
+  BOOST_TEST(in.read<int>() == -7);
+  BOOST_TEST(in.read<bool>() == true);
+  BOOST_TEST((in.read<TestEnum_t>() == TestEnum_t::C));
+  BOOST_TEST(in.read<std::string>() == "argon");
+
+  std::vector<double> const doubles = in.read<std::vector<double>>();
+  std::vector<double> const expectedDoubles{ 1.0, 2.0, 4.0 };
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (doubles.begin(), doubles.end(), expectedDoubles.begin(), expectedDoubles.end());
+
+  std::vector<std::string> strings;
+  in.read(strings);
+  std::vector<std::string> const expectedStrings{ "U", "", "Z" };
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (strings.begin(), strings.end(), expectedStrings.begin(), expectedStrings.end());
+
+  auto const nested = in.read<std::vector<std::vector<float>>>();
+  BOOST_TEST(nested.size() == 3U);
+  BOOST_TEST(nested[0U].size() == 1U);
+  BOOST_TEST(nested[1U].empty());
+  BOOST_TEST(nested[2U].size() == 2U);
+  BOOST_TEST(nested[2U][1U] == 3.0f);
+
+  BOOST_TEST(in.atEnd());
+  BOOST_CHECK_THROW(in.read<char>(), cet::exception);
+} // checkTestBlob()
+
+
+//------------------------------------------------------------------------------
+void MemoryRoundTripTest() {
+  auto const out = makeTestBlob();
+  auto const& data = out.data();
+  checkTestBlob({ data.data(), data.data() + data.size() });
+
+  // truncated payload
+  detinfo::BlobReader in{ data.data(), data.data() + 20U };
+  in.read<double>();
+  in.read<int>();
+  in.read<bool>();
+  in.read<TestEnum_t>();
+  BOOST_CHECK_THROW(in.read<std::string>(), cet::exception);
+} // MemoryRoundTripTest()
+
+
+//------------------------------------------------------------------------------
+void FileRoundTripTest() {
+  std::string const path = "BinaryBlob_test.bin";
+  makeTestBlob().saveTo(path, 5U, "test configuration");
+
+  {
+    detinfo::MappedBlob const blob{ path, 5U, "test configuration" };
+    BOOST_TEST(blob.tag() == "test configuration");
+    BOOST_TEST(blob.header().content == 5U);
+    checkTestBlob(blob.reader());
+  }
+  {
+    detinfo::MappedBlob const blob{ path, 5U }; // any tag
+    checkTestBlob(blob.reader());
+  }
+
+  BOOST_CHECK_THROW(detinfo::MappedBlob(path, 6U), cet::exception);
+  BOOST_CHECK_THROW(detinfo::MappedBlob(path, 5U, "other"), cet::exception);
+  BOOST_CHECK_THROW(detinfo::MappedBlob("nonexisting.bin", 5U), cet::exception);
+
+  // corrupt the last byte of the payload
+  {
+    std::fstream file{ path, std::ios::in | std::ios::out | std::ios::binary };
+    file.seekg(-1, std::ios::end);
+    char const last = static_cast<char>(file.get());
+    file.seekp(-1, std::ios::end);
+    file.put(static_cast<char>(last ^ 0x40));
+  }
+  BOOST_CHECK_THROW(detinfo::MappedBlob(path, 5U), cet::exception);
+
+  std::remove(path.c_str());
+
+  BOOST_CHECK_THROW
+    (detinfo::BlobWriter{}.saveTo(path, 1U, std::string(60U, 'x')), cet::exception);
+
+} // FileRoundTripTest()
+
+
+//------------------------------------------------------------------------------
+void ConcurrentSaveTest() {
+  std::string const path = "BinaryBlob_concurrent_test.bin";
+
+  // two writers replacing the same file; each save must be complete
+  auto const save = [&path]()
+    { for (int i = 0; i < 50; ++i) makeTestBlob().saveTo(path, 5U); };
+  std::thread writer1 { save }, writer2 { save };
+  writer1.join();
+  writer2.join();
+  checkTestBlob(detinfo::MappedBlob{ path, 5U }.reader());
+  std::remove(path.c_str());
+
+  // failures do not leave temporary files behind
+  BOOST_CHECK_THROW(makeTestBlob().saveTo("nonexisting/" + path, 5U), cet::exception);
+
+  unsigned int nLeftovers = 0U;
+  for (auto const& entry: std::filesystem::directory_iterator{ "." }) {
+    if (entry.path().filename().string().rfind(path, 0) == 0) ++nLeftovers;
+  }
+  BOOST_CHECK_EQUAL(nLeftovers, 0U);
+
+} // ConcurrentSaveTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MemoryRoundTripTestCase) {
+  MemoryRoundTripTest();
+}
+
+BOOST_AUTO_TEST_CASE(FileRoundTripTestCase) {
+  FileRoundTripTest();
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentSaveTestCase) {
+  ConcurrentSaveTest();
+}
+
+//------------------------------------------------------------------------------
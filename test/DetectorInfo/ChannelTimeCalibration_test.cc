@@ -0,0 +1,237 @@
+/**
+ * @file   ChannelTimeCalibration_test.cc
+ * @brief  Test of the per-channel time offset table.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ChannelTimeCalibration.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ChannelTimeCalibration_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/ChannelTimeCalibration.h"
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::equal()
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <sstream> // std::istringstream
+#include <stdexcept> // std::domain_error, std::out_of_range
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+std::string const TestTable = R"(
+# two boards of 4 channels, with a few channel offsets
+board 0 3 0.5
+board 4 7 -1.0
+channel 2 0.25  # on top of the board
+channel 6 0.125
+channel 9 2.0
+)";
+
+
+//------------------------------------------------------------------------------
+void ReadTest() {
+
+  std::istringstream in { TestTable };
+  detinfo::ChannelTimeCalibration const calib
+    = detinfo::ChannelTimeCalibration::Read(in, 12U);
+
+  BOOST_CHECK_EQUAL(calib.version(), 12U);
+  BOOST_REQUIRE_EQUAL(calib.nChannels(), 10U);
+  std::vector<double> const expected
+    { 0.5, 0.5, 0.75, 0.5, -1.0, -1.0, -0.875, -1.0, 0.0, 2.0 };
+  for (unsigned int channel = 0; channel < expected.size(); ++channel)
+    BOOST_CHECK_EQUAL(calib.offset(channel).value(), expected[channel]);
+
+  for (std::string const bad: { "channel 2", "board 3 1 0.5", "wire 1 0.5",
+    "channel 1 0.5 extra", "channel 1 0.5\nchannel 1 0.2" }
+  ) {
+    std::istringstream badIn { bad };
+    BOOST_CHECK_THROW
+      (detinfo::ChannelTimeCalibration::Read(badIn), std::domain_error);
+  }
+
+  // the table covers exactly the declared channels
+  std::istringstream sizedIn { TestTable };
+  detinfo::ChannelTimeCalibration const sized
+    = detinfo::ChannelTimeCalibration::Read(sizedIn, 12U, 16U);
+  BOOST_REQUIRE_EQUAL(sized.nChannels(), 16U);
+  BOOST_CHECK(std::equal
+    (expected.begin(), expected.end(), sized.offsetValues().begin()));
+  BOOST_CHECK_EQUAL(sized.offset(15).value(), 0.0);
+
+  // huge channel numbers are rejected rather than allocated for
+  std::istringstream tooHighIn { TestTable };
+  BOOST_CHECK_THROW
+    (detinfo::ChannelTimeCalibration::Read(tooHighIn, 12U, 8U), std::domain_error);
+  for (std::string const huge: { "channel 4000000000 1.0", "board 0 3999999999 1.0" })
+  {
+    std::istringstream hugeIn { huge };
+    BOOST_CHECK_THROW
+      (detinfo::ChannelTimeCalibration::Read(hugeIn), std::domain_error);
+  }
+
+} // ReadTest()
+
+
+//------------------------------------------------------------------------------
+void ApplyTest() {
+
+  using namespace detinfo::timescales;
+
+  detinfo::ChannelTimeCalibration const calib{{
+    time_interval{ 1.0 }, time_interval{ -0.5 }, time_interval{ 0.0 },
+    time_interval{ 0.26 }
+  }};
+
+  std::vector<raw::ChannelID_t> const channels { 3, 0, 1, 1, 2 };
+  std::vector<electronics_time> times(channels.size(), electronics_time{ 10.0 });
+  calib.apply(channels, times);
+  BOOST_CHECK_CLOSE(times[0].value(), 10.26, 1e-9);
+  BOOST_CHECK_CLOSE(times[1].value(), 11.0, 1e-9);
+  BOOST_CHECK_CLOSE(times[3].value(), 9.5, 1e-9);
+  BOOST_CHECK_CLOSE(times[4].value(), 10.0, 1e-9);
+
+  // simulation time is in nanoseconds
+  std::vector<simulation_time> simTimes(channels.size(), simulation_time{ 0.0 });
+  calib.apply(channels.data(), simTimes.data(), simTimes.size());
+  BOOST_CHECK_CLOSE(simTimes[1].value(), 1000.0, 1e-9);
+
+  // ticks of 0.5 us: integral ticks are rounded
+  std::vector<TPCelectronics_tick> ticks(channels.size(), TPCelectronics_tick{ 100 });
+  calib.applyToTicks(channels, ticks, time_interval{ 0.5 });
+  BOOST_CHECK_EQUAL(ticks[0].value(), 101); // 0.52 ticks
+  BOOST_CHECK_EQUAL(ticks[1].value(), 102);
+  BOOST_CHECK_EQUAL(ticks[2].value(), 99);
+  std::vector<TPCelectronics_tick_d> ticksD(channels.size(), TPCelectronics_tick_d{ 100.0 });
+  calib.applyToTicks(channels, ticksD, time_interval{ 0.5 });
+  BOOST_CHECK_CLOSE(ticksD[0].value(), 100.52, 1e-9);
+
+  // many times, applied in several blocks
+  std::vector<raw::ChannelID_t> manyChannels(1000U);
+  for (std::size_t i = 0; i < manyChannels.size(); ++i) manyChannels[i] = i % 4U;
+  std::vector<electronics_time> manyTimes(manyChannels.size(), electronics_time{ 1.0 });
+  calib.apply(manyChannels, manyTimes);
+  for (std::size_t i = 0; i < manyTimes.size(); ++i) {
+    BOOST_CHECK_CLOSE
+      (manyTimes[i].value(), 1.0 + calib.offset(manyChannels[i]).value(), 1e-9);
+  }
+
+  // invalid channels are detected before any change
+  std::vector<raw::ChannelID_t> const badChannels { 0, 4 };
+  std::vector<electronics_time> badTimes(2U, electronics_time{ 10.0 });
+  BOOST_CHECK_THROW(calib.apply(badChannels, badTimes), std::out_of_range);
+  BOOST_CHECK_EQUAL(badTimes[0].value(), 10.0);
+  BOOST_CHECK_THROW(calib.apply(channels, badTimes), std::out_of_range);
+
+} // ApplyTest()
+
+
+//------------------------------------------------------------------------------
+void CacheTest() {
+
+  std::string const textPath = "ChannelTimeCalibration_test.txt";
+  std::string const cachePath = "ChannelTimeCalibration_test.bin";
+  std::remove(cachePath.c_str());
+  std::ofstream{ textPath } << TestTable;
+
+  // first read parses the text and writes the cache
+  detinfo::ChannelTimeCalibration const calib
+    = detinfo::ChannelTimeCalibration::FromFile(textPath, cachePath, 5U);
+  BOOST_CHECK_EQUAL(calib.version(), 5U);
+  BOOST_CHECK_EQUAL(calib.nChannels(), 10U);
+  BOOST_CHECK(std::ifstream{ cachePath }.good());
+
+  // the cache is used while the text is unchanged: to prove it, replace its
+  // content keeping the tag (which identifies the text)
+  std::string const tag = detinfo::MappedBlob
+    { cachePath, detinfo::ChannelTimeCalibrationCacheVersion }.tag();
+  BOOST_CHECK(detinfo::ChannelTimeCalibration::LoadCache(cachePath, tag)
+    .offsetValues() == calib.offsetValues());
+  detinfo::ChannelTimeCalibration{ { detinfo::timescales::time_interval{ 7.0 } } }
+    .SaveCache(cachePath, tag);
+  detinfo::ChannelTimeCalibration const cached
+    = detinfo::ChannelTimeCalibration::FromFile(textPath, cachePath, 6U);
+  BOOST_CHECK_EQUAL(cached.version(), 6U);
+  BOOST_REQUIRE_EQUAL(cached.nChannels(), 1U);
+  BOOST_CHECK_EQUAL(cached.offset(0).value(), 7.0);
+
+  // a cache with a different number of channels than declared is rebuilt
+  detinfo::ChannelTimeCalibration const sized
+    = detinfo::ChannelTimeCalibration::FromFile(textPath, cachePath, 6U, 10U);
+  BOOST_CHECK(sized.offsetValues() == calib.offsetValues());
+
+  // ... and rebuilt when the text changes
+  std::ofstream{ textPath } << "channel 0 3.0\n";
+  detinfo::ChannelTimeCalibration const updated
+    = detinfo::ChannelTimeCalibration::FromFile(textPath, cachePath);
+  BOOST_REQUIRE_EQUAL(updated.nChannels(), 1U);
+  BOOST_CHECK_EQUAL(updated.offset(0).value(), 3.0);
+  BOOST_CHECK_EQUAL
+    (detinfo::ChannelTimeCalibration::LoadCache(cachePath).nChannels(), 1U);
+
+  BOOST_CHECK_THROW(
+    detinfo::ChannelTimeCalibration::LoadCache(cachePath, "other"),
+    cet::exception
+    );
+  BOOST_CHECK_THROW(
+    detinfo::ChannelTimeCalibration::FromFile("ChannelTimeCalibration_none.txt"),
+    std::runtime_error
+    );
+
+  std::remove(textPath.c_str());
+  std::remove(cachePath.c_str());
+
+} // CacheTest()
+
+
+//------------------------------------------------------------------------------
+void SourceTest() {
+
+  using detinfo::timescales::time_interval;
+
+  detinfo::ChannelTimeCalibrationSource source;
+  BOOST_CHECK_EQUAL(source.current()->nChannels(), 0U);
+
+  source.update(detinfo::ChannelTimeCalibration{ { time_interval{ 1.0 } }, 1U });
+  auto const snapshot = source.current();
+  BOOST_CHECK_EQUAL(source.version(), 1U);
+
+  // a reader keeps its snapshot after an update
+  source.update(detinfo::ChannelTimeCalibration{ { time_interval{ 2.0 } }, 2U });
+  BOOST_CHECK_EQUAL(snapshot->version(), 1U);
+  BOOST_CHECK_EQUAL(snapshot->offset(0).value(), 1.0);
+  BOOST_CHECK_EQUAL(source.version(), 2U);
+  BOOST_CHECK_EQUAL(source.current()->offset(0).value(), 2.0);
+
+} // SourceTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReadTestCase) {
+  ReadTest();
+}
+
+BOOST_AUTO_TEST_CASE(ApplyTestCase) {
+  ApplyTest();
+}
+
+BOOST_AUTO_TEST_CASE(CacheTestCase) {
+  CacheTest();
+}
+
+BOOST_AUTO_TEST_CASE(SourceTestCase) {
+  SourceTest();
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,138 @@
+/**
+ * @file   DetectorClocksPresetsStandard_test.cc
+ * @brief  Checks the timing presets against `DetectorClocksStandard`.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/DetectorClocksPresets.h
+ *
+ * The provider is configured from the same FHiCL files that define the
+ * configurations the presets replicate, and the timing data it provides must
+ * match the one of the preset, parameter by parameter.
+ */
+
+// LArSoft libraries
+#include "larcorealg/TestUtils/unit_test_base.h"
+#include "lardataalg/DetectorInfo/DetectorClocksPresets.h"
+#include "lardataalg/DetectorInfo/DetectorClocksStandard.h"
+#include "lardataalg/DetectorInfo/DetectorClocksStandardTestHelpers.h"
+
+// framework libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <map>
+#include <string>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using TestEnvironment = testing::TesterEnvironment<testing::BasicEnvironmentConfiguration>;
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("DetectorClocksPresetsStandard_test")
+ * 1. (mandatory) path to the FHiCL configuration file
+ * 2. (mandatory) name of the preset to compare to: `standard`, `csu40L`,
+ *    `bo` or `lartpcdetector`
+ * 3. FHiCL path to the configuration of DetectorClocks service
+ *    (default: services.DetectorClocksService)
+ *
+ */
+//------------------------------------------------------------------------------
+int
+main(int argc, char const** argv)
+{
+
+  testing::BasicEnvironmentConfiguration config("clocks_presets_test");
+
+  std::map<std::string, detinfo::presets::ClocksConfiguration const*> const
+    presets{
+      {"standard", &detinfo::presets::StandardClocks},
+      {"csu40L", &detinfo::presets::StandardClocks},
+      {"bo", &detinfo::presets::BoClocks},
+      {"lartpcdetector", &detinfo::presets::LArTPCdetectorClocks},
+    };
+
+  //
+  // parameter parsing
+  //
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    config.SetConfigurationPath(argv[iParam]);
+  else {
+    std::cerr << "FHiCL configuration file path required as first argument!" << std::endl;
+    return 1;
+  }
+
+  // second argument: name of the preset (mandatory)
+  if (++iParam >= argc) {
+    std::cerr << "Preset name required as second argument!" << std::endl;
+    return 1;
+  }
+  std::string const presetName = argv[iParam];
+  auto const iPreset = presets.find(presetName);
+  if (iPreset == presets.end()) {
+    std::cerr << "Unknown preset: '" << presetName << "'" << std::endl;
+    return 1;
+  }
+
+  // third argument: path of the parameter set for DetectorClocks configuration
+  // (optional; default: "services.DetectorClocks" from the inherited object)
+  if (++iParam < argc) config.SetServiceParameterSetPath("DetectorClocksService", argv[iParam]);
+
+  unsigned int nErrors = 0;
+
+  //
+  // testing environment setup
+  //
+  TestEnvironment TestEnv(config);
+
+  TestEnv.SimpleProviderSetup<detinfo::DetectorClocksStandard>();
+
+  auto const* detClocks = TestEnv.Provider<detinfo::DetectorClocks>();
+  detinfo::DetectorClocksData const& detClocksData = detClocks->DataForJob();
+  detinfo::DetectorClocksData const presetData = iPreset->second->data();
+
+  //
+  // comparison, parameter by parameter
+  //
+  for (std::string const& mismatch :
+       detinfo::presets::clocksMismatches(detClocksData, presetData)) {
+    mf::LogError("clocks_presets_test") << "Preset '" << presetName << "': " << mismatch;
+    ++nErrors;
+  }
+
+  if (!detinfo::presets::sameClocks(detClocksData, presetData)) {
+    if (nErrors == 0) {
+      mf::LogError("clocks_presets_test")
+        << "Preset '" << presetName << "' reported different, with no mismatch.";
+      ++nErrors;
+    }
+  }
+  else if (nErrors > 0) {
+    mf::LogError("clocks_presets_test")
+      << "Preset '" << presetName << "' reported the same, with " << nErrors << " mismatches.";
+    ++nErrors;
+  }
+
+  if (nErrors > 0) { mf::LogError("clocks_presets_test") << nErrors << " errors detected!"; }
+  else {
+    mf::LogVerbatim("clocks_presets_test")
+      << "Configuration '" << argv[1] << "' matches preset '" << presetName << "'.";
+  }
+
+  return nErrors;
+} // main()
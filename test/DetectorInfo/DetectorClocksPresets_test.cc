@@ -0,0 +1,120 @@
+/**
+ * @file   DetectorClocksPresets_test.cc
+ * @brief  Test of the compile-time timing configurations.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/DetectorClocksPresets.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorClocksPresets_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/DetectorClocksPresets.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorTimings.h"
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h"
+#include "lardataalg/DetectorInfo/DetectorClocksException.h"
+#include "lardataalg/DetectorInfo/ClockConstants.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <string>
+
+
+//------------------------------------------------------------------------------
+// the presets and the conversions are compile-time constants
+constexpr detinfo::DetectorClocksData LArTPCdetectorData
+  = detinfo::presets::LArTPCdetectorClocks.data();
+
+static_assert(LArTPCdetectorData.TriggerTime() == 3200.0);
+static_assert(LArTPCdetectorData.TPCTime() == 1600.0);
+static_assert(LArTPCdetectorData.TPCClock().FrameTicks() == 3200);
+static_assert(LArTPCdetectorData.OpticalTick2Time(64.0, 0, 2) == 3201.0);
+static_assert(detinfo::presets::sameClocks
+  (LArTPCdetectorData, detinfo::presets::LArTPCdetectorClocks.data()));
+static_assert(!detinfo::presets::sameClocks
+  (LArTPCdetectorData, detinfo::presets::BoClocks.data()));
+
+static_assert(LArTPCdetectorData.G4ToElecTime(0.0) == 3200.0);
+static_assert(LArTPCdetectorData.Time2Tick(1601.0) == 2.0);
+static_assert(LArTPCdetectorData.TPCTick2Time(4.0) == 1602.0);
+
+// and so are the timings with units
+using namespace detinfo::timescales;
+using namespace util::quantities::time_literals;
+
+constexpr detinfo::DetectorTimings LArTPCdetectorTimings{ LArTPCdetectorData };
+
+static_assert
+  (LArTPCdetectorTimings.TriggerTime() == electronics_time{ 3200_us });
+static_assert(LArTPCdetectorTimings.startTime<TPCelectronics_time>()
+  == electronics_time{ 1600_us });
+static_assert(LArTPCdetectorTimings.toElectronicsTime(simulation_time{ 0_ns })
+  == electronics_time{ 3200_us });
+static_assert(LArTPCdetectorTimings.toTimeScale<trigger_time>
+  (electronics_time{ 3201_us }) == trigger_time{ 1_us });
+static_assert(LArTPCdetectorTimings.toTick<TPCelectronics_tick_d>
+  (electronics_time{ 1601_us }).value() == 2.0);
+static_assert
+  (LArTPCdetectorTimings.toOpticalTick(electronics_time{ 1_us }).value() == 64);
+static_assert(LArTPCdetectorTimings.ClockPeriodFor<TPCelectronics_time>()
+  == 0.5_us);
+
+
+//------------------------------------------------------------------------------
+void PresetCheckTest() {
+
+  detinfo::DetectorClocksData const preset
+    = detinfo::presets::StandardClocks.data();
+
+  // matching configuration, within tolerance
+  detinfo::DetectorClocksData const same{
+    1e-9, 0.0, 0.0, 0.0,
+    detinfo::ElecClock{0.0, 405.504, 5.0505},
+    detinfo::ElecClock{0.0, 405.504, 64.0},
+    detinfo::ElecClock{0.0, 405.504, 16.0},
+    detinfo::ElecClock
+      {0, detinfo::kDEFAULT_FRAME_PERIOD, detinfo::kDEFAULT_FREQUENCY_EXTERNAL}
+  };
+  BOOST_CHECK_NO_THROW
+    (detinfo::presets::checkClocksPreset(same, preset, "standard"));
+  BOOST_CHECK(detinfo::presets::sameClocks(same, preset));
+  BOOST_CHECK(!detinfo::presets::sameClocks(same, preset, 0.0));
+
+  // different TPC clock and trigger time
+  detinfo::DetectorClocksData const different{
+    0.0, 0.0, 10.0, 0.0,
+    detinfo::ElecClock{10.0, 405.504, 2.0},
+    detinfo::ElecClock{10.0, 405.504, 64.0},
+    detinfo::ElecClock{10.0, 405.504, 16.0},
+    detinfo::ElecClock
+      {0, detinfo::kDEFAULT_FRAME_PERIOD, detinfo::kDEFAULT_FREQUENCY_EXTERNAL}
+  };
+  BOOST_CHECK(!detinfo::presets::sameClocks(different, preset));
+
+  // trigger time, and the time of TPC, optical and trigger clocks;
+  // TPC clock frequency
+  BOOST_CHECK_EQUAL
+    (detinfo::presets::clocksMismatches(different, preset).size(), 5U);
+
+  std::string message;
+  try {
+    detinfo::presets::checkClocksPreset(different, preset, "standard");
+  }
+  catch (detinfo::DetectorClocksException const& e) {
+    message = e.msg();
+  }
+  BOOST_CHECK(message.find("'standard'") != std::string::npos);
+  BOOST_CHECK(message.find("TPC clock frequency: 2") != std::string::npos);
+
+} // PresetCheckTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PresetCheckTestCase) {
+  PresetCheckTest();
+}
+
+//------------------------------------------------------------------------------
@@ -10,14 +10,23 @@
 #include "larcorealg/Geometry/ChannelMapStandardAlg.h"
 #include "larcorealg/Geometry/GeometryCore.h"
 #include "lardataalg/DetectorInfo/DetectorClocksStandardTestHelpers.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesSnapshot.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandard.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesStandardTestHelpers.h"
 #include "lardataalg/DetectorInfo/LArPropertiesStandardTestHelpers.h"
 #include "test/Geometry/geometry_unit_test_base.h"
 
+// framework libraries
+#include "cetlib_except/exception.h"
+
 // C/C++ standard libraries
 #include <array>
 #include <iomanip>
+#include <set>
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <utility> // std::move()
+#include <vector>
 
 //------------------------------------------------------------------------------
 //---  The test environment
@@ -177,6 +186,153 @@ main(int argc, char const** argv)
     } // for TPC
   }
 
+  // the snapshot must reproduce the provider values
+  lar::util::RealComparisons<double> checkValue(1e-6);
+  auto const& larp = *TestEnv.Provider<detinfo::LArProperties>();
+  detinfo::DetectorPropertiesSnapshot const snapshot{detp, larp};
+  if (snapshot.NPlaneGaps() != detp.NPlaneGaps()) {
+    mf::LogError("detp_test") << "Snapshot has " << snapshot.NPlaneGaps()
+                              << " plane gaps, expected " << detp.NPlaneGaps();
+    ++nErrors;
+  }
+  try {
+    snapshot.Efield(snapshot.NPlaneGaps());
+    mf::LogError("detp_test") << "Snapshot electric field past the last plane gap";
+    ++nErrors;
+  }
+  catch (std::out_of_range const&) {
+  }
+  if ((snapshot.Argon39DecayRate() != larp.Argon39DecayRate()) ||
+      (snapshot.ScintYield(true) != larp.ScintYield(true)) ||
+      (snapshot.ScintYield(false) != larp.ScintYield(false)) ||
+      (snapshot.AlphaScintYieldRatio() != larp.AlphaScintYieldRatio()) ||
+      (snapshot.ScintFastTimeConst() != larp.ScintFastTimeConst()) ||
+      (snapshot.ScintSlowTimeConst() != larp.ScintSlowTimeConst()) ||
+      (snapshot.CerenkovLightEnabled() != larp.CerenkovLightEnabled()) ||
+      (snapshot.ExtraMatProperties() != larp.ExtraMatProperties()) ||
+      (snapshot.TpbTimeConstant() != larp.TpbTimeConstant())) {
+    mf::LogError("detp_test") << "Snapshot scintillation properties differ from the provider";
+    ++nErrors;
+  }
+  for (unsigned int gap = 0; gap < snapshot.NPlaneGaps(); ++gap) {
+    if (snapshot.Efield(gap) != detp.Efield(gap)) {
+      mf::LogError("detp_test") << "Snapshot electric field in gap " << gap << ": "
+                                << snapshot.Efield(gap) << " kV/cm, expected "
+                                << detp.Efield(gap);
+      ++nErrors;
+    }
+    double const gapDriftVelocity = detp.DriftVelocity(detp.Efield(gap), detp.Temperature());
+    if (!checkValue.equal(snapshot.GapDriftVelocity(gap), gapDriftVelocity)) {
+      mf::LogError("detp_test") << "Snapshot drift velocity in gap " << gap << ": "
+                                << snapshot.GapDriftVelocity(gap) << " cm/us, expected "
+                                << gapDriftVelocity;
+      ++nErrors;
+    }
+  } // for gaps
+  if (!checkValue.equal(snapshot.GapDriftVelocity(), driftVelocity)) {
+    mf::LogError("detp_test") << "Snapshot drift velocity: " << snapshot.GapDriftVelocity()
+                              << " cm/us, expected " << driftVelocity;
+    ++nErrors;
+  }
+  if (!checkValue.equal(snapshot.ModBoxCorrection(50000.), detp.ModBoxCorrection(50000.))) {
+    mf::LogError("detp_test") << "Snapshot modified box correction: "
+                              << snapshot.ModBoxCorrection(50000.) << " MeV/cm, expected "
+                              << detp.ModBoxCorrection(50000.);
+    ++nErrors;
+  }
+
+  // bulk evaluation must match the single point one
+  {
+    std::vector<double> const efields{0.1, 0.5, 0.65, 1.0, 5.0};
+    std::vector<double> const temperatures{87.0, 89.0, 89.0, 0.0, 100.0};
+    std::vector<double> velocities, densities;
+    auto const vdReport = detp.DriftVelocities(efields, temperatures, velocities);
+    auto const rhoReport = detp.Densities(temperatures, densities);
+    for (std::size_t i = 0; i < efields.size(); ++i) {
+      double const expected = detp.DriftVelocity(efields[i], temperatures[i]);
+      if (!checkValue.equal(velocities[i], expected)) {
+        mf::LogError("detp_test") << "Bulk drift velocity at " << efields[i] << " kV/cm, "
+                                  << temperatures[i] << " K: " << velocities[i]
+                                  << " cm/us, expected " << expected;
+        ++nErrors;
+      }
+      if (!checkValue.equal(densities[i], detp.Density(temperatures[i]))) {
+        mf::LogError("detp_test") << "Bulk density at " << temperatures[i]
+                                  << " K: " << densities[i] << " g/cm^3, expected "
+                                  << detp.Density(temperatures[i]);
+        ++nErrors;
+      }
+    } // for
+    if (vdReport.nHighEfield != 1 || vdReport.nBadTemperature != 1 ||
+        rhoReport.nBadTemperature != 1) {
+      mf::LogError("detp_test") << "Bulk evaluation reported " << vdReport.nHighEfield
+                                << " high fields and " << vdReport.nBadTemperature << " ("
+                                << rhoReport.nBadTemperature
+                                << ") bad temperatures, expected 1 each";
+      ++nErrors;
+    }
+  }
+
+  // the per-TPC drift parameters must match the tick conversion
+  auto const detProp = detp.DataFor(clock_data);
+  if (!detProp.HasDriftParameters()) {
+    mf::LogError("detp_test") << "No per-TPC drift parameters available";
+    ++nErrors;
+  }
+  else {
+    for (auto const& TPC : geom.IterateTPCs()) {
+      auto const& tpcid = TPC.ID();
+      auto const& params = detProp.DriftParameters(tpcid);
+      if (params.NPlanes() != TPC.Nplanes()) {
+        mf::LogError("detp_test") << tpcid << ": drift parameters for " << params.NPlanes()
+                                  << " planes, expected " << TPC.Nplanes();
+        ++nErrors;
+      }
+      double const coefficient = params.driftDirection * params.xTicksCoefficient;
+      if (!checkValue.equal(coefficient, detProp.GetXTicksCoefficient(tpcid.TPC, tpcid.Cryostat))) {
+        mf::LogError("detp_test") << tpcid << ": drift coefficient " << coefficient
+                                  << " cm/tick, expected "
+                                  << detProp.GetXTicksCoefficient(tpcid.TPC, tpcid.Cryostat);
+        ++nErrors;
+      }
+    } // for TPC
+  }
+
+  // a provider with no geometry, given the plane layout, gives the same result
+  {
+    std::set<std::string> const ignore_keys({"InheritNumberTimeSamples"});
+    detinfo::DetectorPropertiesStandard const noGeoDetp{
+      TestEnv.ServiceParameters("DetectorPropertiesService"),
+      detinfo::PlaneLayout::FromGeometry(geom),
+      &larp,
+      ignore_keys};
+    auto const noGeoDetProp = noGeoDetp.DataFor(clock_data);
+    for (auto const& planeID : geom.IteratePlaneIDs()) {
+      if (noGeoDetProp.GetXTicksOffset(planeID) != detProp.GetXTicksOffset(planeID)) {
+        mf::LogError("detp_test") << planeID << ": tick offset without geometry "
+                                  << noGeoDetProp.GetXTicksOffset(planeID) << ", expected "
+                                  << detProp.GetXTicksOffset(planeID);
+        ++nErrors;
+      }
+    } // for planes
+
+    // a view in the layout without time offset is a configuration error
+    detinfo::PlaneLayout badLayout;
+    badLayout.AddCryostat();
+    badLayout.AddTPC(1.0, 0.0, {{geo::kU, 0.5}, {geo::kV, 0.5}, {geo::kX, 0.0}});
+    try {
+      detinfo::DetectorPropertiesStandard const badDetp{
+        TestEnv.ServiceParameters("DetectorPropertiesService"),
+        std::move(badLayout),
+        &larp,
+        ignore_keys};
+      mf::LogError("detp_test") << "Missing time offset for view X not detected";
+      ++nErrors;
+    }
+    catch (cet::exception const&) {
+    }
+  }
+
   // 4. And finally we cross fingers.
   if (nErrors > 0) { mf::LogError("detp_test") << nErrors << " errors detected!"; }
 
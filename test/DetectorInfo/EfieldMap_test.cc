@@ -0,0 +1,144 @@
+/**
+ * @file   EfieldMap_test.cc
+ * @brief  Test of the electric field map.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/EfieldMap.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( EfieldMap_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/EfieldMap.h"
+
+// C/C++ standard libraries
+#include <iterator> // std::back_inserter()
+#include <stdexcept> // std::domain_error, std::logic_error
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+struct TestPoint_t {
+  double x, y, z;
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+}; // TestPoint_t
+
+
+/// A field linear in all coordinates, which trilinear interpolation reproduces.
+double linearField(double x, double y, double z)
+  { return 0.5 + 0.01 * x - 0.002 * y + 0.003 * z; }
+
+
+detinfo::EfieldMap makeLinearMap() {
+  detinfo::EfieldMap::Grid_t const grid {
+    { -10.0, 0.0, 5.0 }, // origin
+    { 5.0, 10.0, 2.5 }, // step
+    { 5U, 3U, 9U } // points
+  };
+  std::vector<double> efields(grid.size());
+  for (std::size_t ix = 0; ix < grid.nPoints[0]; ++ix) {
+    for (std::size_t iy = 0; iy < grid.nPoints[1]; ++iy) {
+      for (std::size_t iz = 0; iz < grid.nPoints[2]; ++iz) {
+        efields[grid.index(ix, iy, iz)] = linearField(
+          grid.origin[0] + ix * grid.step[0],
+          grid.origin[1] + iy * grid.step[1],
+          grid.origin[2] + iz * grid.step[2]
+          );
+      }
+    }
+  }
+  return { grid, std::move(efields) };
+} // makeLinearMap()
+
+
+//------------------------------------------------------------------------------
+void InterpolationTest() {
+
+  detinfo::EfieldMap const map = makeLinearMap();
+
+  // grid points and points inside the voxels
+  BOOST_CHECK_CLOSE(map.Efield(-10.0, 0.0, 5.0), linearField(-10.0, 0.0, 5.0), 1e-9);
+  BOOST_CHECK_CLOSE(map.Efield(10.0, 20.0, 25.0), linearField(10.0, 20.0, 25.0), 1e-9);
+  BOOST_CHECK_CLOSE(map.Efield(-3.3, 14.2, 11.1), linearField(-3.3, 14.2, 11.1), 1e-9);
+  BOOST_CHECK_CLOSE(map.Efield(TestPoint_t{ 7.9, 0.1, 24.9 }),
+                    linearField(7.9, 0.1, 24.9), 1e-9);
+
+  // outside the grid, the closest boundary value is used
+  BOOST_CHECK_CLOSE(map.Efield(-50.0, 14.2, 11.1), linearField(-10.0, 14.2, 11.1), 1e-9);
+  BOOST_CHECK_CLOSE(map.Efield(3.0, 40.0, -5.0), linearField(3.0, 20.0, 5.0), 1e-9);
+
+  // batch query
+  std::vector<TestPoint_t> const points
+    { { -3.3, 14.2, 11.1 }, { 0.0, 0.0, 0.0 }, { 9.5, 19.5, 24.5 } };
+  std::vector<double> efields(points.size());
+  auto const last = map.Efields(points.begin(), points.end(), efields.begin());
+  BOOST_CHECK(last == efields.end());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    BOOST_CHECK_EQUAL(efields[i], map.Efield(points[i]));
+
+} // InterpolationTest()
+
+
+//------------------------------------------------------------------------------
+void DriftVelocityTest() {
+
+  detinfo::EfieldMap map = makeLinearMap();
+  BOOST_CHECK(!map.HasDriftVelocities());
+  BOOST_CHECK_THROW(map.DriftVelocity(0.0, 0.0, 0.0), std::logic_error);
+
+  unsigned int nCalls = 0U;
+  map.BuildDriftVelocities
+    ([&nCalls](double efield){ ++nCalls; return 0.3 * efield; });
+  BOOST_CHECK(map.HasDriftVelocities());
+  BOOST_CHECK_EQUAL(nCalls, map.Grid().size());
+
+  // the velocity is linear in the field, so it is interpolated in the same way
+  BOOST_CHECK_CLOSE(map.DriftVelocity(-3.3, 14.2, 11.1),
+                    0.3 * linearField(-3.3, 14.2, 11.1), 1e-9);
+
+  std::vector<TestPoint_t> const points { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } };
+  std::vector<double> velocities;
+  map.DriftVelocities(points.begin(), points.end(), std::back_inserter(velocities));
+  BOOST_CHECK_EQUAL(velocities.size(), points.size());
+  BOOST_CHECK_EQUAL(velocities[1], map.DriftVelocity(points[1]));
+
+} // DriftVelocityTest()
+
+
+//------------------------------------------------------------------------------
+void InvalidGridTest() {
+
+  detinfo::EfieldMap::Grid_t grid { { 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0 }, { 2U, 2U, 2U } };
+  BOOST_CHECK_THROW(detinfo::EfieldMap(grid, std::vector<double>(7U)), std::domain_error);
+
+  grid.step[1] = 0.0;
+  BOOST_CHECK_THROW(detinfo::EfieldMap(grid, std::vector<double>(8U)), std::domain_error);
+
+  // a single point on an axis makes the field constant along it
+  detinfo::EfieldMap::Grid_t const flat
+    { { 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0 }, { 2U, 1U, 1U } };
+  detinfo::EfieldMap const map { flat, { 0.5, 1.0 } };
+  BOOST_CHECK_CLOSE(map.Efield(0.25, -7.0, 12.0), 0.625, 1e-9);
+
+} // InvalidGridTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InterpolationTestCase) {
+  InterpolationTest();
+}
+
+BOOST_AUTO_TEST_CASE(DriftVelocityTestCase) {
+  DriftVelocityTest();
+}
+
+BOOST_AUTO_TEST_CASE(InvalidGridTestCase) {
+  InvalidGridTest();
+}
+
+//------------------------------------------------------------------------------
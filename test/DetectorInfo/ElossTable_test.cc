@@ -0,0 +1,113 @@
+/**
+ * @file   ElossTable_test.cc
+ * @brief  Test of `detinfo::ElossTable` against the exact formula.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ElossTable.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ElossTable_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/ElossTable.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cmath> // std::abs()
+#include <stdexcept> // std::domain_error
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// liquid argon parameters as in `detectorproperties.fcl` and `larproperties.fcl`
+detinfo::ElossMaterialParameters_t const LArParameters {
+  -0.00615 * 87.0 + 1.928, // density at 87 K [g/cm^3]
+  18.0,                    // atomic number
+  39.948,                  // atomic mass [g/mol]
+  188.0,                   // mean excitation energy [eV]
+  { 0.1956, 3.0000, 0.2000, 3.0000, 5.2146 } // Sternheimer a, k, x0, x1, cbar
+};
+
+
+//------------------------------------------------------------------------------
+void checkTableAccuracy(double mass, double tcut) {
+
+  double const tolerance = 1e-4;
+  detinfo::ElossTable const table { LArParameters, mass, tcut, tolerance };
+
+  BOOST_TEST_MESSAGE("Table for mass=" << mass << " GeV/c^2, tcut=" << tcut
+    << " MeV: " << table.NPoints() << " points, max relative error "
+    << table.MaxRelativeError()
+    );
+
+  BOOST_CHECK_EQUAL(table.Mass(), mass);
+  BOOST_CHECK_EQUAL(table.Tcut(), tcut);
+  BOOST_CHECK_LE(table.MaxRelativeError(), tolerance);
+
+  // scan the full range, also beyond the tabulated one, on a grid which does
+  // not match the table one
+  double const minMom = table.MinBetaGamma() * mass / 2.0;
+  double const maxMom = table.MaxBetaGamma() * mass * 2.0;
+  unsigned int const nSteps = 10007;
+  double const ratio = std::pow(maxMom / minMom, 1.0 / nSteps);
+
+  std::vector<double> momenta;
+  double mom = minMom;
+  for (unsigned int i = 0; i < nSteps; ++i, mom *= ratio) momenta.push_back(mom);
+
+  double maxError = 0.0;
+  for (double const p: momenta) {
+    double const expected = detinfo::RestrictedEloss(LArParameters, p, mass, tcut);
+    double const error = std::abs(table.Eloss(p) - expected) / expected;
+    if (error > maxError) maxError = error;
+    BOOST_CHECK_CLOSE(
+      table.ElossVar(p), detinfo::ElossVariance(LArParameters, p, mass), 1e-8
+      );
+  } // for
+  BOOST_TEST_MESSAGE("  max relative error on the scan: " << maxError);
+  BOOST_CHECK_LE(maxError, tolerance);
+
+  // batch evaluation must match the single value one exactly
+  std::vector<double> dEdx(momenta.size());
+  auto const itEnd = table.Eloss(momenta.begin(), momenta.end(), dEdx.begin());
+  BOOST_CHECK(itEnd == dEdx.end());
+  for (std::size_t i = 0; i < momenta.size(); ++i)
+    BOOST_CHECK_EQUAL(dEdx[i], table.Eloss(momenta[i]));
+
+  std::vector<double> var(momenta.size());
+  table.ElossVar(momenta.begin(), momenta.end(), var.begin());
+  for (std::size_t i = 0; i < momenta.size(); ++i)
+    BOOST_CHECK_EQUAL(var[i], table.ElossVar(momenta[i]));
+
+} // checkTableAccuracy()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ElossTableAccuracy_test) {
+
+  std::array<double, 4U> const masses
+    {{ 0.000510998918, 0.105658, 0.139570, 0.938272 }};
+  for (double const mass: masses) {
+    checkTableAccuracy(mass, 0.0);
+    checkTableAccuracy(mass, 10.0);
+    checkTableAccuracy(mass, 0.1);
+  }
+
+} // BOOST_AUTO_TEST_CASE(ElossTableAccuracy_test)
+
+
+BOOST_AUTO_TEST_CASE(ElossTableErrors_test) {
+
+  BOOST_CHECK_THROW
+    (detinfo::ElossTable(LArParameters, 0.0), std::domain_error);
+  BOOST_CHECK_THROW
+    (detinfo::ElossTable(LArParameters, 0.1, 0.0, 0.0), std::domain_error);
+  BOOST_CHECK_THROW
+    (detinfo::ElossTable(LArParameters, 0.1, 0.0, 1e-4, 10.0, 1.0), std::domain_error);
+
+} // BOOST_AUTO_TEST_CASE(ElossTableErrors_test)
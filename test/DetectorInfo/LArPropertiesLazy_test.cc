@@ -0,0 +1,268 @@
+/**
+ * @file   LArPropertiesLazy_test.cc
+ * @brief  Test of the lazy reading of the optical tables of
+ *         `LArPropertiesStandard`.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/LArPropertiesStandard.h
+ *
+ * A provider configured to read its optical tables lazily is compared with one
+ * reading them at configuration, from a configuration which differs only in
+ * that respect.
+ */
+
+// LArSoft libraries
+#include "larcorealg/TestUtils/unit_test_base.h"
+#include "lardataalg/DetectorInfo/BinaryBlob.h"
+#include "lardataalg/DetectorInfo/LArPropertiesStandard.h"
+
+// framework libraries
+#include "cetlib/filepath_maker.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "fhiclcpp/make_ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <cstdlib> // std::strtoul()
+#include <functional> // std::function
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility> // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using TestEnvironment = testing::TesterEnvironment<testing::BasicEnvironmentConfiguration>;
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// All the optical tables of a provider, as returned by its accessors.
+  struct OpticalTables_t {
+    std::map<double, double> slowScint;
+    std::map<double, double> fastScint;
+    std::map<double, double> rIndex;
+    std::map<double, double> absLength;
+    std::map<double, double> rayleigh;
+    std::map<std::string, std::map<double, double>> reflectances;
+    std::map<std::string, std::map<double, double>> diffuseFractions;
+    std::map<double, double> tpbAbs;
+    std::map<double, double> tpbEm;
+  }; // OpticalTables_t
+
+  /// Accessors of the optical tables, each filling its own table.
+  using TableAccessor_t =
+    std::function<void(detinfo::LArPropertiesStandard const&, OpticalTables_t&)>;
+
+  std::vector<std::pair<std::string, TableAccessor_t>> const TableAccessors{
+    {"SlowScintSpectrum", [](auto const& p, auto& t) { t.slowScint = p.SlowScintSpectrum(); }},
+    {"FastScintSpectrum", [](auto const& p, auto& t) { t.fastScint = p.FastScintSpectrum(); }},
+    {"RIndexSpectrum", [](auto const& p, auto& t) { t.rIndex = p.RIndexSpectrum(); }},
+    {"AbsLengthSpectrum", [](auto const& p, auto& t) { t.absLength = p.AbsLengthSpectrum(); }},
+    {"RayleighSpectrum", [](auto const& p, auto& t) { t.rayleigh = p.RayleighSpectrum(); }},
+    {"SurfaceReflectances",
+     [](auto const& p, auto& t) { t.reflectances = p.SurfaceReflectances(); }},
+    {"SurfaceReflectanceDiffuseFractions",
+     [](auto const& p, auto& t) { t.diffuseFractions = p.SurfaceReflectanceDiffuseFractions(); }},
+    {"TpbAbs", [](auto const& p, auto& t) { t.tpbAbs = p.TpbAbs(); }},
+    {"TpbEm", [](auto const& p, auto& t) { t.tpbEm = p.TpbEm(); }},
+  };
+
+  /// Returns all the optical tables of `larProp`.
+  OpticalTables_t readTables(detinfo::LArPropertiesStandard const& larProp)
+  {
+    OpticalTables_t tables;
+    for (auto const& accessor : TableAccessors)
+      accessor.second(larProp, tables);
+    return tables;
+  } // readTables()
+
+  /// Returns the full saved state of `larProp`.
+  std::vector<char> savedState(detinfo::LArPropertiesStandard const& larProp)
+  {
+    detinfo::BlobWriter out;
+    larProp.SaveState(out);
+    return out.data();
+  } // savedState()
+
+  /// Compares each of the `tables` with the `expected` ones; returns errors.
+  unsigned int compareTables(OpticalTables_t const& tables,
+                             OpticalTables_t const& expected,
+                             std::string const& what)
+  {
+    unsigned int nErrors = 0;
+    auto const check = [&nErrors, &what](bool same, char const* name) {
+      if (same) return;
+      mf::LogError("larp_lazy_test") << what << ": table " << name << " differs";
+      ++nErrors;
+    };
+    check(tables.slowScint == expected.slowScint, "SlowScintSpectrum");
+    check(tables.fastScint == expected.fastScint, "FastScintSpectrum");
+    check(tables.rIndex == expected.rIndex, "RIndexSpectrum");
+    check(tables.absLength == expected.absLength, "AbsLengthSpectrum");
+    check(tables.rayleigh == expected.rayleigh, "RayleighSpectrum");
+    check(tables.reflectances == expected.reflectances, "SurfaceReflectances");
+    check(tables.diffuseFractions == expected.diffuseFractions,
+          "SurfaceReflectanceDiffuseFractions");
+    check(tables.tpbAbs == expected.tpbAbs, "TpbAbs");
+    check(tables.tpbEm == expected.tpbEm, "TpbEm");
+    return nErrors;
+  } // compareTables()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("LArPropertiesLazy_test")
+ * 1. (mandatory) path to the FHiCL configuration file with lazy optical tables
+ * 2. (mandatory) path to the FHiCL configuration file with the same
+ *    configuration, but optical tables read at configuration
+ * 3. number of threads for the concurrent access test (default: 8)
+ *
+ */
+//------------------------------------------------------------------------------
+int
+main(int argc, char const** argv)
+{
+
+  testing::BasicEnvironmentConfiguration config("larp_lazy_test");
+
+  //
+  // parameter parsing
+  //
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    config.SetConfigurationPath(argv[iParam]);
+  else {
+    std::cerr << "FHiCL configuration file path required as first argument!" << std::endl;
+    return 1;
+  }
+
+  // second argument: reference configuration file (mandatory)
+  if (++iParam >= argc) {
+    std::cerr << "Reference FHiCL configuration file path required as second argument!"
+              << std::endl;
+    return 1;
+  }
+  std::string const referencePath = argv[iParam];
+
+  // third argument: number of threads
+  unsigned int nThreads = 8U;
+  if (++iParam < argc) nThreads = std::max(2UL, std::strtoul(argv[iParam], nullptr, 10));
+
+  unsigned int nErrors = 0;
+
+  //
+  // testing environment setup
+  //
+  TestEnvironment TestEnv(config);
+  fhicl::ParameterSet const lazyConfig = TestEnv.ServiceParameters("LArPropertiesService");
+
+  cet::filepath_lookup policy{"FHICL_FILE_PATH"};
+  fhicl::ParameterSet referencePSet;
+  fhicl::make_ParameterSet(referencePath, policy, referencePSet);
+  auto const eagerConfig =
+    referencePSet.get<fhicl::ParameterSet>("services.LArPropertiesService");
+
+  if (!lazyConfig.get<bool>("LazyOpticalTables", false)) {
+    mf::LogError("larp_lazy_test") << "Configuration '" << argv[1]
+                                   << "' does not request lazy optical tables.";
+    return 1;
+  }
+
+  detinfo::LArPropertiesStandard const eager{eagerConfig};
+  if (eager.OpticalTablesPending()) {
+    mf::LogError("larp_lazy_test") << "Optical tables pending without lazy configuration.";
+    ++nErrors;
+  }
+  OpticalTables_t const expected = readTables(eager);
+  std::vector<char> const expectedState = savedState(eager);
+
+  //
+  // single thread: tables are pending until the first access
+  //
+  {
+    detinfo::LArPropertiesStandard const lazy{lazyConfig};
+    if (!lazy.OpticalTablesPending()) {
+      mf::LogError("larp_lazy_test") << "Optical tables not pending before the first access.";
+      ++nErrors;
+    }
+
+    // scalar properties do not trigger the reading
+    if (lazy.AtomicNumber() != eager.AtomicNumber()) {
+      mf::LogError("larp_lazy_test") << "Atomic number: " << lazy.AtomicNumber() << ", expected "
+                                     << eager.AtomicNumber();
+      ++nErrors;
+    }
+    if (!lazy.OpticalTablesPending()) {
+      mf::LogError("larp_lazy_test") << "Optical tables read by a scalar accessor.";
+      ++nErrors;
+    }
+
+    nErrors += compareTables(readTables(lazy), expected, "single thread");
+    if (lazy.OpticalTablesPending()) {
+      mf::LogError("larp_lazy_test") << "Optical tables still pending after access.";
+      ++nErrors;
+    }
+    if (savedState(lazy) != expectedState) {
+      mf::LogError("larp_lazy_test") << "Single thread: saved state differs";
+      ++nErrors;
+    }
+  }
+
+  //
+  // first access from many threads at once, each through a different accessor
+  //
+  {
+    detinfo::LArPropertiesStandard const lazy{lazyConfig};
+
+    std::vector<OpticalTables_t> tables(nThreads);
+    std::atomic<unsigned int> nReady{0U};
+    auto const access = [&](unsigned int iThread) {
+      // wait for all threads to be started, to maximize the contention
+      ++nReady;
+      while (nReady.load() < nThreads) {}
+      std::size_t const first = iThread % TableAccessors.size();
+      for (std::size_t i = 0; i < TableAccessors.size(); ++i)
+        TableAccessors[(first + i) % TableAccessors.size()].second(lazy, tables[iThread]);
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int iThread = 0; iThread < nThreads; ++iThread)
+      threads.emplace_back(access, iThread);
+    for (auto& thread : threads)
+      thread.join();
+
+    for (unsigned int iThread = 0; iThread < nThreads; ++iThread)
+      nErrors += compareTables(tables[iThread], expected, "thread #" + std::to_string(iThread));
+    if (lazy.OpticalTablesPending()) {
+      mf::LogError("larp_lazy_test") << "Optical tables still pending after concurrent access.";
+      ++nErrors;
+    }
+    if (savedState(lazy) != expectedState) {
+      mf::LogError("larp_lazy_test") << "Concurrent access: saved state differs";
+      ++nErrors;
+    }
+  }
+
+  if (nErrors > 0) { mf::LogError("larp_lazy_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
@@ -102,6 +102,12 @@ int main(int argc, char const** argv) {
     << TestEnv.Provider<detinfo::LArProperties>()->AtomicNumber()
     ;
 
+  // this also triggers the reading of the optical tables, if delayed
+  mf::LogInfo("larp_test")
+    << "The fast scintillation spectrum has "
+    << TestEnv.Provider<detinfo::LArProperties>()->FastScintSpectrum().size()
+    << " points";
+
   // 4. And finally we cross fingers.
   if (nErrors > 0) {
     mf::LogError("larp_test") << nErrors << " errors detected!";
@@ -0,0 +1,159 @@
+/**
+ * @file   LifetimeCorrection_test.cc
+ * @brief  Test of `detinfo::LifetimeCorrection`.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/LifetimeCorrection.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( LifetimeCorrection_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/LifetimeCorrection.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::exp()
+#include <stdexcept> // std::logic_error
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+/// Detector properties with only an electron lifetime.
+class LifetimeProperties: public detinfo::DetectorProperties {
+    public:
+  explicit LifetimeProperties(double lifetime): fLifetime(lifetime) {}
+
+  double ElectronLifetime() const override { return fLifetime; }
+
+  double Efield(unsigned int = 0) const override { return 0.5; }
+  double DriftVelocity(double = 0., double = 0.) const override { return 0.16; }
+  double BirksCorrection(double) const override { return 0.0; }
+  double BirksCorrection(double, double) const override { return 0.0; }
+  double ModBoxCorrection(double) const override { return 0.0; }
+  double ModBoxCorrection(double, double) const override { return 0.0; }
+  double Density(double) const override { return 1.39; }
+  double Temperature() const override { return 87.0; }
+  double Eloss(double, double, double) const override { return 0.0; }
+  double ElossVar(double, double) const override { return 0.0; }
+  double ElectronsToADC() const override { return 0.0; }
+  unsigned int NumberTimeSamples() const override { return 6400U; }
+  unsigned int ReadOutWindowSize() const override { return 6400U; }
+  double TimeOffsetU() const override { return 0.0; }
+  double TimeOffsetV() const override { return 0.0; }
+  double TimeOffsetZ() const override { return 0.0; }
+  bool SimpleBoundary() const override { return true; }
+  detinfo::DetectorPropertiesData DataFor
+    (detinfo::DetectorClocksData const&) const override
+    { throw std::logic_error("LifetimeProperties::DataFor() not supported"); }
+
+    private:
+  double fLifetime;
+}; // class LifetimeProperties
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LifetimeCorrection_test) {
+
+  double const lifetime = 3000.0; // us
+  double const tickPeriod = 0.5; // us
+
+  // TPC readout starts 1600 us (3200 ticks) before the trigger
+  detinfo::DetectorClocksData const clockData{
+    -3200.0, -1600.0, 3200.0, 3200.0,
+    detinfo::ElecClock{3200.0, 1600.0, 1.0 / tickPeriod},
+    detinfo::ElecClock{3200.0, 1600.0, 64.0},
+    detinfo::ElecClock{3200.0, 1600.0, 16.0},
+    detinfo::ElecClock{0.0, 1600.0, 31.25}
+  };
+  double const triggerTick = 3200.0;
+
+  // one TPC with planes far from x = 0, whose x = 0 tick is before the trigger
+  LifetimeProperties const properties { lifetime };
+  geo::PlaneID const planeID { 0, 0, 2 };
+  detinfo::DetectorPropertiesData const detProp{
+    properties, 0.08,
+    { { { 2560.0, 2564.0, 2568.0 } } }, // x ticks offsets (x = 50 cm away)
+    { { -1.0 } }                         // drift direction
+  };
+  BOOST_CHECK_NE(detProp.GetXTicksOffset(planeID), triggerTick);
+
+  detinfo::LifetimeCorrection const correction { clockData, detProp };
+  BOOST_CHECK_EQUAL(correction.ZeroDriftTick(), triggerTick);
+  BOOST_CHECK_EQUAL(correction.TickPeriod(), tickPeriod);
+  BOOST_CHECK_EQUAL(correction.Lifetime(), lifetime);
+
+  // a hit 2000 ticks (1000 us) after the trigger
+  double const tick = 5200.0;
+  double const driftTime = 1000.0; // us
+  BOOST_CHECK_CLOSE(correction.DriftTime(tick), driftTime, 1e-10);
+  BOOST_CHECK_CLOSE
+    (correction.Factor(tick), std::exp(driftTime / lifetime), 1e-10);
+  BOOST_CHECK_CLOSE
+    (correction.Correct(200.0, tick), 200.0 * std::exp(driftTime / lifetime), 1e-10);
+  BOOST_CHECK_EQUAL(correction.Factor(triggerTick), 1.0);
+
+  // sequences
+  std::vector<double> ticks, charges;
+  for (unsigned int i = 0; i < 100; ++i) {
+    ticks.push_back(triggerTick + 30.0 * i);
+    charges.push_back(100.0 + i);
+  }
+  std::vector<double> factors(ticks.size()), corrected(ticks.size());
+  auto it = correction.Factors(ticks.cbegin(), ticks.cend(), factors.begin());
+  BOOST_CHECK(it == factors.end());
+  it = correction.Correct
+    (ticks.cbegin(), ticks.cend(), charges.cbegin(), corrected.begin());
+  BOOST_CHECK(it == corrected.end());
+  for (std::size_t i = 0; i < ticks.size(); ++i) {
+    double const expected = std::exp(30.0 * i * tickPeriod / lifetime);
+    BOOST_CHECK_CLOSE(factors[i], expected, 1e-10);
+    BOOST_CHECK_CLOSE(corrected[i], charges[i] * expected, 1e-10);
+  }
+
+} // BOOST_AUTO_TEST_CASE(LifetimeCorrection_test)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LifetimeCorrectionSequence_test) {
+
+  // the full drift of a long readout window, in contiguous buffers
+  detinfo::LifetimeCorrection const correction { 3200.0, 0.5, 3000.0 };
+
+  std::size_t const nHits = 1027; // not a multiple of any vector width
+  std::vector<double> ticks(nHits), charges(nHits);
+  for (std::size_t i = 0; i < nHits; ++i) {
+    ticks[i] = 3200.0 + 6.2 * i;
+    charges[i] = 100.0 + 0.5 * i;
+  }
+
+  std::vector<double> factors(nHits), corrected(nHits);
+  double* itF = correction.Factors
+    (ticks.data(), ticks.data() + nHits, factors.data());
+  BOOST_CHECK(itF == factors.data() + nHits);
+  double* itQ = correction.Correct
+    (ticks.data(), ticks.data() + nHits, charges.data(), corrected.data());
+  BOOST_CHECK(itQ == corrected.data() + nHits);
+
+  for (std::size_t i = 0; i < nHits; ++i) {
+    BOOST_CHECK_EQUAL(factors[i], correction.Factor(ticks[i]));
+    BOOST_CHECK_EQUAL(corrected[i], correction.Correct(charges[i], ticks[i]));
+  }
+
+  // in place
+  correction.Correct
+    (ticks.data(), ticks.data() + nHits, charges.data(), charges.data());
+  for (std::size_t i = 0; i < nHits; ++i)
+    BOOST_CHECK_EQUAL(charges[i], corrected[i]);
+
+} // BOOST_AUTO_TEST_CASE(LifetimeCorrectionSequence_test)
+
+
+//------------------------------------------------------------------------------
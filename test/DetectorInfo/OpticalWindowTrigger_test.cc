@@ -0,0 +1,187 @@
+/**
+ * @file   OpticalWindowTrigger_test.cc
+ * @brief  Test of the sliding window count of optical discriminator ticks.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/OpticalWindowTrigger.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( OpticalWindowTrigger_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/OpticalWindowTrigger.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorTimings.h"
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::domain_error
+#include <thread>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+using optical_tick = detinfo::timescales::optical_tick;
+using TickList_t = detinfo::OpticalWindowTrigger::TickList_t;
+
+/// Returns a pseudo-random set of channels with ticks in `[ -5, 205 [`.
+std::vector<TickList_t> makeChannels(std::size_t nChannels) {
+  std::vector<TickList_t> channels(nChannels);
+  unsigned int seed = 12345U;
+  for (TickList_t& ticks: channels) {
+    for (int i = 0; i < 30; ++i) {
+      seed = seed * 1103515245U + 12345U;
+      ticks.push_back(optical_tick{ static_cast<int>((seed >> 8) % 210U) - 5 });
+    }
+  }
+  return channels;
+} // makeChannels()
+
+
+//------------------------------------------------------------------------------
+void MultiplicityTest() {
+
+  std::vector<TickList_t> const channels = makeChannels(40U);
+
+  detinfo::OpticalWindowTrigger trigger
+    { optical_tick{ 0 }, optical_tick{ 200 }, { 1U, 7U, 200U } };
+  BOOST_CHECK_EQUAL(trigger.nTicks(), 200U);
+  trigger.addChannels(channels);
+
+  // brute force count of the ticks in each window
+  std::size_t nOutside = 0U;
+  for (TickList_t const& ticks: channels)
+    for (optical_tick tick: ticks) if ((tick.value() < 0) || (tick.value() >= 200)) ++nOutside;
+  BOOST_CHECK_EQUAL(trigger.nOutside(), nOutside);
+
+  auto const windows = trigger.multiplicities();
+  BOOST_REQUIRE_EQUAL(windows.size(), 3U);
+  for (auto const& width: windows) {
+    BOOST_REQUIRE_EQUAL(width.counts.size(), 200U - width.width + 1U);
+    for (std::size_t window = 0; window < width.counts.size(); ++window) {
+      std::ptrdiff_t const start = width.startTick(window).value();
+      unsigned int expected = 0U;
+      for (TickList_t const& ticks: channels) {
+        for (optical_tick tick: ticks) {
+          if ((tick.value() >= start)
+            && (tick.value() < start + static_cast<std::ptrdiff_t>(width.width))
+            )
+            ++expected;
+        }
+      } // for channels
+      BOOST_CHECK_EQUAL(width.counts[window], expected);
+    } // for windows
+  } // for widths
+  BOOST_CHECK_EQUAL(windows[2].counts[0], 40U * 30U - nOutside);
+
+  // the same result splitting channels among threads, one accumulator each
+  detinfo::OpticalWindowTrigger parallel
+    { optical_tick{ 0 }, optical_tick{ 200 }, { 1U, 7U, 200U } };
+  constexpr std::size_t nThreads = 4U;
+  std::vector<detinfo::OpticalWindowTrigger::Accumulator> accumulators
+    (nThreads, parallel.makeAccumulator());
+  std::vector<std::thread> threads;
+  for (std::size_t iThread = 0; iThread < nThreads; ++iThread) {
+    threads.emplace_back([&channels, &accumulator=accumulators[iThread], iThread]()
+      {
+        for (std::size_t ch = iThread; ch < channels.size(); ch += nThreads)
+          accumulator.addChannel(channels[ch]);
+      });
+  } // for threads
+  for (std::thread& thread: threads) thread.join();
+  for (auto const& accumulator: accumulators) parallel.add(accumulator);
+  BOOST_CHECK_EQUAL(parallel.nOutside(), nOutside);
+  auto const parallelWindows = parallel.multiplicities();
+  for (std::size_t iWidth = 0; iWidth < windows.size(); ++iWidth)
+    BOOST_CHECK(parallelWindows[iWidth].counts == windows[iWidth].counts);
+
+  trigger.reset();
+  BOOST_CHECK_EQUAL(trigger.nOutside(), 0U);
+  BOOST_CHECK_EQUAL(trigger.multiplicities()[2].counts[0], 0U);
+
+} // MultiplicityTest()
+
+
+//------------------------------------------------------------------------------
+void TriggerTest() {
+
+  using namespace detinfo::timescales;
+
+  // optical clock of 500 MHz: 2 ns per tick
+  detinfo::ElecClock const clock { 0.0, 1600.0, 500.0 };
+  detinfo::DetectorClocksData const clockData
+    { 0.0, 0.0, 0.0, 0.0, clock, clock, clock, clock };
+  detinfo::DetectorTimings const timings { clockData };
+
+  detinfo::OpticalWindowTrigger trigger
+    { optical_tick{ 100 }, optical_tick{ 200 }, { 3U } };
+
+  // ticks 110, 111, 112 and 150, 152 from times
+  std::vector<optical_time> const times { optical_time{ 0.220 },
+    optical_time{ 0.222 }, optical_time{ 0.2245 }, optical_time{ 0.300 },
+    optical_time{ 0.3041 } };
+  TickList_t const ticks
+    = detinfo::OpticalWindowTrigger::opticalTicks(timings, times);
+  BOOST_REQUIRE_EQUAL(ticks.size(), times.size());
+  BOOST_CHECK_EQUAL(ticks[2].value(), 112);
+
+  auto accumulator = trigger.makeAccumulator();
+  accumulator.addChannel(ticks);
+  accumulator.addChannel({ optical_tick{ 199 }, optical_tick{ 200 } });
+  BOOST_CHECK_EQUAL(accumulator.nOutside(), 1U);
+  trigger.add(accumulator);
+
+  auto const windows = trigger.multiplicities();
+  BOOST_CHECK_EQUAL(windows[0].counts[10], 3U); // window [ 110, 113 [
+
+  std::vector<optical_tick> const triggers
+    = detinfo::OpticalWindowTrigger::triggerTicks(windows[0], 2U);
+  BOOST_REQUIRE_EQUAL(triggers.size(), 2U);
+  BOOST_CHECK_EQUAL(triggers[0].value(), 109);
+  BOOST_CHECK_EQUAL(triggers[1].value(), 150);
+
+} // TriggerTest()
+
+
+//------------------------------------------------------------------------------
+void InvalidInputTest() {
+
+  BOOST_CHECK_THROW(
+    detinfo::OpticalWindowTrigger(optical_tick{ 10 }, optical_tick{ 10 }, { 1U }),
+    std::domain_error
+    );
+  BOOST_CHECK_THROW(
+    detinfo::OpticalWindowTrigger(optical_tick{ 0 }, optical_tick{ 10 }, { 0U }),
+    std::domain_error
+    );
+  BOOST_CHECK_THROW(
+    detinfo::OpticalWindowTrigger(optical_tick{ 0 }, optical_tick{ 10 }, { 11U }),
+    std::domain_error
+    );
+
+  detinfo::OpticalWindowTrigger trigger
+    { optical_tick{ 0 }, optical_tick{ 10 }, { 2U } };
+  detinfo::OpticalWindowTrigger other
+    { optical_tick{ 0 }, optical_tick{ 20 }, { 2U } };
+  BOOST_CHECK_THROW(trigger.add(other.makeAccumulator()), std::domain_error);
+
+} // InvalidInputTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MultiplicityTestCase) {
+  MultiplicityTest();
+}
+
+BOOST_AUTO_TEST_CASE(TriggerTestCase) {
+  TriggerTest();
+}
+
+BOOST_AUTO_TEST_CASE(InvalidInputTestCase) {
+  InvalidInputTest();
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,139 @@
+/**
+ * @file   PlaneLayout_test.cc
+ * @brief  Test of the description of the wire planes.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/PlaneLayout.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( PlaneLayout_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/PlaneLayout.h"
+
+// C/C++ standard libraries
+#include <set>
+#include <sstream>
+#include <stdexcept> // std::domain_error, std::logic_error
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+/// Two cryostats: one with two TPCs of three planes, one with a two-plane TPC.
+detinfo::PlaneLayout makeLayout() {
+  using Plane_t = detinfo::PlaneLayout::Plane_t;
+  detinfo::PlaneLayout layout;
+  layout.AddCryostat();
+  layout.AddTPC(+1.0, -0.6,
+    { Plane_t{ geo::kU, 0.3 }, Plane_t{ geo::kV, 0.3 }, Plane_t{ geo::kZ } });
+  layout.AddTPC(-1.0, 0.6 + 1.0 / 3.0,
+    { Plane_t{ geo::kU, 0.25 }, Plane_t{ geo::kV, 0.35 }, Plane_t{ geo::kZ, 7.0 } });
+  layout.AddCryostat();
+  layout.AddTPC(+1.0, -0.4, { Plane_t{ geo::kY, 0.4 }, Plane_t{ geo::kZ } });
+  return layout;
+} // makeLayout()
+
+
+//------------------------------------------------------------------------------
+void LayoutTest() {
+
+  detinfo::PlaneLayout const layout = makeLayout();
+
+  BOOST_CHECK_EQUAL(layout.NCryostats(), 2U);
+  BOOST_CHECK_EQUAL(layout.NTPCs(0), 2U);
+  BOOST_CHECK_EQUAL(layout.NTPCs(1), 1U);
+  BOOST_CHECK_EQUAL(layout.NTPCs(2), 0U);
+  BOOST_CHECK_EQUAL(layout.TPCs().size(), 3U);
+  BOOST_CHECK_EQUAL(layout.Planes().size(), 8U);
+
+  auto const& tpc = layout.TPC(0, 1);
+  BOOST_CHECK_EQUAL(tpc.driftDirection, -1.0);
+  BOOST_CHECK_EQUAL(tpc.firstPlane, 3U);
+  BOOST_CHECK_EQUAL(tpc.nPlanes, 3U);
+  auto const* planes = layout.Planes(tpc);
+  BOOST_CHECK_EQUAL(planes[0].view, geo::kU);
+  BOOST_CHECK_EQUAL(planes[1].pitch, 0.35);
+  BOOST_CHECK_EQUAL(planes[2].pitch, 0.0); // the last plane has no pitch
+
+  BOOST_CHECK_EQUAL(layout.TPC(1, 0).firstPlaneX, -0.4);
+  BOOST_CHECK((layout.Views() == std::set<geo::View_t>{ geo::kU, geo::kV, geo::kZ, geo::kY }));
+
+} // LayoutTest()
+
+
+//------------------------------------------------------------------------------
+void TextFormatTest() {
+
+  detinfo::PlaneLayout const layout = makeLayout();
+
+  std::ostringstream out;
+  layout.Write(out);
+  std::istringstream in { out.str() };
+  detinfo::PlaneLayout const read = detinfo::PlaneLayout::Read(in);
+
+  BOOST_CHECK_EQUAL(read.NCryostats(), layout.NCryostats());
+  BOOST_REQUIRE_EQUAL(read.TPCs().size(), layout.TPCs().size());
+  for (std::size_t i = 0; i < layout.TPCs().size(); ++i) {
+    BOOST_CHECK_EQUAL(read.TPCs()[i].driftDirection, layout.TPCs()[i].driftDirection);
+    BOOST_CHECK_EQUAL(read.TPCs()[i].firstPlaneX, layout.TPCs()[i].firstPlaneX); // exact
+    BOOST_CHECK_EQUAL(read.TPCs()[i].firstPlane, layout.TPCs()[i].firstPlane);
+    BOOST_CHECK_EQUAL(read.TPCs()[i].nPlanes, layout.TPCs()[i].nPlanes);
+  }
+  BOOST_REQUIRE_EQUAL(read.Planes().size(), layout.Planes().size());
+  for (std::size_t i = 0; i < layout.Planes().size(); ++i) {
+    BOOST_CHECK_EQUAL(read.Planes()[i].view, layout.Planes()[i].view);
+    BOOST_CHECK_EQUAL(read.Planes()[i].pitch, layout.Planes()[i].pitch);
+  }
+
+  // comments and empty lines are ignored
+  std::istringstream commented { "# a comment\n\n0 0 1 -0.6 2 0 2 0.3 # U, Z\n" };
+  auto const small = detinfo::PlaneLayout::Read(commented);
+  BOOST_CHECK_EQUAL(small.NCryostats(), 1U);
+  BOOST_CHECK_EQUAL(small.Planes().size(), 2U);
+
+} // TextFormatTest()
+
+
+//------------------------------------------------------------------------------
+void InvalidInputTest() {
+
+  detinfo::PlaneLayout layout;
+  BOOST_CHECK_THROW(layout.AddTPC(1.0, 0.0, { { geo::kU } }), std::logic_error);
+  layout.AddCryostat();
+  BOOST_CHECK_THROW(layout.AddTPC(1.0, 0.0, {}), std::domain_error);
+  BOOST_CHECK_THROW
+    (layout.AddTPC(1.0, 0.0, { { geo::kU, -0.3 }, { geo::kZ } }), std::domain_error);
+
+  for (char const* text: {
+    "0 0 1 -0.6 2 0 2\n", // missing pitch
+    "0 0 1 -0.6 2 0 2 0.3 0.4\n", // extra pitch
+    "0 0 1 -0.6 2 0 2 0.3\n0 2 1 -0.6 2 0 2 0.3\n", // TPC out of order
+    "1 0 1 -0.6 2 0 2 0.3\n", // cryostat out of order
+    "0 0 1 -0.6 0\n", // no planes
+    "0 0 1 -0.6 4000000000 0 2 0.3\n", // absurd number of planes
+    "0 0 1 -0.6 65 0 2 0.3\n", // too many planes
+    "zero\n"
+  }) {
+    std::istringstream in { text };
+    BOOST_CHECK_THROW(detinfo::PlaneLayout::Read(in), std::domain_error);
+  }
+
+} // InvalidInputTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LayoutTestCase) {
+  LayoutTest();
+}
+
+BOOST_AUTO_TEST_CASE(TextFormatTestCase) {
+  TextFormatTest();
+}
+
+BOOST_AUTO_TEST_CASE(InvalidInputTestCase) {
+  InvalidInputTest();
+}
+
+//------------------------------------------------------------------------------
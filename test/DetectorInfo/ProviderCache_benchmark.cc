@@ -0,0 +1,239 @@
+/**
+ * @file   ProviderCache_benchmark.cc
+ * @brief  Measures the setup throughput of detector providers with caching.
+ * @date   October 17, 2026
+ *
+ * The standard detector providers (liquid argon properties, detector clocks
+ * and detector properties) are created for each of the configurations
+ * specified on the command line, first directly and then through
+ * `detinfo::StandardProvidersCache` from many threads at once.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "lardataalg/DetectorInfo/StandardProvidersCache.h"
+#include "test/Geometry/geometry_unit_test_base.h"
+
+// framework libraries
+#include "cetlib/filepath_maker.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "fhiclcpp/make_ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <chrono>
+#include <cstdlib> // std::strtoul()
+#include <set>
+#include <string>
+#include <thread>
+#include <utility> // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using TesterConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+using TestEnvironment = testing::GeometryTesterEnvironment<TesterConfiguration>;
+
+//------------------------------------------------------------------------------
+//---  The benchmark
+//---
+
+namespace {
+
+  /// Configuration of the three standard providers.
+  struct ProviderConfigs_t {
+    std::string name; ///< Where the configuration comes from.
+    fhicl::ParameterSet larProp;
+    fhicl::ParameterSet detClocks;
+    fhicl::ParameterSet detProp;
+  }; // ProviderConfigs_t
+
+  /// Parameters known to be in the configuration but not used by the provider.
+  std::set<std::string> const DetPropIgnoreKeys{"InheritNumberTimeSamples"};
+
+  /// Replaces `config` with `services.<serviceName>` from `pset`, if present.
+  void overrideConfig(fhicl::ParameterSet const& pset,
+                      std::string const& serviceName,
+                      fhicl::ParameterSet& config)
+  {
+    std::string const key = "services." + serviceName;
+    if (pset.has_key(key)) config = pset.get<fhicl::ParameterSet>(key);
+  } // overrideConfig()
+
+  /// Creates all the providers without any caching.
+  void buildProviders(ProviderConfigs_t const& configs, geo::GeometryCore const& geom)
+  {
+    detinfo::LArPropertiesStandard const larProp{configs.larProp};
+    detinfo::DetectorClocksStandard const detClocks{configs.detClocks};
+    detinfo::DetectorPropertiesStandard const detProp{
+      configs.detProp, &geom, &larProp, DetPropIgnoreKeys};
+  } // buildProviders()
+
+  /// Returns the seconds elapsed since `start`.
+  double secondsSince(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the benchmark
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("ProviderCache_benchmark")
+ * 1. (mandatory) path to the FHiCL configuration file with the geometry and
+ *    the default configuration of all the providers
+ * 2. number of setup iterations (default: 10)
+ * 3. number of threads querying the cache (default: 4)
+ * 4. and following: more FHiCL configuration files; providers configured in
+ *    `services` replace the default configuration
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  TesterConfiguration config("provcache_bench");
+
+  //
+  // parameter parsing
+  //
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    config.SetConfigurationPath(argv[iParam]);
+  else {
+    std::cerr << "FHiCL configuration file path required as first argument!" << std::endl;
+    return 1;
+  }
+
+  // second argument: number of iterations
+  unsigned int nIterations = 10U;
+  if (++iParam < argc) nIterations = std::strtoul(argv[iParam], nullptr, 10);
+
+  // third argument: number of threads
+  unsigned int nThreads = 4U;
+  if (++iParam < argc) nThreads = std::max(1UL, std::strtoul(argv[iParam], nullptr, 10));
+
+  //
+  // testing environment setup
+  //
+  TestEnvironment TestEnv(config);
+  auto const& geom = *TestEnv.Provider<geo::GeometryCore>();
+
+  std::vector<ProviderConfigs_t> configs;
+  configs.push_back({argv[1],
+                     TestEnv.ServiceParameters("LArPropertiesService"),
+                     TestEnv.ServiceParameters("DetectorClocksService"),
+                     TestEnv.ServiceParameters("DetectorPropertiesService")});
+
+  // all following arguments: other configuration files
+  cet::filepath_lookup policy{"FHICL_FILE_PATH"};
+  while (++iParam < argc) {
+    fhicl::ParameterSet pset;
+    fhicl::make_ParameterSet(argv[iParam], policy, pset);
+
+    ProviderConfigs_t configSet = configs.front();
+    configSet.name = argv[iParam];
+    overrideConfig(pset, "LArPropertiesService", configSet.larProp);
+    overrideConfig(pset, "DetectorClocksService", configSet.detClocks);
+    overrideConfig(pset, "DetectorPropertiesService", configSet.detProp);
+
+    // configurations not supported by this geometry are skipped
+    try {
+      buildProviders(configSet, geom);
+    }
+    catch (cet::exception const& e) {
+      mf::LogWarning("provcache_bench")
+        << "Configuration '" << configSet.name << "' skipped:\n" << e.what();
+      continue;
+    }
+    configs.push_back(std::move(configSet));
+  } // while
+
+  unsigned int nErrors = 0;
+  std::size_t const nSetups = nIterations * configs.size();
+
+  //
+  // direct construction
+  //
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int iter = 0; iter < nIterations; ++iter) {
+    for (auto const& configSet : configs)
+      buildProviders(configSet, geom);
+  }
+  double const directTime = secondsSince(start);
+
+  //
+  // cached construction, concurrently
+  //
+  detinfo::StandardProvidersCache cache;
+
+  // detector properties providers obtained by each thread, by configuration
+  std::vector<std::vector<detinfo::DetectorPropertiesStandard const*>> obtained(nThreads);
+  auto const query = [&](unsigned int iThread) {
+    for (unsigned int iter = 0; iter < nIterations; ++iter) {
+      for (auto const& configSet : configs) {
+        auto const pack = cache.Providers(configSet.larProp,
+                                          configSet.detClocks,
+                                          configSet.detProp,
+                                          geom,
+                                          DetPropIgnoreKeys);
+        if (iter == 0) obtained[iThread].push_back(pack.detProp.get());
+      }
+    }
+  };
+
+  start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (unsigned int iThread = 0; iThread < nThreads; ++iThread)
+    threads.emplace_back(query, iThread);
+  for (auto& thread : threads)
+    thread.join();
+  double const cachedTime = secondsSince(start);
+
+  // all threads must share the same providers
+  for (unsigned int iThread = 1; iThread < nThreads; ++iThread) {
+    if (obtained[iThread] == obtained.front()) continue;
+    mf::LogError("provcache_bench")
+      << "Thread #" << iThread << " obtained providers different from thread #0";
+    ++nErrors;
+  }
+
+  // each distinct configuration must have been built exactly once
+  std::set<fhicl::ParameterSetID> larPropIDs, detClocksIDs;
+  std::set<std::pair<fhicl::ParameterSetID, fhicl::ParameterSetID>> detPropIDs;
+  for (auto const& configSet : configs) {
+    larPropIDs.insert(configSet.larProp.id());
+    detClocksIDs.insert(configSet.detClocks.id());
+    detPropIDs.emplace(configSet.detProp.id(), configSet.larProp.id());
+  }
+  std::size_t const expectedProviders =
+    larPropIDs.size() + detClocksIDs.size() + detPropIDs.size();
+  if (cache.NProviders() != expectedProviders) {
+    mf::LogError("provcache_bench") << "Cache holds " << cache.NProviders()
+                                    << " providers, expected " << expectedProviders;
+    ++nErrors;
+  }
+
+  mf::LogVerbatim("provcache_bench")
+    << "Configurations:      " << configs.size() << " (" << expectedProviders
+    << " distinct providers)"
+    << "\nDirect setup:        " << nSetups << " setups in " << directTime << " s ("
+    << (nSetups / directTime) << " setups/s)"
+    << "\nCached setup:        " << (nSetups * nThreads) << " setups in " << cachedTime
+    << " s with " << nThreads << " threads (" << (nSetups * nThreads / cachedTime)
+    << " setups/s)";
+
+  return nErrors;
+} // main()
@@ -0,0 +1,134 @@
+/**
+ * @file   ProviderCache_test.cc
+ * @brief  Test of the cache of providers.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ProviderCache.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ProviderCache_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/ProviderCache.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <memory> // std::make_unique()
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <thread>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+struct TestProvider_t {
+  std::string config;
+}; // TestProvider_t
+
+using TestCache_t = detinfo::ProviderCache<std::string, TestProvider_t>;
+
+
+//------------------------------------------------------------------------------
+void BuildOnceTest() {
+
+  TestCache_t cache;
+  unsigned int nBuilt = 0U;
+  auto factory = [&nBuilt](std::string const& config)
+    {
+      return [&nBuilt, config]()
+        { ++nBuilt; return std::make_unique<TestProvider_t>(TestProvider_t{config}); };
+    };
+
+  auto const first = cache.get("A", factory("A"));
+  BOOST_CHECK_EQUAL(first->config, "A");
+  BOOST_CHECK_EQUAL(cache.get("A", factory("A")), first);
+  BOOST_CHECK_EQUAL(nBuilt, 1U);
+  BOOST_CHECK(cache.has("A"));
+  BOOST_CHECK(!cache.has("B"));
+
+  auto const second = cache.get("B", factory("B"));
+  BOOST_CHECK_EQUAL(second->config, "B");
+  BOOST_CHECK_EQUAL(cache.size(), 2U);
+  BOOST_CHECK_EQUAL(nBuilt, 2U);
+
+  // the owners keep their providers after the cache is cleared
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0U);
+  BOOST_CHECK_EQUAL(first->config, "A");
+  BOOST_CHECK_NE(cache.get("A", factory("A")), first);
+
+} // BuildOnceTest()
+
+
+//------------------------------------------------------------------------------
+void ConcurrentBuildTest() {
+
+  constexpr unsigned int NThreads = 8U;
+  constexpr unsigned int NKeys = 5U;
+
+  TestCache_t cache;
+  std::atomic<unsigned int> nBuilt{0U};
+  std::vector<std::vector<TestProvider_t const*>> obtained(NThreads);
+
+  auto query = [&](unsigned int iThread) {
+    for (unsigned int iKey = 0; iKey < NKeys; ++iKey) {
+      std::string const key = std::to_string(iKey);
+      auto const provider = cache.get(key, [&nBuilt, key]()
+        {
+          ++nBuilt;
+          std::this_thread::yield();
+          return std::make_unique<TestProvider_t>(TestProvider_t{key});
+        });
+      obtained[iThread].push_back(provider.get());
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned int iThread = 0; iThread < NThreads; ++iThread)
+    threads.emplace_back(query, iThread);
+  for (auto& thread: threads) thread.join();
+
+  BOOST_CHECK_EQUAL(nBuilt.load(), NKeys);
+  BOOST_CHECK_EQUAL(cache.size(), NKeys);
+  for (unsigned int iThread = 1; iThread < NThreads; ++iThread)
+    BOOST_CHECK(obtained[iThread] == obtained.front());
+
+} // ConcurrentBuildTest()
+
+
+//------------------------------------------------------------------------------
+void FailedBuildTest() {
+
+  TestCache_t cache;
+
+  BOOST_CHECK_THROW(
+    cache.get("A", []() -> std::unique_ptr<TestProvider_t>
+      { throw std::runtime_error("bad configuration"); }),
+    std::runtime_error
+    );
+  BOOST_CHECK(!cache.has("A"));
+
+  // a failed construction is attempted again
+  auto const provider = cache.get
+    ("A", [](){ return std::make_unique<TestProvider_t>(TestProvider_t{"A"}); });
+  BOOST_CHECK_EQUAL(provider->config, "A");
+
+} // FailedBuildTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BuildOnceTestCase) {
+  BuildOnceTest();
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentBuildTestCase) {
+  ConcurrentBuildTest();
+}
+
+BOOST_AUTO_TEST_CASE(FailedBuildTestCase) {
+  FailedBuildTest();
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,137 @@
+/**
+ * @file   ProviderInstrumentation_test.cc
+ * @brief  Test of the instrumentation of provider functions.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/ProviderInstrumentation.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ProviderInstrumentation_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/ProviderInstrumentation.h"
+
+// C/C++ standard libraries
+#include <numeric> // std::accumulate()
+#include <thread>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// these functions are instrumented whatever the build configuration,
+// using the probes directly rather than `LARDATAALG_DETECTORINFO_INSTRUMENT()`
+double square(double x) {
+  static detinfo::instrumentation::Probe const probe { "TestProvider::square" };
+  detinfo::instrumentation::ScopedTimer const timer { probe };
+  return x * x;
+}
+
+double cube(double x) {
+  static detinfo::instrumentation::Probe const probe { "TestProvider::cube" };
+  detinfo::instrumentation::ScopedTimer const timer { probe };
+  return square(x) * x;
+}
+
+// this function is instrumented only if the build configuration says so
+double twice(double x) {
+  LARDATAALG_DETECTORINFO_INSTRUMENT("MacroProvider::twice");
+  return 2.0 * x;
+}
+
+
+//------------------------------------------------------------------------------
+void CountingTest() {
+
+  using detinfo::instrumentation::SamplingPeriod;
+
+  detinfo::instrumentation::reset();
+
+  double sum = 0.0;
+  for (int i = 0; i < 200; ++i) sum += cube(i);
+  std::thread worker { [](){ for (int i = 0; i < 100; ++i) square(i); } };
+  worker.join(); // the counts of the ended thread are kept
+
+  auto const stats = detinfo::instrumentation::collect("TestProvider::");
+  BOOST_REQUIRE_EQUAL(stats.size(), 2U);
+
+  // functions are listed in order of first call
+  BOOST_CHECK_EQUAL(stats[0].name, "TestProvider::cube");
+  BOOST_CHECK_EQUAL(stats[0].calls, 200U);
+  BOOST_CHECK_EQUAL(stats[1].name, "TestProvider::square");
+  BOOST_CHECK_EQUAL(stats[1].calls, 300U);
+
+  // one call every SamplingPeriod is timed, starting from the first one
+  auto const timed = [](unsigned int calls)
+    { return (calls + SamplingPeriod - 1U) / SamplingPeriod; };
+  BOOST_CHECK_EQUAL(stats[0].sampledCalls, timed(200U));
+  BOOST_CHECK_EQUAL(stats[1].sampledCalls, timed(200U) + timed(100U));
+  for (auto const& function: stats) {
+    BOOST_CHECK_EQUAL(
+      std::accumulate(function.latency.begin(), function.latency.end(), 0ULL),
+      function.sampledCalls
+      );
+  }
+
+  BOOST_CHECK(detinfo::instrumentation::collect("NoProvider::").empty());
+
+  detinfo::instrumentation::reset();
+  for (auto const& function: detinfo::instrumentation::collect("TestProvider::")) {
+    BOOST_CHECK_EQUAL(function.calls, 0U);
+    BOOST_CHECK_EQUAL(function.sampledCalls, 0U);
+  }
+
+  BOOST_CHECK(sum > 0.0);
+
+} // CountingTest()
+
+
+//------------------------------------------------------------------------------
+void ConfigurationTest() {
+
+  detinfo::instrumentation::reset();
+  BOOST_CHECK_EQUAL(twice(3.0), 6.0);
+
+  auto const stats = detinfo::instrumentation::collect("MacroProvider::");
+  if constexpr (detinfo::instrumentation::Enabled) {
+    BOOST_REQUIRE_EQUAL(stats.size(), 1U);
+    BOOST_CHECK_EQUAL(stats[0].calls, 1U);
+  }
+  else BOOST_CHECK(stats.empty());
+
+} // ConfigurationTest()
+
+
+//------------------------------------------------------------------------------
+void LatencyBinTest() {
+
+  using detinfo::instrumentation::FunctionStats_t;
+  using detinfo::instrumentation::details::latencyBin;
+
+  BOOST_CHECK_EQUAL(latencyBin(0U), 0U);
+  BOOST_CHECK_EQUAL(latencyBin(1U), 0U);
+  BOOST_CHECK_EQUAL(latencyBin(2U), 1U);
+  BOOST_CHECK_EQUAL(latencyBin(1023U), 9U);
+  BOOST_CHECK_EQUAL(latencyBin(1024U), 10U);
+  BOOST_CHECK_EQUAL(latencyBin(~0ULL), detinfo::instrumentation::NLatencyBins - 1U);
+  BOOST_CHECK_EQUAL(FunctionStats_t::BinLowerEdge(0U), 0U);
+  BOOST_CHECK_EQUAL(FunctionStats_t::BinLowerEdge(10U), 1024U);
+
+} // LatencyBinTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CountingTestCase) {
+  CountingTest();
+}
+
+BOOST_AUTO_TEST_CASE(ConfigurationTestCase) {
+  ConfigurationTest();
+}
+
+BOOST_AUTO_TEST_CASE(LatencyBinTestCase) {
+  LatencyBinTest();
+}
+
+//------------------------------------------------------------------------------
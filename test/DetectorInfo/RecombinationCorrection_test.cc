@@ -0,0 +1,96 @@
+/**
+ * @file   RecombinationCorrection_test.cc
+ * @brief  Test of `detinfo::RecombinationCorrection`.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/RecombinationCorrection.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RecombinationCorrection_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/RecombinationCorrection.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::exp()
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// reference implementations, as in the original DetectorPropertiesStandard
+double referenceBirks(double dQdx, double E_field, double rho) {
+  constexpr double A3t = util::kRecombA;
+  double K3t = util::kRecombk;                           // in KV/cm*(g/cm^2)/MeV
+  constexpr double Wion = 1000. / util::kGeVToElectrons; // 23.6 eV = 1e, Wion in MeV/e
+  K3t /= rho;                                            // KV/MeV
+  return dQdx / (A3t / Wion - K3t / E_field * dQdx);     // MeV/cm
+} // referenceBirks()
+
+
+double referenceModBox(double dQdx, double E_field, double rho) {
+  constexpr double Wion = 1000. / util::kGeVToElectrons; // 23.6 eV = 1e, Wion in MeV/e
+  double const Beta = util::kModBoxB / (rho * E_field);
+  constexpr double Alpha = util::kModBoxA;
+  return (std::exp(Beta * Wion * dQdx) - Alpha) / Beta;
+} // referenceModBox()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RecombinationCorrection_test) {
+
+  double const rho = -0.00615 * 87.0 + 1.928; // g/cm^3
+  double const nominalField = 0.5; // kV/cm
+
+  detinfo::RecombinationCorrection const recomb { rho, nominalField };
+  BOOST_CHECK_EQUAL(recomb.Density(), rho);
+  BOOST_CHECK_EQUAL(recomb.Efield(), nominalField);
+
+  std::vector<double> dQdx, efield;
+  for (unsigned int i = 0; i < 1000; ++i) {
+    dQdx.push_back(1000.0 + 100.0 * i);      // electrons/cm
+    efield.push_back(0.2 + 0.0005 * i);      // kV/cm
+  }
+
+  std::vector<double> dEdx(dQdx.size());
+
+  // Birks, nominal field
+  auto it = recomb.Birks(dQdx.cbegin(), dQdx.cend(), dEdx.begin());
+  BOOST_CHECK(it == dEdx.end());
+  for (std::size_t i = 0; i < dQdx.size(); ++i) {
+    double const expected = referenceBirks(dQdx[i], nominalField, rho);
+    BOOST_CHECK_CLOSE(recomb.Birks(dQdx[i]), expected, 1e-10);
+    BOOST_CHECK_CLOSE(dEdx[i], expected, 1e-10);
+  }
+
+  // Birks, field for each value
+  it = recomb.Birks(dQdx.cbegin(), dQdx.cend(), efield.cbegin(), dEdx.begin());
+  BOOST_CHECK(it == dEdx.end());
+  for (std::size_t i = 0; i < dQdx.size(); ++i) {
+    double const expected = referenceBirks(dQdx[i], efield[i], rho);
+    BOOST_CHECK_CLOSE(recomb.Birks(dQdx[i], efield[i]), expected, 1e-10);
+    BOOST_CHECK_CLOSE(dEdx[i], expected, 1e-10);
+  }
+
+  // modified box, nominal field
+  it = recomb.ModBox(dQdx.cbegin(), dQdx.cend(), dEdx.begin());
+  BOOST_CHECK(it == dEdx.end());
+  for (std::size_t i = 0; i < dQdx.size(); ++i) {
+    double const expected = referenceModBox(dQdx[i], nominalField, rho);
+    BOOST_CHECK_CLOSE(recomb.ModBox(dQdx[i]), expected, 1e-10);
+    BOOST_CHECK_CLOSE(dEdx[i], expected, 1e-10);
+  }
+
+  // modified box, field for each value
+  it = recomb.ModBox(dQdx.cbegin(), dQdx.cend(), efield.cbegin(), dEdx.begin());
+  BOOST_CHECK(it == dEdx.end());
+  for (std::size_t i = 0; i < dQdx.size(); ++i) {
+    double const expected = referenceModBox(dQdx[i], efield[i], rho);
+    BOOST_CHECK_CLOSE(recomb.ModBox(dQdx[i], efield[i]), expected, 1e-10);
+    BOOST_CHECK_CLOSE(dEdx[i], expected, 1e-10);
+  }
+
+} // BOOST_AUTO_TEST_CASE(RecombinationCorrection_test)
@@ -0,0 +1,156 @@
+/**
+ * @file   TimeMergeJoin_test.cc
+ * @brief  Test of merging and matching of time-sorted streams.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/TimeMergeJoin.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( TimeMergeJoin_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/TimeMergeJoin.h"
+#include "lardataalg/DetectorInfo/DetectorClocksData.h"
+#include "lardataalg/DetectorInfo/DetectorTimings.h"
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::out_of_range
+#include <utility> // std::pair
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// trigger at 1000 us, beam gate at 1002 us, TPC electronics starting at 900 us
+// (all on the electronics time scale)
+detinfo::ElecClock const TestClock { 0.0, 1600.0, 2.0 };
+detinfo::DetectorClocksData const TestClockData
+  { 0.0, -100.0, 1000.0, 1002.0, TestClock, TestClock, TestClock, TestClock };
+
+
+//------------------------------------------------------------------------------
+void MergeTest() {
+
+  using namespace detinfo::timescales;
+  using namespace util::quantities::time_literals;
+
+  detinfo::TimeMergeJoin<electronics_time> mergeJoin
+    { detinfo::makeDetectorTimings(TestClockData) };
+
+  // optical times share the start of electronics time: 1001, 1004, 1010 us
+  std::vector<optical_time> const optical
+    { optical_time{ 1001.0 }, optical_time{ 1004.0 }, optical_time{ 1010.0 } };
+  // electronics times: 1000, 1004 and 1007 us
+  std::vector<electronics_time> const electronics { electronics_time{ 1000.0 },
+    electronics_time{ 1004.0 }, electronics_time{ 1007.0 } };
+  std::vector<electronics_time> const empty;
+
+  BOOST_CHECK_EQUAL(mergeJoin.addStream(optical), 0U);
+  BOOST_CHECK_EQUAL(mergeJoin.addStream(empty), 1U);
+  BOOST_CHECK_EQUAL(mergeJoin.addStream(electronics), 2U);
+  BOOST_CHECK_EQUAL(mergeJoin.nStreams(), 3U);
+  BOOST_CHECK_EQUAL(mergeJoin.streamSize(0U), 3U);
+  BOOST_CHECK_EQUAL(mergeJoin.streamSize(1U), 0U);
+  BOOST_CHECK_CLOSE(mergeJoin.timeOf(0U, 2U).value(), 1010.0, 1e-9);
+
+  // elements with the same time are sorted by stream
+  std::vector<std::pair<std::size_t, std::size_t>> const expected
+    { { 2, 0 }, { 0, 0 }, { 0, 1 }, { 2, 1 }, { 2, 2 }, { 0, 2 } };
+  std::vector<std::pair<std::size_t, std::size_t>> merged;
+  electronics_time last { 0.0 };
+  mergeJoin.merge([&merged, &last](auto const& element)
+    {
+      BOOST_CHECK(!(element.time < last));
+      last = element.time;
+      merged.emplace_back(element.stream, element.index);
+    });
+  BOOST_CHECK(merged == expected);
+
+  // groups within 3 us from their first element
+  std::vector<std::size_t> groupSizes;
+  mergeJoin.groups(3_us,
+    [&groupSizes](auto const& group){ groupSizes.push_back(group.size()); });
+  BOOST_CHECK((groupSizes == std::vector<std::size_t>{ 2U, 3U, 1U }));
+
+} // MergeTest()
+
+
+//------------------------------------------------------------------------------
+void JoinTest() {
+
+  using namespace detinfo::timescales;
+  using namespace util::quantities::time_literals;
+
+  detinfo::TimeMergeJoin<> mergeJoin
+    { detinfo::makeDetectorTimings(TestClockData) };
+
+  // reference: flashes at 1001 and 1010 us
+  std::vector<optical_time> const flashes
+    { optical_time{ 1001.0 }, optical_time{ 1010.0 } };
+  // hits from a structure, in TPC electronics time: 998, 1000, 1002, 1009.5 us
+  struct Hit { double time; };
+  std::vector<Hit> const hits { { 98.0 }, { 100.0 }, { 102.0 }, { 109.5 } };
+  // simulation times are in nanoseconds: 1000.5 and 1011 us
+  std::vector<simulation_time> const steps
+    { simulation_time{ 1000.5e3 }, simulation_time{ 1011.0e3 } };
+
+  std::size_t const flashStream = mergeJoin.addStream(flashes);
+  mergeJoin.addStream(hits.begin(), hits.end(),
+    [](Hit const& hit){ return TPCelectronics_time{ hit.time }; });
+  mergeJoin.addStream(steps);
+  BOOST_CHECK_CLOSE(mergeJoin.timeOf(2U, 0U).value(), 1000.5, 1e-9);
+
+  using Range_t = decltype(mergeJoin)::Range_t;
+  std::vector<std::vector<Range_t>> matches;
+  mergeJoin.join(flashStream, 1_us, 1_us,
+    [&matches](auto const& flash, std::vector<Range_t> const& ranges)
+      {
+        BOOST_CHECK_EQUAL(flash.index, matches.size());
+        matches.push_back(ranges);
+      }
+    );
+  BOOST_REQUIRE_EQUAL(matches.size(), 2U);
+
+  // first flash (1001 us): hits #1 and #2 [1000;1002], step #0
+  BOOST_REQUIRE_EQUAL(matches[0].size(), 2U);
+  BOOST_CHECK_EQUAL(matches[0][0].stream, 1U);
+  BOOST_CHECK_EQUAL(matches[0][0].begin, 1U);
+  BOOST_CHECK_EQUAL(matches[0][0].end, 3U);
+  BOOST_CHECK_EQUAL(matches[0][1].stream, 2U);
+  BOOST_CHECK_EQUAL(matches[0][1].begin, 0U);
+  BOOST_CHECK_EQUAL(matches[0][1].size(), 1U);
+
+  // second flash (1010 us): hit #3, step #1
+  BOOST_CHECK_EQUAL(matches[1][0].begin, 3U);
+  BOOST_CHECK_EQUAL(matches[1][0].size(), 1U);
+  BOOST_CHECK_EQUAL(matches[1][1].begin, 1U);
+  BOOST_CHECK_EQUAL(matches[1][1].size(), 1U);
+
+  // asymmetric window, matching nothing
+  mergeJoin.join(flashStream, 0_us, 0.1_us,
+    [](auto const&, std::vector<Range_t> const& ranges)
+      { for (Range_t const& range: ranges) BOOST_CHECK(range.empty()); }
+    );
+
+  BOOST_CHECK_THROW(
+    mergeJoin.join(3U, 1_us, 1_us, [](auto const&, auto const&){}),
+    std::out_of_range
+    );
+
+} // JoinTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MergeTestCase) {
+  MergeTest();
+}
+
+BOOST_AUTO_TEST_CASE(JoinTestCase) {
+  JoinTest();
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,125 @@
+/**
+ * @file   TimestampUnwrapper_test.cc
+ * @brief  Test of unwrapping of rolling over timestamps.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/TimestampUnwrapper.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( TimestampUnwrapper_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/TimestampUnwrapper.h"
+#include "lardataalg/DetectorInfo/DetectorClocksException.h"
+#include "lardataalg/DetectorInfo/DetectorTimingTypes.h"
+#include "lardataalg/DetectorInfo/ElecClock.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::int64_t, std::uint32_t
+#include <iterator> // std::back_inserter()
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// a clock of 2 MHz with a frame of 50 us: 100 ticks per frame
+detinfo::ElecClock const TestClock { 0.0, 50.0, 2.0 };
+
+
+//------------------------------------------------------------------------------
+void InOrderTest() {
+
+  detinfo::TimestampUnwrapper<> unwrapper { TestClock };
+  BOOST_CHECK_EQUAL(unwrapper.frameTicks(), 100);
+  BOOST_CHECK_EQUAL(unwrapper.latestTick(), -1);
+
+  // ticks 10, 60, 99, then (rollover) 103, 150, then (rollover) 201
+  std::vector<std::uint32_t> const timestamps { 10, 60, 99, 3, 50, 1 };
+  std::vector<std::int64_t> const expected { 10, 60, 99, 103, 150, 201 };
+  for (std::size_t i = 0; i < timestamps.size(); ++i)
+    BOOST_CHECK_EQUAL(unwrapper.unwrapTick(timestamps[i]), expected[i]);
+
+  BOOST_CHECK_EQUAL(unwrapper.nTimestamps(), timestamps.size());
+  BOOST_CHECK_EQUAL(unwrapper.nRollovers(), 2U);
+  BOOST_CHECK_EQUAL(unwrapper.nLate(), 0U);
+  BOOST_CHECK_EQUAL(unwrapper.frame(), 2);
+  BOOST_CHECK_EQUAL(unwrapper.latestTick(), 201);
+
+  // the same timestamps again, as a batch, continue the stream
+  std::vector<detinfo::timescales::electronics_time> times;
+  unwrapper.unwrap(timestamps, times);
+  BOOST_REQUIRE_EQUAL(times.size(), timestamps.size());
+  BOOST_CHECK_CLOSE(times[0].value(), 105.0, 1e-9); // tick 210
+  BOOST_CHECK_CLOSE(times[5].value(), 200.5, 1e-9); // tick 401
+
+  unwrapper.reset();
+  BOOST_CHECK_EQUAL(unwrapper.unwrapTick(20), 20);
+  BOOST_CHECK_EQUAL(unwrapper.nTimestamps(), 1U);
+
+} // InOrderTest()
+
+
+//------------------------------------------------------------------------------
+void OutOfOrderTest() {
+
+  using optical_time = detinfo::timescales::optical_time;
+
+  detinfo::TimestampUnwrapper<optical_time> unwrapper
+    { TestClock, 5U, optical_time{ 1000.0 } };
+
+  // 95, 92 (late), 2 (rollover), 98 (late from the previous frame), 0 (late),
+  // 4, 96 (rollover: beyond tolerance)
+  std::vector<std::uint32_t> const timestamps { 95, 92, 2, 98, 0, 4, 96 };
+  std::vector<std::int64_t> const expected { 95, 92, 102, 98, 100, 104, 196 };
+  std::vector<optical_time> times;
+  unwrapper.unwrap
+    (timestamps.begin(), timestamps.end(), std::back_inserter(times));
+
+  BOOST_REQUIRE_EQUAL(times.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    BOOST_CHECK_CLOSE
+      (times[i].value(), 1000.0 + expected[i] * 0.5, 1e-9);
+  }
+  BOOST_CHECK_EQUAL(unwrapper.nLate(), 3U);
+  BOOST_CHECK_EQUAL(unwrapper.nRollovers(), 1U);
+  BOOST_CHECK_EQUAL(unwrapper.latestTick(), 196);
+
+  // a late timestamp before the first frame gets a negative tick
+  unwrapper.reset();
+  BOOST_CHECK_EQUAL(unwrapper.unwrapTick(1), 1);
+  BOOST_CHECK_EQUAL(unwrapper.unwrapTick(99), -1);
+  BOOST_CHECK_CLOSE(unwrapper.timeOf(-1).value(), 999.5, 1e-9);
+
+} // OutOfOrderTest()
+
+
+//------------------------------------------------------------------------------
+void InvalidInputTest() {
+
+  BOOST_CHECK_THROW(
+    detinfo::TimestampUnwrapper<>(TestClock, 50U),
+    detinfo::DetectorClocksException
+    );
+
+  detinfo::TimestampUnwrapper<> unwrapper { TestClock, 49U };
+  BOOST_CHECK_THROW(unwrapper.unwrapTick(100), detinfo::DetectorClocksException);
+
+} // InvalidInputTest()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InOrderTestCase) {
+  InOrderTest();
+}
+
+BOOST_AUTO_TEST_CASE(OutOfOrderTestCase) {
+  OutOfOrderTest();
+}
+
+BOOST_AUTO_TEST_CASE(InvalidInputTestCase) {
+  InvalidInputTest();
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,41 @@
+/**
+ * @file   VectorExp_test.cc
+ * @brief  Test of `detinfo::details::vectorExp()`.
+ * @date   October 17, 2026
+ * @see    lardataalg/DetectorInfo/VectorExp.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( VectorExp_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/DetectorInfo/VectorExp.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::exp(), std::isinf()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(vectorExp_test) {
+
+  // relative error within 1e-15 (BOOST_CHECK_CLOSE takes percent)
+  for (double x = -700.0; x <= 700.0; x += 0.0731)
+    BOOST_CHECK_CLOSE(detinfo::details::vectorExp(x), std::exp(x), 1e-13);
+
+  BOOST_CHECK_EQUAL(detinfo::details::vectorExp(0.0), 1.0);
+  BOOST_CHECK_CLOSE(detinfo::details::vectorExp(1.0), std::exp(1.0), 1e-13);
+
+  // overflow and underflow as std::exp()
+  BOOST_CHECK(std::isinf(detinfo::details::vectorExp(710.0)));
+  BOOST_CHECK(std::isinf(detinfo::details::vectorExp(1400.0)));
+  BOOST_CHECK_EQUAL(detinfo::details::vectorExp(-750.0), 0.0);
+  BOOST_CHECK_EQUAL(detinfo::details::vectorExp(-1400.0), 0.0);
+  BOOST_CHECK_CLOSE(detinfo::details::vectorExp(-720.0), std::exp(-720.0), 1e-6);
+
+} // BOOST_AUTO_TEST_CASE(vectorExp_test)
+
+
+//------------------------------------------------------------------------------
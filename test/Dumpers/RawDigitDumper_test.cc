@@ -0,0 +1,208 @@
+/**
+ * @file   RawDigitDumper_test.cc
+ * @brief  Test of the block decoding of `dump::raw::RawDigitDumper`.
+ * @date   October 17, 2026
+ * @see    lardataalg/Dumpers/RawData/RawDigit.h
+ *
+ * The digits are compressed with the functions of `lardataobj`, and the
+ * decoded blocks are compared with the result of `raw::Uncompress()`.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RawDigitDumper_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/Dumpers/RawData/RawDigit.h"
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RawData/raw.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cmath> // std::sqrt()
+#include <cstddef> // std::size_t
+#include <random> // std::mt19937
+#include <sstream>
+#include <stdexcept> // std::logic_error
+#include <string>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+/// Number of ticks of the test waveform; none of the block sizes divides it.
+constexpr std::size_t NTicks = 5000U;
+
+/// Decoding block sizes tested.
+constexpr std::array<std::size_t, 6U> BlockSizes
+  {{ 1U, 7U, 64U, 4096U, NTicks, 2 * NTicks }};
+
+/// Pedestal assigned to the digits (assigned to suppressed ticks).
+constexpr short Pedestal = 20;
+
+/// Threshold for zero suppression.
+constexpr unsigned int ZeroThreshold = 30U;
+
+
+/// Returns a waveform with small noise around the pedestal and a few pulses.
+/// ADC counts are not negative, as the Huffman encoding requires.
+std::vector<short> makeWaveform() {
+
+  std::mt19937 engine { 12345U }; // the raw engine output is portable
+  std::vector<short> waveform;
+  waveform.reserve(NTicks);
+  short value = Pedestal;
+  for (std::size_t tick = 0; tick < NTicks; ++tick) {
+    // noise: steps from -3 to +3 (the Huffman codes), kept close to pedestal
+    value += static_cast<short>(engine() % 7U) - 3;
+    if (value > Pedestal + 5) value = Pedestal + 5;
+    if (value < Pedestal - 5) value = Pedestal - 5;
+    short adc = value;
+    // a pulse every 700 ticks, with a jump larger than any Huffman code
+    std::size_t const pulseTick = tick % 700U;
+    if ((pulseTick >= 300U) && (pulseTick < 320U))
+      adc += static_cast<short>(100U + 20U * (pulseTick - 300U));
+    waveform.push_back(adc);
+  } // for
+
+  return waveform;
+} // makeWaveform()
+
+
+/// Returns a digit of the waveform with the specified compression.
+raw::RawDigit makeDigit
+  (std::vector<short> waveform, raw::Compress_t compression)
+{
+  switch (compression) {
+    case raw::kNone:                                                      break;
+    case raw::kHuffman:         raw::CompressHuffman(waveform);             break;
+    case raw::kZeroSuppression:
+      raw::ZeroSuppression(waveform, ZeroThreshold, 2);
+      break;
+    default:
+      throw std::logic_error("makeDigit(): unsupported compression");
+  } // switch
+  raw::RawDigit digit { 5U, NTicks, waveform, compression };
+  digit.SetPedestal(Pedestal, 1.0);
+  return digit;
+} // makeDigit()
+
+
+/// Returns the content of the digit from `raw::Uncompress()`.
+std::vector<short> uncompress(raw::RawDigit const& digit) {
+  std::vector<short> uncompressed(digit.Samples());
+  raw::Uncompress(
+    digit.ADCs(), uncompressed, static_cast<int>(digit.GetPedestal()),
+    digit.Compression()
+    );
+  return uncompressed;
+} // uncompress()
+
+
+//------------------------------------------------------------------------------
+void checkBlockDecoding(raw::Compress_t compression) {
+
+  raw::RawDigit const digit = makeDigit(makeWaveform(), compression);
+  std::vector<short> const expected = uncompress(digit);
+  BOOST_TEST_MESSAGE("Compression: "
+    << dump::raw::RawDigitDumper::compressionName(compression)
+    << " (" << digit.NADC() << " words)");
+  BOOST_CHECK_EQUAL(expected.size(), NTicks);
+
+  for (std::size_t const blockSize: BlockSizes) {
+    BOOST_TEST_MESSAGE("  block size: " << blockSize);
+
+    dump::raw::RawDigitDumper dumper { 0U, blockSize };
+
+    std::vector<short> decoded;
+    std::size_t nBlocks = 0U;
+    bool const streaming = dumper.forEachBlock(digit,
+      [&](std::size_t firstTick, short const* begin, short const* end)
+      {
+        BOOST_CHECK_EQUAL(firstTick, decoded.size());
+        std::size_t const n = end - begin;
+        BOOST_CHECK_GT(n, 0U);
+        BOOST_CHECK_LE(n, blockSize);
+        // all blocks are full but the last one
+        if (firstTick + n < NTicks) BOOST_CHECK_EQUAL(n, blockSize);
+        decoded.insert(decoded.end(), begin, end);
+        ++nBlocks;
+      }
+      );
+    BOOST_CHECK(streaming);
+    BOOST_CHECK_EQUAL(nBlocks, (NTicks + blockSize - 1) / blockSize);
+    BOOST_CHECK_EQUAL(decoded.size(), expected.size());
+    BOOST_CHECK(decoded == expected);
+
+    // the summary must describe the same content
+    lar::util::StatCollector<double> stats;
+    lar::util::MinMaxCollector<short> range;
+    for (short const adc: expected) {
+      stats.add(adc);
+      range.add(adc);
+    }
+    auto const summary = dumper.summarize(digit);
+    BOOST_CHECK_EQUAL(summary.channel, digit.Channel());
+    BOOST_CHECK_EQUAL(summary.nTicks, NTicks);
+    BOOST_CHECK_CLOSE(summary.stats.Average(), stats.Average(), 1e-8);
+    BOOST_CHECK_CLOSE(summary.stats.RMS(), stats.RMS(), 1e-8);
+    BOOST_CHECK_EQUAL(summary.range.min(), range.min());
+    BOOST_CHECK_EQUAL(summary.range.max(), range.max());
+
+  } // for block sizes
+
+} // checkBlockDecoding()
+
+
+//------------------------------------------------------------------------------
+void checkDumpOutput(raw::Compress_t compression) {
+
+  raw::RawDigit const digit = makeDigit(makeWaveform(), compression);
+
+  // the output must not depend on the decoding block size
+  std::string reference;
+  for (std::size_t const blockSize: BlockSizes) {
+    dump::raw::RawDigitDumper dumper { 20U, blockSize };
+    dumper.setIndent("  ");
+    std::ostringstream out;
+    dumper.dump(out, digit);
+
+    if (reference.empty()) {
+      reference = out.str();
+      // the summary line is the one of summarize()
+      auto const summary = dumper.summarize(digit);
+      std::ostringstream summaryLine;
+      summaryLine << "average: " << summary.stats.Average()
+        << " RMS: " << summary.stats.RMS();
+      BOOST_CHECK(reference.find(summaryLine.str()) != std::string::npos);
+      BOOST_CHECK(reference.find("WARNING") == std::string::npos);
+    }
+    else BOOST_CHECK_EQUAL(out.str(), reference);
+  } // for block sizes
+
+} // checkDumpOutput()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(UncompressedDecoding_test) {
+  checkBlockDecoding(raw::kNone);
+}
+
+BOOST_AUTO_TEST_CASE(HuffmanDecoding_test) {
+  checkBlockDecoding(raw::kHuffman);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroSuppressedDecoding_test) {
+  checkBlockDecoding(raw::kZeroSuppression);
+}
+
+BOOST_AUTO_TEST_CASE(DumpOutput_test) {
+  checkDumpOutput(raw::kNone);
+  checkDumpOutput(raw::kHuffman);
+  checkDumpOutput(raw::kZeroSuppression);
+}
+
+//------------------------------------------------------------------------------
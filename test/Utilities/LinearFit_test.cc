@@ -0,0 +1,170 @@
+/**
+ * @file    LinearFit_test.cc
+ * @brief   Tests the classes in LinearFit.h
+ * @date    October 17, 2026
+ * @see     lardataalg/Utilities/LinearFit.h
+ */
+
+// C/C++ standard libraries
+#include <cmath> // std::sqrt()
+#include <cstddef> // std::size_t
+#include <stdexcept> // std::range_error, std::invalid_argument
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( LinearFit_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "lardataalg/Utilities/LinearFit.h"
+#include "lardataalg/Utilities/StatCollector.h"
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Tests FitLine() on points on a line and on scattered points
+void FitLineTest() {
+
+  // points exactly on y = 3 - 2x, far from x = 0
+  lar::util::StatCollector2D<double> onLine;
+  for (double x: { 1000.0, 1001.0, 1002.5, 1004.0 }) onLine.add(x, 3.0 - 2.0 * x);
+
+  auto const line = lar::util::FitLine(onLine);
+  BOOST_CHECK(line.valid);
+  BOOST_CHECK_EQUAL(line.NDF, 2);
+  BOOST_CHECK_CLOSE(line.slope, -2.0, 1e-6);
+  BOOST_CHECK_CLOSE(line.intercept, 3.0, 1e-3);
+  BOOST_CHECK_SMALL(line.chi2, 1e-6);
+  BOOST_CHECK_CLOSE(line(1003.0), 3.0 - 2006.0, 1e-8);
+
+  // scattered points with weights: compare with the textbook formulae
+  std::vector<double> const xs { 0.0, 1.0, 2.0, 3.0, 4.0 };
+  std::vector<double> const ys { 1.1, 2.9, 5.2, 6.8, 9.3 };
+  std::vector<double> const ws { 1.0, 2.0, 1.0, 0.5, 1.0 };
+  lar::util::StatCollector2D<double> scattered;
+  double S = 0.0, Sx = 0.0, Sy = 0.0, Sxx = 0.0, Sxy = 0.0;
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    scattered.add(xs[i], ys[i], ws[i]);
+    S += ws[i];
+    Sx += ws[i] * xs[i];
+    Sy += ws[i] * ys[i];
+    Sxx += ws[i] * xs[i] * xs[i];
+    Sxy += ws[i] * xs[i] * ys[i];
+  }
+  double const D = S * Sxx - Sx * Sx;
+  double const b = (S * Sxy - Sx * Sy) / D;
+  double const a = (Sxx * Sy - Sx * Sxy) / D;
+  double chi2 = 0.0;
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    double const r = ys[i] - a - b * xs[i];
+    chi2 += ws[i] * r * r;
+  }
+
+  auto const fit = lar::util::FitLine(scattered);
+  BOOST_CHECK(fit.valid);
+  BOOST_CHECK_EQUAL(fit.NDF, 3);
+  BOOST_CHECK_CLOSE(fit.slope, b, 1e-8);
+  BOOST_CHECK_CLOSE(fit.intercept, a, 1e-8);
+  BOOST_CHECK_CLOSE(fit.slopeVariance, S / D, 1e-8);
+  BOOST_CHECK_CLOSE(fit.interceptVariance, Sxx / D, 1e-8);
+  BOOST_CHECK_CLOSE(fit.covariance, -Sx / D, 1e-8);
+  BOOST_CHECK_CLOSE(fit.chi2, chi2, 1e-6);
+  BOOST_CHECK_CLOSE(fit.NormalizedChi2(), chi2 / 3.0, 1e-6);
+  BOOST_CHECK_CLOSE(fit.SlopeError(), std::sqrt(S / D), 1e-8);
+
+  // degenerate inputs
+  lar::util::StatCollector2D<double> empty;
+  BOOST_CHECK_THROW(lar::util::FitLine(empty), std::range_error);
+  lar::util::StatCollector2D<double> vertical;
+  vertical.add(1.0, 2.0);
+  vertical.add(1.0, 5.0);
+  BOOST_CHECK_THROW(lar::util::FitLine(vertical), std::range_error);
+
+} // FitLineTest()
+
+
+//------------------------------------------------------------------------------
+/// Tests BatchLineFitter against FitLine() on each set
+template <typename T>
+void BatchLineFitterTest(double tolerance) {
+
+  using Data_t = T;
+
+  // sets of 0, 1, 2, 3, ... points; the second one has two points at same x
+  constexpr std::size_t NSets = 40;
+  std::vector<Data_t> x, y, w;
+  std::vector<std::size_t> offsets { 0 };
+  std::vector<lar::util::StatCollector2D<double>> expected(NSets);
+  for (std::size_t set = 0; set < NSets; ++set) {
+    std::size_t const nPoints = (set == 2)? 2: set;
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      Data_t const px = (set == 2)? Data_t(5): Data_t(set + i);
+      Data_t const py = Data_t(0.5) * px - Data_t(set)
+        + Data_t(((i * 7) % 5) * 0.1);
+      Data_t const pw = Data_t(1 + i % 3);
+      x.push_back(px);
+      y.push_back(py);
+      w.push_back(pw);
+      expected[set].add(double(px), double(py), double(pw));
+    }
+    offsets.push_back(x.size());
+  } // for sets
+
+  lar::util::BatchLineFitter<Data_t> fitter;
+  auto const& results = fitter.Fit(x, y, w, offsets);
+  BOOST_CHECK_EQUAL(results.size(), NSets);
+  BOOST_CHECK_EQUAL(fitter.NSets(), NSets);
+
+  for (std::size_t set = 0; set < NSets; ++set) {
+    auto const& result = fitter.Result(set);
+    if (set < 3) {
+      BOOST_CHECK(!result.valid);
+      continue;
+    }
+    BOOST_CHECK(result.valid);
+    auto const exp = lar::util::FitLine(expected[set]);
+    BOOST_CHECK_EQUAL(result.NDF, exp.NDF);
+    BOOST_CHECK_CLOSE(double(result.slope), exp.slope, tolerance);
+    BOOST_CHECK_CLOSE(double(result.intercept), exp.intercept, tolerance);
+    BOOST_CHECK_CLOSE
+      (double(result.slopeVariance), exp.slopeVariance, tolerance);
+    BOOST_CHECK_CLOSE
+      (double(result.interceptVariance), exp.interceptVariance, tolerance);
+    BOOST_CHECK_SMALL(double(result.chi2) - exp.chi2, tolerance);
+  } // for
+
+  // unweighted fit of a line
+  std::vector<Data_t> const lx { 1, 2, 3, 4 };
+  std::vector<Data_t> const ly { 3, 5, 7, 9 };
+  fitter.Fit(lx, ly, { 0, 4 });
+  BOOST_CHECK_EQUAL(fitter.NSets(), 1U);
+  BOOST_CHECK_CLOSE(double(fitter.Result(0).slope), 2.0, tolerance);
+  BOOST_CHECK_CLOSE(double(fitter.Result(0).intercept), 1.0, tolerance);
+
+  // inconsistent input
+  BOOST_CHECK_THROW(fitter.Fit(lx, { 1, 2 }, { 0, 2 }), std::invalid_argument);
+  BOOST_CHECK_THROW(fitter.Fit(lx, ly, { 0, 5 }), std::invalid_argument);
+  BOOST_CHECK_THROW(fitter.Fit(lx, ly, { 0, 3, 2 }), std::invalid_argument);
+
+} // BatchLineFitterTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(FitLineRealTest) {
+  FitLineTest();
+}
+
+BOOST_AUTO_TEST_CASE(BatchLineFitterRealTest) {
+  BatchLineFitterTest<double>(1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(BatchLineFitterFloatTest) {
+  BatchLineFitterTest<float>(1e-2);
+}
@@ -0,0 +1,183 @@
+/**
+ * @file   MappedContainer_benchmark.cc
+ * @brief  Compares dense, run-length and sparse mappings of `MappedContainer`.
+ * @date   October 17, 2026
+ * @see    lardataalg/Utilities/MappedContainer.h
+ *
+ * A detector with a number of channels (by default 400000) has only a
+ * fraction of them active. The data of the active channels is mapped into the
+ * full channel range with a plain mapping (`std::vector`),
+ * `util::RunLengthMapping` and `util::SparseMapping`, for different fractions
+ * of active channels. For each mapping, this program reports the memory used
+ * and the time needed to access all channels one by one, to copy all of them
+ * with `MappedContainer::copy_to()`, and (for the sparse mapping only) to visit
+ * just the active ones.
+ *
+ * Usage: `MappedContainer_benchmark [channels [repetitions]]`.
+ * The program returns `1` if the mappings give different results.
+ */
+
+// LArSoft libraries
+#include "lardataalg/Utilities/MappedContainer.h"
+#include "lardataalg/Utilities/RunLengthMapping.h"
+#include "lardataalg/Utilities/SparseMapping.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::shuffle(), std::max()
+#include <chrono>
+#include <cstdlib> // std::strtoul()
+#include <functional> // std::cref()
+#include <iomanip> // std::setw()
+#include <iostream>
+#include <numeric> // std::iota()
+#include <random> // std::mt19937
+#include <vector>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+
+
+//------------------------------------------------------------------------------
+namespace {
+
+  using Index_t = std::size_t;
+
+  constexpr Index_t InvalidIndex = util::MappedContainerBase::invalidIndex();
+
+  /// Returns a plain mapping with `nActive` random channels out of `nChannels`.
+  std::vector<Index_t> makeMapping(std::size_t nChannels, std::size_t nActive) {
+    std::vector<Index_t> channels(nChannels);
+    std::iota(channels.begin(), channels.end(), Index_t(0));
+    std::mt19937 engine { 12345U }; // fixed seed: reproducible layout
+    std::shuffle(channels.begin(), channels.end(), engine);
+    channels.resize(nActive);
+    std::sort(channels.begin(), channels.end());
+
+    std::vector<Index_t> mapping(nChannels, InvalidIndex);
+    Index_t source = 0;
+    for (Index_t channel: channels) mapping[channel] = source++;
+    return mapping;
+  } // makeMapping()
+
+
+  /// Runs `func` `nRepetitions` times, returns the average time in ms.
+  template <typename Func>
+  double timeIt(unsigned int nRepetitions, Func&& func) {
+    auto const start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < nRepetitions; ++i) func();
+    std::chrono::duration<double, std::milli> const elapsed
+      = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / nRepetitions;
+  } // timeIt()
+
+
+  /// Results of the benchmark of one mapping.
+  struct Result_t {
+    std::size_t memory = 0U; ///< Bytes used by the mapping.
+    double accessTime = 0.0; ///< Time to access all elements one by one [ms].
+    double copyTime = 0.0; ///< Time for `copy_to()` [ms].
+    double checksum = 0.0; ///< Sum of the elements accessed one by one.
+    std::vector<float> copy; ///< Result of `copy_to()`.
+  }; // Result_t
+
+
+  /// Benchmarks a `MappedContainer` with the specified mapping.
+  template <typename Mapping>
+  Result_t benchmark(
+    std::vector<float> const& data, Mapping const& mapping,
+    std::size_t nChannels, std::size_t memory, unsigned int nRepetitions
+  ) {
+    util::MappedContainer const mapped
+      { std::cref(data), std::cref(mapping), nChannels, -1.0f };
+
+    Result_t result;
+    result.memory = memory;
+    result.accessTime = timeIt(nRepetitions, [&mapped, &result]()
+      {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < mapped.size(); ++i) sum += mapped[i];
+        result.checksum = sum;
+      });
+    result.copy.resize(nChannels);
+    result.copyTime = timeIt(nRepetitions,
+      [&mapped, &result](){ mapped.copy_to(result.copy.begin()); });
+    return result;
+  } // benchmark()
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv) {
+
+  std::size_t nChannels = 400000U;
+  unsigned int nRepetitions = 5U;
+  if (argc > 1) nChannels = std::strtoul(argv[1], nullptr, 10);
+  if (argc > 2) nRepetitions = std::max(1UL, std::strtoul(argv[2], nullptr, 10));
+
+  std::cout << "Mapping " << nChannels << " channels, " << nRepetitions
+    << " repetitions; times in ms, memory in kB"
+    << "\n  active | mapping     |   memory |   access |     copy | active only"
+    << std::endl;
+
+  int nErrors = 0;
+  for (double const occupancy: { 0.001, 0.01, 0.1, 0.5, 1.0 }) {
+
+    std::size_t const nActive = std::size_t(occupancy * nChannels);
+    std::vector<float> data(nActive);
+    std::iota(data.begin(), data.end(), 0.0f);
+
+    std::vector<Index_t> const plain = makeMapping(nChannels, nActive);
+    util::RunLengthMapping<Index_t> const runs { plain };
+    util::SparseMapping<Index_t> const sparse { plain };
+
+    Result_t const plainResult = benchmark(data, plain, nChannels,
+      plain.size() * sizeof(Index_t), nRepetitions);
+    Result_t const runResult = benchmark(data, runs, nChannels,
+      runs.nRuns() * sizeof(util::RunLengthMapping<Index_t>::Run_t),
+      nRepetitions);
+    Result_t const sparseResult = benchmark(data, sparse, nChannels,
+      sparse.nMapped() * sizeof(util::SparseMapping<Index_t>::Entry_t)
+        + 2U * sparse.nMapped() * sizeof(std::uint32_t), // approximate table
+      nRepetitions);
+
+    double activeSum = 0.0;
+    double const activeTime = timeIt(nRepetitions, [&sparse, &data, &activeSum]()
+      {
+        double sum = 0.0;
+        sparse.forEachMapped(data, [&sum](std::size_t, float value){ sum += value; });
+        activeSum = sum;
+      });
+
+    auto print = [nActive](char const* name, Result_t const& result)
+      {
+        std::cout << std::setw(8) << nActive << " | " << std::setw(11) << name
+          << " | " << std::setw(8) << (result.memory / 1024)
+          << " | " << std::setw(8) << result.accessTime
+          << " | " << std::setw(8) << result.copyTime
+          << " | ";
+      };
+    print("dense", plainResult);
+    std::cout << "-" << std::endl;
+    print("run-length", runResult);
+    std::cout << "-" << std::endl;
+    print("sparse", sparseResult);
+    std::cout << activeTime << std::endl;
+
+    // all the mappings must give the same answer
+    double const expectedSum = plainResult.checksum;
+    double const defaultSum = -1.0 * (nChannels - nActive);
+    if ((runResult.checksum != expectedSum)
+      || (sparseResult.checksum != expectedSum)
+      || (activeSum != expectedSum - defaultSum)
+      || (runResult.copy != plainResult.copy)
+      || (sparseResult.copy != plainResult.copy)
+    ) {
+      std::cerr << "ERROR: mappings disagree with " << nActive
+        << " active channels!" << std::endl;
+      ++nErrors;
+    }
+
+  } // for occupancy
+
+  return (nErrors == 0)? 0: 1;
+} // main()
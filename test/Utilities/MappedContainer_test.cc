@@ -14,17 +14,21 @@
 
 // LArSoft libraries
 #include "lardataalg/Utilities/MappedContainer.h"
+#include "lardataalg/Utilities/RunLengthMapping.h"
+#include "lardataalg/Utilities/SparseMapping.h"
 #include "larcorealg/CoreUtils/ContainerMeta.h" // util::collection_value_t<>
 
 // C/C++ standard libraries
 #include <iostream> // std::cout
 #include <array>
+#include <vector>
 #include <functional> // std::ref()
 #include <algorithm> // std::copy()
 #include <iterator> // std::back_inserter()
 #include <type_traits> // std::is_copy_assignable_v<>...
 #include <cstddef> // std::size_t
 #include <limits>
+#include <stdexcept> // std::invalid_argument
 
 
 //------------------------------------------------------------------------------
@@ -401,6 +405,183 @@ void classDoc1Test() {
 } // classDoc1Test()
 
 
+//------------------------------------------------------------------------------
+void runLengthMappingTest() {
+
+  constexpr auto InvalidIndex = util::MappedContainerBase::invalidIndex();
+
+  std::array<double, 8U> const data
+    {{ 0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0 }};
+
+  // two boards in swapped order, a gap and a lone channel
+  std::vector<std::size_t> const plainMapping {
+    4U, 5U, 6U, 7U, InvalidIndex, InvalidIndex, 0U, 1U, 2U, 3U, 1U,
+    InvalidIndex
+  };
+
+  util::RunLengthMapping<std::size_t> const mapping { plainMapping };
+  BOOST_TEST(mapping.size() == plainMapping.size());
+  BOOST_TEST(mapping.nRuns() == 3U);
+  BOOST_TEST(mapping.nMapped() == 9U);
+  BOOST_TEST(mapping.expand() == plainMapping);
+  for (std::size_t i = 0; i < plainMapping.size(); ++i)
+    BOOST_TEST(mapping[i] == plainMapping[i]);
+  BOOST_TEST(mapping[plainMapping.size() + 5U] == InvalidIndex);
+  std::vector<std::size_t> const iterated { mapping.begin(), mapping.end() };
+  BOOST_TEST(iterated == plainMapping);
+
+  auto const& runs = mapping.runs();
+  BOOST_TEST(runs[0].destination == 0U);
+  BOOST_TEST(runs[0].source == 4U);
+  BOOST_TEST(runs[0].length == 4U);
+  BOOST_TEST(runs[1].destination == 6U);
+  BOOST_TEST(runs[1].source == 0U);
+  BOOST_TEST(runs[1].length == 4U);
+  BOOST_TEST(runs[2].destinationEnd() == 11U);
+
+  // the compressed mapping gives the same result as the plain one
+  util::MappedContainer const plainData
+    (std::cref(data), std::cref(plainMapping), plainMapping.size(), 99.0);
+  util::MappedContainer const runData
+    (std::cref(data), std::cref(mapping), mapping.size(), 99.0);
+  BOOST_TEST(runData.size() == plainData.size());
+  for (std::size_t i = 0; i < plainData.size(); ++i)
+    BOOST_TEST(runData[i] == plainData[i]);
+
+  std::vector<double> plainCopy(plainData.size()), runCopy(runData.size());
+  auto const plainEnd = plainData.copy_to(plainCopy.begin());
+  auto const runEnd = runData.copy_to(runCopy.begin());
+  BOOST_TEST((plainEnd == plainCopy.end()));
+  BOOST_TEST((runEnd == runCopy.end()));
+  BOOST_TEST(runCopy == plainCopy);
+  BOOST_TEST(runCopy[4] == 99.0);
+  BOOST_TEST(runCopy[10] == -1.0);
+
+  // container larger than the mapping
+  util::MappedContainer const largerData
+    (std::cref(data), std::cref(mapping), mapping.size() + 2U, 99.0);
+  std::vector<double> largerCopy(largerData.size());
+  largerData.copy_to(largerCopy.data());
+  BOOST_TEST(largerCopy[0] == -4.0);
+  BOOST_TEST(largerCopy[mapping.size() + 1U] == 99.0);
+
+  // container smaller than the mapping, cutting a run: no more than `size()`
+  // elements are written
+  util::MappedContainer const smallerData
+    (std::cref(data), std::cref(mapping), 8U, 99.0);
+  std::vector<double> smallerCopy(smallerData.size() + 1U, -99.0);
+  auto const smallerEnd = smallerData.copy_to(smallerCopy.begin());
+  BOOST_TEST((smallerEnd == std::next(smallerCopy.begin(), smallerData.size())));
+  for (std::size_t i = 0; i < smallerData.size(); ++i)
+    BOOST_TEST(smallerCopy[i] == plainCopy[i]);
+  BOOST_TEST(smallerCopy.back() == -99.0);
+
+  // construction from runs
+  using Run_t = util::RunLengthMapping<std::size_t>::Run_t;
+  util::RunLengthMapping<std::size_t> const fromRuns
+    { 12U, { Run_t{ 0U, 4U, 4U }, Run_t{ 6U, 0U, 4U }, Run_t{ 10U, 1U, 1U } } };
+  BOOST_TEST(fromRuns.expand() == plainMapping);
+
+  BOOST_CHECK_THROW(
+    (util::RunLengthMapping<std::size_t>{ 5U, { Run_t{ 2U, 0U, 4U } } }),
+    std::invalid_argument
+    );
+  BOOST_CHECK_THROW(
+    (util::RunLengthMapping<std::size_t>
+      { 8U, { Run_t{ 2U, 0U, 4U }, Run_t{ 3U, 0U, 1U } } }),
+    std::invalid_argument
+    );
+
+} // runLengthMappingTest()
+
+
+//------------------------------------------------------------------------------
+void sparseMappingTest() {
+
+  constexpr auto InvalidIndex = util::MappedContainerBase::invalidIndex();
+
+  std::array<double, 4U> const data {{ 0.0, -1.0, -2.0, -3.0 }};
+
+  // a few channels out of many, in any order
+  constexpr std::size_t Size = 1000U;
+  util::SparseMapping<std::size_t> const mapping
+    { Size, { { 999U, 0U }, { 17U, 2U }, { 16U, 1U }, { 500U, 3U }, { 3U, InvalidIndex } } };
+  BOOST_TEST(mapping.size() == Size);
+  BOOST_TEST(mapping.nMapped() == 4U);
+  BOOST_TEST(mapping[16U] == 1U);
+  BOOST_TEST(mapping[17U] == 2U);
+  BOOST_TEST(mapping[500U] == 3U);
+  BOOST_TEST(mapping[999U] == 0U);
+  BOOST_TEST(mapping[3U] == InvalidIndex);
+  BOOST_TEST(mapping[0U] == InvalidIndex);
+  BOOST_TEST(mapping.isMapped(500U));
+  BOOST_TEST(!mapping.isMapped(501U));
+
+  auto const& entries = mapping.entries();
+  BOOST_TEST(entries.size() == 4U);
+  BOOST_TEST(entries.front().destination == 16U);
+  BOOST_TEST(entries.back().destination == 999U);
+
+  // equivalent plain mapping
+  std::vector<std::size_t> const plainMapping = mapping.expand();
+  BOOST_TEST(plainMapping.size() == Size);
+  std::vector<std::size_t> const iterated { mapping.begin(), mapping.end() };
+  BOOST_TEST(iterated == plainMapping);
+  util::SparseMapping<std::size_t> const fromPlain { plainMapping };
+  BOOST_TEST(fromPlain.expand() == plainMapping);
+
+  // in a mapped container
+  util::MappedContainer const plainData
+    (std::cref(data), std::cref(plainMapping), Size, 99.0);
+  util::MappedContainer const sparseData
+    (std::cref(data), std::cref(mapping), Size, 99.0);
+  for (std::size_t i = 0; i < Size; ++i)
+    BOOST_TEST(sparseData[i] == plainData[i]);
+
+  std::vector<double> plainCopy(Size), sparseCopy(Size);
+  plainData.copy_to(plainCopy.begin());
+  sparseData.copy_to(sparseCopy.begin());
+  BOOST_TEST(sparseCopy == plainCopy);
+
+  // container smaller than the mapping: no more than `size()` elements written
+  util::MappedContainer const smallerData
+    (std::cref(data), std::cref(mapping), 100U, 99.0);
+  std::vector<double> smallerCopy(smallerData.size() + 1U, -99.0);
+  smallerData.copy_to(smallerCopy.data());
+  for (std::size_t i = 0; i < smallerData.size(); ++i)
+    BOOST_TEST(smallerCopy[i] == plainCopy[i]);
+  BOOST_TEST(smallerCopy.back() == -99.0);
+
+  // only the present entries
+  std::vector<std::pair<std::size_t, double>> visited;
+  mapping.forEachMapped(data,
+    [&visited](std::size_t channel, double value)
+      { visited.emplace_back(channel, value); }
+    );
+  BOOST_TEST(visited.size() == 4U);
+  BOOST_TEST(visited[0].first == 16U);
+  BOOST_TEST(visited[0].second == -1.0);
+  BOOST_TEST(visited[3].first == 999U);
+  BOOST_TEST(visited[3].second == 0.0);
+
+  // empty mapping
+  util::SparseMapping<std::size_t> const empty;
+  BOOST_TEST(empty.nMapped() == 0U);
+  BOOST_TEST(empty[5U] == InvalidIndex);
+
+  // errors
+  BOOST_CHECK_THROW(
+    (util::SparseMapping<std::size_t>{ 10U, { { 10U, 0U } } }),
+    std::invalid_argument
+    );
+  BOOST_CHECK_THROW(
+    (util::SparseMapping<std::size_t>{ 10U, { { 4U, 0U }, { 4U, 1U } } }),
+    std::invalid_argument
+    );
+
+} // sparseMappingTest()
+
+
 //------------------------------------------------------------------------------
 //--- registration of tests
 //
@@ -416,6 +597,14 @@ BOOST_AUTO_TEST_CASE(TestCase) {
   autosizeTest();
 } // TestCase
 
+BOOST_AUTO_TEST_CASE(RunLengthMappingTestCase) {
+  runLengthMappingTest();
+} // RunLengthMappingTestCase
+
+BOOST_AUTO_TEST_CASE(SparseMappingTestCase) {
+  sparseMappingTest();
+} // SparseMappingTestCase
+
 BOOST_AUTO_TEST_CASE(DocumentationTestCase) {
   classDoc1Test();
 } // DocumentationTestCase
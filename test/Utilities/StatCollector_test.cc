@@ -13,13 +13,15 @@
  */
 
 // C/C++ standard libraries
+#include <cmath> // std::sqrt()
 #include <array>
 #include <valarray>
 #include <utility> // std::pair<>
 #include <memory> // std::unique_ptr<>
 #include <initializer_list>
 #include <tuple>
-#include <stdexcept> // std::range_error
+#include <vector>
+#include <stdexcept> // std::range_error, std::domain_error
 
 // Boost libraries
 /*
@@ -532,6 +534,387 @@ void MinMaxCollectorTest() {
 } // MinMaxCollectorTest()
 
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Tests MultiChannelStatCollector against a StatCollector per channel
+ *
+ */
+template <typename T, typename W = T>
+void MultiChannelStatCollectorTest() {
+
+  using Data_t = T;
+  using Weight_t = W;
+
+  constexpr std::size_t NChannels = 7;
+  constexpr std::size_t NTicks = 5;
+
+  lar::util::MultiChannelStatCollector<Data_t, Weight_t> stats(NChannels);
+  std::vector<lar::util::StatCollector<Data_t, Weight_t>> expected(NChannels);
+
+  BOOST_CHECK_EQUAL(stats.NChannels(), NChannels);
+  for (std::size_t ch = 0; ch < NChannels; ++ch) {
+    BOOST_CHECK_EQUAL(stats.N(ch), 0);
+    BOOST_CHECK_THROW(stats.Average(ch), std::range_error);
+  }
+
+  // one sample to all channels
+  std::vector<Data_t> sample(NChannels);
+  for (std::size_t ch = 0; ch < NChannels; ++ch) sample[ch] = Data_t(ch * 2 + 1);
+  stats.add_to_all(sample.begin());
+  for (std::size_t ch = 0; ch < NChannels; ++ch) expected[ch].add(sample[ch]);
+
+  // a block of ticks for channels [ 2, 6 )
+  std::vector<Data_t> block;
+  for (std::size_t ch = 2; ch < 6; ++ch) {
+    for (std::size_t tick = 0; tick < NTicks; ++tick) {
+      Data_t const value = Data_t((ch * 3 + tick * 5) % 11);
+      block.push_back(value);
+      expected[ch].add(value);
+    }
+  }
+  stats.add_block(2, 4, NTicks, block.begin());
+
+  // single weighted entries
+  stats.add(6, Data_t(4), Weight_t(2));
+  expected[6].add(Data_t(4), Weight_t(2));
+
+  for (std::size_t ch = 0; ch < NChannels; ++ch) {
+    auto const& exp = expected[ch];
+    BOOST_CHECK_EQUAL(stats.N(ch), exp.N());
+    BOOST_CHECK_EQUAL(stats.Weights(ch), exp.Weights());
+    BOOST_CHECK_CLOSE(double(stats.Sum(ch)), double(exp.Sum()), 1e-4);
+    BOOST_CHECK_CLOSE(double(stats.SumSq(ch)), double(exp.SumSq()), 1e-4);
+    BOOST_CHECK_CLOSE(double(stats.Average(ch)), double(exp.Average()), 1e-4);
+    BOOST_CHECK_CLOSE(double(stats.RMS(ch)), double(exp.RMS()), 1e-3);
+    BOOST_CHECK_CLOSE
+      (double(stats.AverageWeight(ch)), double(exp.AverageWeight()), 1e-4);
+  } // for
+
+  // new channels are empty
+  stats.resize(NChannels + 1);
+  BOOST_CHECK_EQUAL(stats.N(NChannels), 0);
+  BOOST_CHECK_EQUAL(stats.N(0), 1);
+
+  stats.clear();
+  BOOST_CHECK_EQUAL(stats.NChannels(), NChannels + 1);
+  for (std::size_t ch = 0; ch < stats.NChannels(); ++ch) {
+    BOOST_CHECK_EQUAL(stats.N(ch), 0);
+    BOOST_CHECK_EQUAL(stats.Weights(ch), Weight_t(0));
+  }
+
+} // MultiChannelStatCollectorTest()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Tests QuantileCollector with exact and sketched inputs
+ *
+ */
+template <typename T>
+void QuantileCollectorTest() {
+
+  using Data_t = T;
+
+  //
+  // 1. small sample: quantiles are exact
+  //
+  lar::util::QuantileCollector<Data_t> small;
+  BOOST_CHECK(!small.has_data());
+  BOOST_CHECK_THROW(small.Median(), std::range_error);
+
+  small.add({ Data_t(5), Data_t(-1), Data_t(3) });
+  std::array<Data_t, 2> more_data{{ Data_t(2), Data_t(4) }};
+  small.add(more_data.begin(), more_data.end());
+  BOOST_CHECK_EQUAL(small.N(), 5U);
+  BOOST_CHECK_EQUAL(small.Median(), Data_t(3));
+  BOOST_CHECK_EQUAL(small.Quantile(0.0), Data_t(-1));
+  BOOST_CHECK_EQUAL(small.Quantile(1.0), Data_t(5));
+  BOOST_CHECK_EQUAL(small.Quantile(0.2), Data_t(-1));
+  BOOST_CHECK_EQUAL(small.Quantile(0.21), Data_t(2));
+  BOOST_CHECK_CLOSE(small.Rank(Data_t(3)), 0.6, 1e-6);
+  BOOST_CHECK_THROW(small.Quantile(1.5), std::domain_error);
+
+  //
+  // 2. large sample, filled in one and in many collectors
+  //
+  constexpr unsigned int NValues = 100000;
+  constexpr double Tolerance = 0.02; // documented rank error for K = 200
+
+  lar::util::QuantileCollector<Data_t> single;
+  std::array<lar::util::QuantileCollector<Data_t>, 4> partial;
+  for (unsigned int i = 0; i < NValues; ++i) {
+    // a permutation of [ 0, NValues [
+    Data_t const value = Data_t((i * 7919U) % NValues);
+    single.add(value);
+    partial[i % partial.size()].add(value);
+  }
+  lar::util::QuantileCollector<Data_t> merged;
+  for (auto const& collector: partial) merged.merge(collector);
+
+  for (auto const* collector: { &single, &merged }) {
+    BOOST_CHECK_EQUAL(collector->N(), NValues);
+    BOOST_CHECK_LT(collector->SketchSize(), 4 * collector->K());
+    BOOST_CHECK_EQUAL(collector->min(), Data_t(0));
+    BOOST_CHECK_EQUAL(collector->max(), Data_t(NValues - 1));
+    for (double const q: { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 }) {
+      double const estimate = double(collector->Quantile(q)) / NValues;
+      BOOST_CHECK_SMALL(estimate - q, Tolerance);
+      BOOST_CHECK_SMALL
+        (collector->Rank(Data_t(q * NValues)) - q, Tolerance);
+    }
+  } // for
+
+  merged.clear();
+  BOOST_CHECK(!merged.has_data());
+  BOOST_CHECK_EQUAL(merged.SketchSize(), 0U);
+
+} // QuantileCollectorTest()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Tests the windowed collectors against collectors of the last entries
+ *
+ */
+template <typename T, typename W = T>
+void WindowedStatCollectorTest() {
+
+  using Data_t = T;
+  using Weight_t = W;
+
+  constexpr std::size_t WindowSize = 5;
+  constexpr std::size_t NEntries = 23; // wraps the window a few times
+
+  lar::util::WindowedStatCollector<Data_t, Weight_t> stats(WindowSize);
+  lar::util::WindowedStatCollector2D<Data_t, Weight_t> stats2D(WindowSize);
+  BOOST_CHECK_EQUAL(stats.WindowSize(), WindowSize);
+  BOOST_CHECK_EQUAL(stats.N(), 0);
+  BOOST_CHECK_THROW(stats.Average(), std::range_error);
+  BOOST_CHECK_THROW(stats2D.Covariance(), std::range_error);
+
+  std::vector<std::tuple<Data_t, Data_t, Weight_t>> entries;
+  for (std::size_t i = 0; i < NEntries; ++i) {
+    entries.emplace_back
+      (Data_t((i * 7) % 13), Data_t((i * 5) % 11), Weight_t(1 + i % 3));
+  }
+
+  for (std::size_t i = 0; i < NEntries; ++i) {
+    auto const [ x, y, w ] = entries[i];
+    stats.add(x, w);
+    stats2D.add(x, y, w);
+
+    lar::util::StatCollector<Data_t, Weight_t> expected;
+    lar::util::StatCollector2D<Data_t, Weight_t> expected2D;
+    std::size_t const first = (i + 1 > WindowSize)? i + 1 - WindowSize: 0;
+    for (std::size_t j = first; j <= i; ++j) {
+      auto const [ ex, ey, ew ] = entries[j];
+      expected.add(ex, ew);
+      expected2D.add(ex, ey, ew);
+    }
+
+    BOOST_CHECK_EQUAL(stats.N(), expected.N());
+    BOOST_CHECK_CLOSE(double(stats.Weights()), double(expected.Weights()), 1e-6);
+    BOOST_CHECK_CLOSE(double(stats.Sum()), double(expected.Sum()), 1e-6);
+    BOOST_CHECK_CLOSE(double(stats.Average()), double(expected.Average()), 1e-6);
+    BOOST_CHECK_SMALL(double(stats.RMS() - expected.RMS()), 1e-6);
+    BOOST_CHECK_CLOSE
+      (double(stats.AverageWeight()), double(expected.AverageWeight()), 1e-6);
+
+    BOOST_CHECK_EQUAL(stats2D.N(), expected2D.N());
+    BOOST_CHECK_CLOSE(double(stats2D.AverageY()), double(expected2D.AverageY()), 1e-6);
+    BOOST_CHECK_SMALL
+      (double(stats2D.Covariance() - expected2D.Covariance()), 1e-6);
+    if (i >= 2) {
+      BOOST_CHECK_SMALL(double(
+        stats2D.LinearCorrelation() - expected2D.LinearCorrelation()
+        ), 1e-6);
+    }
+  } // for
+
+  stats.clear();
+  BOOST_CHECK_EQUAL(stats.N(), 0);
+  BOOST_CHECK_EQUAL(stats.Weights(), Weight_t(0));
+
+  // bulk insertion
+  std::vector<Data_t> values{ 1, 2, 3, 4, 5, 6, 7 };
+  stats.add_unweighted(values.begin(), values.end());
+  BOOST_CHECK_EQUAL(stats.N(), int(WindowSize));
+  BOOST_CHECK_CLOSE(double(stats.Average()), 5.0, 1e-6);
+  BOOST_CHECK_CLOSE(double(stats.Variance()), 2.0, 1e-6);
+
+} // WindowedStatCollectorTest()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Tests the exponentially weighted collectors against direct sums
+ *
+ */
+void ExponentialStatCollectorTest() {
+
+  constexpr double Decay = 0.9;
+
+  BOOST_CHECK_THROW
+    (lar::util::ExponentialStatCollector<double>(0.0), std::domain_error);
+  BOOST_CHECK_THROW
+    (lar::util::ExponentialStatCollector2D<double>(1.5), std::domain_error);
+
+  lar::util::ExponentialStatCollector<double> stats(Decay);
+  lar::util::ExponentialStatCollector2D<double> stats2D(Decay);
+  BOOST_CHECK_EQUAL(stats.Decay(), Decay);
+  BOOST_CHECK_THROW(stats.Average(), std::range_error);
+
+  std::vector<std::pair<double, double>> entries;
+  for (int i = 0; i < 30; ++i)
+    entries.emplace_back(double((i * 7) % 13), 0.5 * i - double(i % 4));
+
+  std::vector<std::pair<double, double>> xWeighted;
+  for (auto const& [ x, y ]: entries) xWeighted.emplace_back(x, 1.0);
+  stats.add_weighted(xWeighted.begin(), xWeighted.end());
+  for (auto const& [ x, y ]: entries) stats2D.add(x, y);
+
+  // direct computation: the i-th entry has weight Decay^(n - 1 - i)
+  double w = 0.0, sx = 0.0, sy = 0.0, sxx = 0.0, syy = 0.0, sxy = 0.0;
+  double weight = 1.0;
+  for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+    auto const [ x, y ] = *it;
+    w += weight;
+    sx += weight * x;
+    sy += weight * y;
+    sxx += weight * x * x;
+    syy += weight * y * y;
+    sxy += weight * x * y;
+    weight *= Decay;
+  }
+  double const avgX = sx / w, avgY = sy / w;
+  double const varX = sxx / w - avgX * avgX, varY = syy / w - avgY * avgY;
+  double const cov = sxy / w - avgX * avgY;
+
+  BOOST_CHECK_EQUAL(stats.N(), int(entries.size()));
+  BOOST_CHECK_CLOSE(stats.Weights(), w, 1e-8);
+  BOOST_CHECK_CLOSE(stats.Average(), avgX, 1e-8);
+  BOOST_CHECK_CLOSE(stats.Variance(), varX, 1e-8);
+
+  BOOST_CHECK_EQUAL(stats2D.N(), int(entries.size()));
+  BOOST_CHECK_CLOSE(stats2D.AverageX(), avgX, 1e-8);
+  BOOST_CHECK_CLOSE(stats2D.AverageY(), avgY, 1e-8);
+  BOOST_CHECK_CLOSE(stats2D.VarianceY(), varY, 1e-8);
+  BOOST_CHECK_CLOSE(stats2D.Covariance(), cov, 1e-8);
+  BOOST_CHECK_CLOSE
+    (stats2D.LinearCorrelation(), cov / std::sqrt(varX * varY), 1e-8);
+
+  // with no decay, the statistics are the usual ones
+  lar::util::ExponentialStatCollector<double> flat(1.0);
+  lar::util::StatCollector<double> expected;
+  for (auto const& [ x, y ]: entries) { flat.add(x); expected.add(x); }
+  BOOST_CHECK_CLOSE(flat.Average(), expected.Average(), 1e-8);
+  BOOST_CHECK_CLOSE(flat.RMS(), expected.RMS(), 1e-8);
+
+  stats2D.clear();
+  BOOST_CHECK_EQUAL(stats2D.N(), 0);
+  BOOST_CHECK_EQUAL(stats2D.Weights(), 0.0);
+
+} // ExponentialStatCollectorTest()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Tests MomentCollector against a direct two-pass computation
+ *
+ */
+template <typename T, typename W = T>
+void MomentCollectorTest() {
+
+  using Data_t = T;
+  using Weight_t = W;
+
+  // power sums are unrolled for any power
+  lar::util::details::DataTracker4<double> powers;
+  powers.add(2.0, 3.0);
+  powers.add(-1.0, 1.0);
+  BOOST_CHECK_EQUAL(powers.Sum(), 5.0);
+  BOOST_CHECK_EQUAL(powers.SumSq(), 13.0);
+  BOOST_CHECK_EQUAL(powers.SumCube(), 23.0);
+  BOOST_CHECK_EQUAL(powers.SumFourth(), 49.0);
+
+  lar::util::MomentCollector<Data_t, Weight_t> empty;
+  BOOST_CHECK_EQUAL(empty.N(), 0);
+  BOOST_CHECK_THROW(empty.Average(), std::range_error);
+  BOOST_CHECK_THROW(empty.Skewness(), std::range_error);
+
+  // a skewed distribution on top of a large pedestal
+  constexpr std::size_t NValues = 1000;
+  std::vector<Data_t> values;
+  std::vector<std::pair<Data_t, Weight_t>> weighted;
+  for (std::size_t i = 0; i < NValues; ++i) {
+    Data_t const value = Data_t(2000 + (i * 37) % 17 + ((i % 10 == 0)? 25: 0));
+    values.push_back(value);
+    weighted.emplace_back(value, Weight_t(1 + i % 2));
+  }
+
+  auto expectedMoments = [](auto const& entries)
+    {
+      double w = 0.0, sum = 0.0;
+      for (auto const& [ x, wx ]: entries) { w += wx; sum += wx * x; }
+      double const mean = sum / w;
+      double m2 = 0.0, m3 = 0.0, m4 = 0.0;
+      for (auto const& [ x, wx ]: entries) {
+        double const d = x - mean;
+        m2 += wx * d * d;
+        m3 += wx * d * d * d;
+        m4 += wx * d * d * d * d;
+      }
+      return std::array<double, 4>
+        {{ mean, m2 / w, std::sqrt(w) * m3 / std::pow(m2, 1.5), w * m4 / (m2 * m2) }};
+    };
+
+  // unweighted: one by one, in bulk and merged from two collectors
+  std::vector<std::pair<Data_t, Weight_t>> unit;
+  for (auto value: values) unit.emplace_back(value, Weight_t(1));
+  auto const expected = expectedMoments(unit);
+
+  lar::util::MomentCollector<Data_t, Weight_t> single, bulk, first, second;
+  for (auto value: values) single.add(value);
+  bulk.add_unweighted(values.begin(), values.end());
+  first.add_unweighted(values.begin(), values.begin() + 300);
+  second.add_unweighted(values.begin() + 300, values.end());
+  first.merge(second);
+
+  for (auto const* stats: { &single, &bulk, &first }) {
+    BOOST_CHECK_EQUAL(stats->N(), int(NValues));
+    BOOST_CHECK_CLOSE(double(stats->Weights()), double(NValues), 1e-8);
+    BOOST_CHECK_CLOSE(double(stats->Average()), expected[0], 1e-8);
+    BOOST_CHECK_CLOSE(double(stats->Variance()), expected[1], 1e-6);
+    BOOST_CHECK_CLOSE(double(stats->Skewness()), expected[2], 1e-6);
+    BOOST_CHECK_CLOSE(double(stats->Kurtosis()), expected[3], 1e-6);
+    BOOST_CHECK_CLOSE
+      (double(stats->ExcessKurtosis()), expected[3] - 3.0, 1e-6);
+  } // for
+
+  // weighted
+  auto const expectedW = expectedMoments(weighted);
+  lar::util::MomentCollector<Data_t, Weight_t> weightedStats;
+  weightedStats.add_weighted(weighted.begin(), weighted.end());
+  BOOST_CHECK_EQUAL(weightedStats.N(), int(NValues));
+  BOOST_CHECK_CLOSE(double(weightedStats.Average()), expectedW[0], 1e-8);
+  BOOST_CHECK_CLOSE(double(weightedStats.RMS()), std::sqrt(expectedW[1]), 1e-6);
+  BOOST_CHECK_CLOSE(double(weightedStats.Skewness()), expectedW[2], 1e-6);
+  BOOST_CHECK_CLOSE(double(weightedStats.Kurtosis()), expectedW[3], 1e-6);
+
+  // no variance
+  lar::util::MomentCollector<Data_t, Weight_t> flat;
+  flat.add(Data_t(3));
+  flat.add(Data_t(3));
+  BOOST_CHECK_EQUAL(flat.Variance(), Weight_t(0));
+  BOOST_CHECK_THROW(flat.Kurtosis(), std::range_error);
+
+  flat.clear();
+  BOOST_CHECK_EQUAL(flat.N(), 0);
+  BOOST_CHECK_EQUAL(flat.Weights(), Weight_t(0));
+
+} // MomentCollectorTest()
+
+
 //------------------------------------------------------------------------------
 //--- registration of tests
 //
@@ -581,6 +964,18 @@ BOOST_AUTO_TEST_CASE(StatCollector2DRealTest) {
 }
 
 
+//
+// multi-channel stat collector tests
+//
+BOOST_AUTO_TEST_CASE(MultiChannelStatCollectorRealTest) {
+  MultiChannelStatCollectorTest<double, double>();
+}
+
+BOOST_AUTO_TEST_CASE(MultiChannelStatCollectorFloatTest) {
+  MultiChannelStatCollectorTest<float, double>();
+}
+
+
 //
 // Minimum/maximum collector tests
 //
@@ -591,3 +986,43 @@ BOOST_AUTO_TEST_CASE(MinMaxCollectorIntegerTest) {
 BOOST_AUTO_TEST_CASE(MinMaxCollectorRealTest) {
   MinMaxCollectorTest<double>();
 }
+
+
+//
+// quantile collector tests
+//
+BOOST_AUTO_TEST_CASE(QuantileCollectorIntegerTest) {
+  QuantileCollectorTest<int>();
+}
+
+BOOST_AUTO_TEST_CASE(QuantileCollectorRealTest) {
+  QuantileCollectorTest<double>();
+}
+
+
+//
+// windowed and exponentially weighted collector tests
+//
+BOOST_AUTO_TEST_CASE(WindowedStatCollectorRealTest) {
+  WindowedStatCollectorTest<double, double>();
+}
+
+BOOST_AUTO_TEST_CASE(WindowedStatCollectorFloatTest) {
+  WindowedStatCollectorTest<float, double>();
+}
+
+BOOST_AUTO_TEST_CASE(ExponentialStatCollectorRealTest) {
+  ExponentialStatCollectorTest();
+}
+
+
+//
+// moment collector tests
+//
+BOOST_AUTO_TEST_CASE(MomentCollectorRealTest) {
+  MomentCollectorTest<double, double>();
+}
+
+BOOST_AUTO_TEST_CASE(MomentCollectorFloatTest) {
+  MomentCollectorTest<float, double>();
+}